@@ -143,6 +143,10 @@ struct csa
       /* name of input file containing initial basis */
       int exact;
       /* flag to use glp_exact rather than glp_simplex */
+#if 1 /* 16/X-2026 */
+      int concur;
+      /* flag to use glp_concurrent rather than glp_simplex */
+#endif
       int xcheck;
       /* flag to check final basis with glp_exact */
       int nomip;
@@ -242,6 +246,13 @@ static void print_help(const char *my_name)
       xprintf("   --simplex         use simplex method (default)\n");
       xprintf("   --interior        use interior point method (LP only)"
          "\n");
+#if 1 /* 16/X-2026 */
+      xprintf("   --concurrent      run primal and dual simplex and inte"
+         "rior point method\n");
+      xprintf("                     concurrently; use result of the fi"
+         "rst one to finish\n");
+      xprintf("                     (LP only)\n");
+#endif
       xprintf("   -r filename, --read filename\n");
       xprintf("                     read solution from filename rather "
          "to find it with\n");
@@ -340,6 +351,10 @@ static void print_help(const char *my_name)
          "t)\n");
       xprintf("   --nosteep         use standard \"textbook\" pricing\n"
          );
+#if 1 /* 17/X-2026 */
+      xprintf("   --partial         use partial pricing (primal simple"
+         "x only)\n");
+#endif
       xprintf("   --relax           use Harris' two-pass ratio test (de"
          "fault)\n");
       xprintf("   --norelax         use standard \"textbook\" ratio tes"
@@ -369,6 +384,22 @@ static void print_help(const char *my_name)
          "ring (default)\n");
       xprintf("   --symamd          use approximate minimum degree orde"
          "ring\n");
+#if 1 /* 17/X-2026 */
+      xprintf("   --crossover       find optimal basic solution with cr"
+         "ossover after\n");
+      xprintf("                     interior point method; for MIP use"
+         " it to solve\n");
+      xprintf("                     initial LP relaxation (assumes --no"
+         "intopt)\n");
+      xprintf("   --mcc nnn         use up to nnn centrality correctors"
+         " on each iteration\n");
+      xprintf("                     of interior point method (default:"
+         " 0)\n");
+      xprintf("   --ubnd            handle upper bounds of variables di"
+         "rectly in interior\n");
+      xprintf("                     point method rather than splitting"
+         " them\n");
+#endif
       xprintf("\n");
       xprintf("Options specific to MIP solver:\n");
       xprintf("   --nomip           consider all integer variables as c"
@@ -385,6 +416,21 @@ static void print_help(const char *my_name)
       xprintf("   --pcost           branch using hybrid pseudocost heur"
          "istic (may be\n");
       xprintf("                     useful for hard instances)\n");
+#if 1 /* 17/X-2026 */
+      xprintf("   --rlb [nnn]       branch using reliability branching "
+         "(nnn is\n");
+      xprintf("                     reliability threshold; default is 4"
+         ")\n");
+      xprintf("   --sbnode nnn      limit simplex iterations spent on s"
+         "trong branching\n");
+      xprintf("                     per node to nnn; default is 5000 (f"
+         "or --rlb only)\n");
+      xprintf("   --sbtotal nnn     limit simplex iterations spent on s"
+         "trong branching\n");
+      xprintf("                     in total to nnn; default is 100000 "
+         "(for --rlb\n");
+      xprintf("                     only)\n");
+#endif
       xprintf("   --dfs             backtrack using depth first search "
          "\n");
       xprintf("   --bfs             backtrack using breadth first searc"
@@ -415,6 +461,27 @@ static void print_help(const char *my_name)
       xprintf("   --cuts            generate all cuts above\n");
       xprintf("   --mipgap tol      set relative mip gap tolerance to t"
          "ol\n");
+#if 1 /* 16/X-2026 */
+      xprintf("   --threads nnn     use nnn threads to solve LP relaxat"
+         "ions of active\n");
+#if 0 /* 17/X-2026 */
+      xprintf("                     subproblems (default is 1)\n");
+#else
+      xprintf("                     subproblems and to compute Cholesky"
+         " factorization\n");
+      xprintf("                     in interior-point method (default i"
+         "s 1)\n");
+#endif
+#endif
+#if 1 /* 17/X-2026 */
+      xprintf("   --nfmem nnn       write change lists of subproblems t"
+         "o node files, if\n");
+      xprintf("                     they take more than nnn megabytes o"
+         "f memory\n");
+      xprintf("   --nfdir dir       create node files in directory dir "
+         "(default is\n");
+      xprintf("                     current directory)\n");
+#endif
 #if 1 /* 15/VIII-2011 */
       xprintf("   --minisat         translate integer feasibility probl"
          "em to CNF-SAT\n");
@@ -525,6 +592,10 @@ static int parse_cmdline(struct csa *csa, int argc, char *argv[])
             csa->solution = SOL_BASIC;
          else if (p("--interior"))
             csa->solution = SOL_INTERIOR;
+#if 1 /* 16/X-2026 */
+         else if (p("--concurrent"))
+            csa->solution = SOL_BASIC, csa->concur = 1;
+#endif
 #if 1 /* 28/V-2010 */
          else if (p("--alien"))
             csa->iocp.alien = GLP_ON;
@@ -810,6 +881,10 @@ static int parse_cmdline(struct csa *csa, int argc, char *argv[])
             csa->smcp.pricing = GLP_PT_PSE;
          else if (p("--nosteep"))
             csa->smcp.pricing = GLP_PT_STD;
+#if 1 /* 17/X-2026 */
+         else if (p("--partial"))
+            csa->smcp.pricing = GLP_PT_PARTIAL;
+#endif
          else if (p("--relax"))
             csa->smcp.r_test = GLP_RT_HAR;
          else if (p("--norelax"))
@@ -842,6 +917,30 @@ static int parse_cmdline(struct csa *csa, int argc, char *argv[])
             csa->iptcp.ord_alg = GLP_ORD_AMD;
          else if (p("--symamd"))
             csa->iptcp.ord_alg = GLP_ORD_SYMAMD;
+#if 1 /* 17/X-2026 */
+         else if (p("--crossover"))
+         {  csa->solution = SOL_INTERIOR;
+            csa->iptcp.crossover = GLP_ON;
+            csa->iocp.presolve = GLP_OFF;
+         }
+         else if (p("--mcc"))
+         {  int nnn;
+            k++;
+            if (k == argc || argv[k][0] == '\0' || argv[k][0] == '-')
+            {  xprintf("No number of centrality correctors specified"
+                  "\n");
+               return 1;
+            }
+            if (str2int(argv[k], &nnn) || !(0 <= nnn && nnn <= 10))
+            {  xprintf("Invalid number of centrality correctors '%s'"
+                  "\n", argv[k]);
+               return 1;
+            }
+            csa->iptcp.mcc = nnn;
+         }
+         else if (p("--ubnd"))
+            csa->iptcp.ubnd = GLP_ON;
+#endif
          else if (p("--nomip"))
             csa->nomip = 1;
          else if (p("--first"))
@@ -854,6 +953,39 @@ static int parse_cmdline(struct csa *csa, int argc, char *argv[])
             csa->iocp.br_tech = GLP_BR_MFV;
          else if (p("--pcost"))
             csa->iocp.br_tech = GLP_BR_PCH;
+#if 1 /* 17/X-2026 */
+         else if (p("--rlb"))
+         {  csa->iocp.br_tech = GLP_BR_RLB;
+            if (argv[k+1] && isdigit((unsigned char)argv[k+1][0]))
+            {  int nnn;
+               k++;
+               if (str2int(argv[k], &nnn) || !(1 <= nnn && nnn <= 100))
+               {  xprintf("Invalid reliability threshold '%s'\n",
+                     argv[k]);
+                  return 1;
+               }
+               csa->iocp.rel_min = nnn;
+            }
+         }
+         else if (p("--sbnode") || p("--sbtotal"))
+         {  int nnn;
+            k++;
+            if (k == argc || argv[k][0] == '\0' || argv[k][0] == '-')
+            {  xprintf("No strong branching iteration limit specified"
+                  "\n");
+               return 1;
+            }
+            if (str2int(argv[k], &nnn) || nnn < 0)
+            {  xprintf("Invalid strong branching iteration limit '%s'"
+                  "\n", argv[k]);
+               return 1;
+            }
+            if (strcmp(argv[k-1], "--sbnode") == 0)
+               csa->iocp.sb_nd_lim = nnn;
+            else
+               csa->iocp.sb_it_lim = nnn;
+         }
+#endif
          else if (p("--dfs"))
             csa->iocp.bt_tech = GLP_BT_DFS;
          else if (p("--bfs"))
@@ -909,6 +1041,48 @@ static int parse_cmdline(struct csa *csa, int argc, char *argv[])
             }
             csa->iocp.mip_gap = mip_gap;
          }
+#if 1 /* 16/X-2026 */
+         else if (p("--threads"))
+         {  int nnn;
+            k++;
+            if (k == argc || argv[k][0] == '\0' || argv[k][0] == '-')
+            {  xprintf("No number of threads specified\n");
+               return 1;
+            }
+            if (str2int(argv[k], &nnn) || !(1 <= nnn && nnn <= 256))
+            {  xprintf("Invalid number of threads '%s'\n", argv[k]);
+               return 1;
+            }
+            csa->iocp.threads = nnn;
+#if 1 /* 17/X-2026 */
+            csa->iptcp.threads = nnn;
+#endif
+         }
+#endif
+#if 1 /* 17/X-2026 */
+         else if (p("--nfmem"))
+         {  int nnn;
+            k++;
+            if (k == argc || argv[k][0] == '\0' || argv[k][0] == '-')
+            {  xprintf("No node file memory threshold specified\n");
+               return 1;
+            }
+            if (str2int(argv[k], &nnn) || nnn < 1)
+            {  xprintf("Invalid node file memory threshold '%s'\n",
+                  argv[k]);
+               return 1;
+            }
+            csa->iocp.nf_mem = nnn;
+         }
+         else if (p("--nfdir"))
+         {  k++;
+            if (k == argc || argv[k][0] == '\0' || argv[k][0] == '-')
+            {  xprintf("No node file directory specified\n");
+               return 1;
+            }
+            csa->iocp.nf_dir = argv[k];
+         }
+#endif
 #if 1 /* 15/VIII-2011 */
          else if (p("--minisat"))
             csa->minisat = 1;
@@ -1032,6 +1206,9 @@ int __cdecl main(int argc, char *argv[])
       csa->crash = USE_ADV_BASIS;
       csa->ini_file = NULL;
       csa->exact = 0;
+#if 1 /* 16/X-2026 */
+      csa->concur = 0;
+#endif
       csa->xcheck = 0;
       csa->nomip = 0;
 #if 1 /* 15/VIII-2011 */
@@ -1332,7 +1509,12 @@ err2:    {  xprintf("MathProg model processing error\n");
       /* determine the solution type */
       if (!csa->nomip &&
           glp_get_num_int(csa->prob) + glp_get_num_bin(csa->prob) > 0)
+#if 0 /* 17/X-2026 */
       {  if (csa->solution == SOL_INTERIOR)
+#else
+      {  if (csa->solution == SOL_INTERIOR &&
+             csa->iptcp.crossover != GLP_ON)
+#endif
          {  xprintf("Interior-point method is not able to solve MIP pro"
                "blem; use --simplex\n");
             ret = EXIT_FAILURE;
@@ -1403,6 +1585,16 @@ err2:    {  xprintf("MathProg model processing error\n");
       /*--------------------------------------------------------------*/
       /* solve the problem */
       start = glp_time();
+#if 1 /* 16/X-2026 */
+      if (csa->solution == SOL_BASIC && csa->concur && !csa->exact)
+      {  int sol;
+         glp_set_bfcp(csa->prob, &csa->bfcp);
+         glp_concurrent(csa->prob, &csa->smcp, &csa->iptcp, &sol);
+         if (sol == GLP_IPT)
+            csa->solution = SOL_INTERIOR;
+      }
+      else
+#endif
       if (csa->solution == SOL_BASIC)
       {  if (!csa->exact)
          {  glp_set_bfcp(csa->prob, &csa->bfcp);
@@ -1425,8 +1617,20 @@ err2:    {  xprintf("MathProg model processing error\n");
          else
             glp_exact(csa->prob, &csa->smcp);
       }
+#if 0 /* 17/X-2026 */
       else if (csa->solution == SOL_INTERIOR)
          glp_interior(csa->prob, &csa->iptcp);
+#else
+      else if (csa->solution == SOL_INTERIOR)
+      {  glp_set_bfcp(csa->prob, &csa->bfcp);
+         glp_interior(csa->prob, &csa->iptcp);
+         /* if crossover has found optimal basis, report basic
+          * solution */
+         if (csa->iptcp.crossover == GLP_ON &&
+             glp_get_status(csa->prob) == GLP_OPT)
+            csa->solution = SOL_BASIC;
+      }
+#endif
 #if 1 /* 15/VIII-2011 */
       else if (csa->solution == SOL_INTEGER && csa->minisat)
       {  if (glp_check_cnfsat(csa->prob) == 0)
@@ -1438,7 +1642,15 @@ err2:    {  xprintf("MathProg model processing error\n");
       else if (csa->solution == SOL_INTEGER)
       {  glp_set_bfcp(csa->prob, &csa->bfcp);
          if (!csa->iocp.presolve)
+#if 0 /* 17/X-2026 */
             glp_simplex(csa->prob, &csa->smcp);
+#else
+         {  if (csa->iptcp.crossover == GLP_ON)
+               glp_interior(csa->prob, &csa->iptcp);
+            else
+               glp_simplex(csa->prob, &csa->smcp);
+         }
+#endif
 #if 0
          csa->iocp.msg_lev = GLP_MSG_DBG;
          csa->iocp.pp_tech = GLP_PP_NONE;
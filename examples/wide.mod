@@ -0,0 +1,65 @@
+/* WIDE, Random LP with Many More Columns than Rows */
+
+/* Written in GNU MathProg by agent <agent@local> */
+
+/* This model generates a random packing LP with m rows and n columns,
+   where n is much larger than m. Each column has nz non-zero
+   coefficients in randomly chosen rows. Such problems are intended to
+   compare pricing techniques of the primal simplex, for example:
+
+      glpsol --math wide.mod --primal --noscale --nosteep
+      glpsol --math wide.mod --primal --noscale --steep
+      glpsol --math wide.mod --primal --noscale --partial
+
+   Other instances can be obtained with the --seed option or by
+   changing the parameters in the data section. */
+
+param m, integer, > 0;
+/* number of rows */
+
+param n, integer, > 0;
+/* number of columns */
+
+param nz, integer, > 0;
+/* number of non-zeros in each column */
+
+set I := 1..m;
+/* set of rows */
+
+set J := 1..n;
+/* set of columns */
+
+param row{j in J, t in 1..nz}, integer, := 1 + floor(Uniform(0, m));
+/* row[j,t] is a row, where column j has t-th non-zero */
+
+set E := setof{j in J, t in 1..nz} (row[j,t], j);
+/* set of non-zero positions (i,j) of the constraint matrix */
+
+param a{(i,j) in E} := 1 + floor(Uniform(0, 50));
+/* constraint coefficients */
+
+param b{i in I} := 100 + floor(Uniform(0, 901));
+/* right-hand sides */
+
+param c{j in J} := 1 + floor(Uniform(0, 100));
+/* objective coefficients */
+
+var x{j in J}, >= 0, <= 10;
+
+s.t. r{i in I}: sum{(i,j) in E} a[i,j] * x[j] <= b[i];
+
+maximize obj: sum{j in J} c[j] * x[j];
+
+solve;
+
+printf "Objective value is %g\n", obj;
+
+data;
+
+param m := 300;
+
+param n := 100000;
+
+param nz := 5;
+
+end;
@@ -0,0 +1,294 @@
+/* concur.c (concurrent LP optimizer) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "env.h"
+#include "prob.h"
+
+/* solvers run by the concurrent optimizer: */
+#define PRIMAL    0  /* primal simplex */
+#define DUAL      1  /* dual simplex */
+#define INTERIOR  2  /* interior-point method */
+#define NSOLVERS  3
+
+struct csa
+{     /* common storage area */
+      glp_prob *lp[NSOLVERS];
+      /* working copies of the original problem object */
+      glp_smcp smcp[NSOLVERS];
+      /* simplex control parameters used for the copy lp[t] */
+      glp_iptcp iptcp;
+      /* interior-point control parameters used for lp[INTERIOR] */
+      int ret[NSOLVERS];
+      /* return code reported by the solver t */
+      double time[NSOLVERS];
+      /* time spent by the solver t, seconds */
+      volatile int stop;
+      /* stop flag checked by all solvers; set by the first solver
+         which has reached a conclusive result */
+      int winner;
+      /* solver which has reached a conclusive result first, or -1 */
+      void *lock;
+      /* mutex to serialize access to the winner field */
+};
+
+static const char *name[NSOLVERS] =
+      { "primal simplex", "dual simplex", "interior-point" };
+
+/***********************************************************************
+*  is_conclusive - check if solver has reached a conclusive result
+*
+*  This routine returns non-zero if the solver t has solved its copy of
+*  the problem to optimality or proved it to be infeasible or unbounded,
+*  in which case results of the other solvers are not needed anymore.
+*
+*  The interior-point solution is considered conclusive only if it is
+*  optimal, since the method has no reliable infeasibility test. */
+
+static int is_conclusive(struct csa *csa, int t)
+{     glp_prob *lp = csa->lp[t];
+      int ret = csa->ret[t], stat;
+      if (t == INTERIOR)
+         return ret == 0 && lp->ipt_stat == GLP_OPT;
+      if (ret == GLP_ENOPFS || ret == GLP_ENODFS)
+         return 1;
+      if (ret != 0)
+         return 0;
+      stat = glp_get_status(lp);
+      return stat == GLP_OPT || stat == GLP_NOFEAS || stat == GLP_UNBND;
+}
+
+/***********************************************************************
+*  solve_func - run one solver on its copy of the problem
+*
+*  This routine is called by thread_run with t = 0, 1, 2 to run the
+*  solver t. Once the solver returns, the routine raises the stop flag
+*  if the result is conclusive, or if the time limit has been exhausted
+*  (the same limit applies to all solvers). */
+
+static void solve_func(void *info, int t)
+{     struct csa *csa = info;
+      double tm_beg;
+      tm_beg = xtime();
+      if (csa->stop)
+      {  /* some other solver has already finished */
+         csa->ret[t] = GLP_ESTOP;
+         goto done;
+      }
+      if (t == INTERIOR)
+         csa->ret[t] = glp_interior(csa->lp[t], &csa->iptcp);
+      else
+         csa->ret[t] = glp_simplex(csa->lp[t], &csa->smcp[t]);
+      mutex_lock(csa->lock);
+      if (csa->winner < 0 && is_conclusive(csa, t))
+         csa->winner = t, csa->stop = 1;
+      else if (csa->ret[t] == GLP_ETMLIM)
+         csa->stop = 1;
+      mutex_unlock(csa->lock);
+done: csa->time[t] = xdifftime(xtime(), tm_beg);
+      return;
+}
+
+/***********************************************************************
+*  copy_sol - copy basic solution from working copy to original problem
+*
+*  This routine copies the final basis, basic solution components and
+*  their statuses from the working copy lp to the original problem
+*  object P. The basis factorization of P is invalidated. */
+
+static void copy_sol(glp_prob *P, glp_prob *lp)
+{     int i, j;
+      xassert(P->m == lp->m && P->n == lp->n);
+      P->valid = 0;
+      P->pbs_stat = lp->pbs_stat;
+      P->dbs_stat = lp->dbs_stat;
+      P->obj_val = lp->obj_val;
+      P->it_cnt += lp->it_cnt;
+      P->some = lp->some;
+      for (i = 1; i <= P->m; i++)
+      {  P->row[i]->stat = lp->row[i]->stat;
+         P->row[i]->prim = lp->row[i]->prim;
+         P->row[i]->dual = lp->row[i]->dual;
+      }
+      for (j = 1; j <= P->n; j++)
+      {  P->col[j]->stat = lp->col[j]->stat;
+         P->col[j]->prim = lp->col[j]->prim;
+         P->col[j]->dual = lp->col[j]->dual;
+      }
+      return;
+}
+
+/***********************************************************************
+*  copy_ipt - copy interior-point solution to original problem
+*
+*  This routine copies the interior-point solution from the working
+*  copy lp to the original problem object P. */
+
+static void copy_ipt(glp_prob *P, glp_prob *lp)
+{     int i, j;
+      xassert(P->m == lp->m && P->n == lp->n);
+      P->ipt_stat = lp->ipt_stat;
+      P->ipt_obj = lp->ipt_obj;
+      for (i = 1; i <= P->m; i++)
+      {  P->row[i]->pval = lp->row[i]->pval;
+         P->row[i]->dval = lp->row[i]->dval;
+      }
+      for (j = 1; j <= P->n; j++)
+      {  P->col[j]->pval = lp->col[j]->pval;
+         P->col[j]->dval = lp->col[j]->dval;
+      }
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_concurrent - solve LP with concurrent optimizer
+*
+*  SYNOPSIS
+*
+*  int glp_concurrent(glp_prob *P, const glp_smcp *smcp,
+*     const glp_iptcp *iptcp, int *sol);
+*
+*  DESCRIPTION
+*
+*  The routine glp_concurrent is a driver to the LP solvers, which runs
+*  the primal simplex, the dual simplex and the interior-point method
+*  simultaneously in separate threads. Each solver works on its own
+*  copy of the LP problem object P. As soon as one of the solvers has
+*  solved the problem to optimality (or, in case of simplex, proved it
+*  to be infeasible or unbounded), the others are cancelled, and the
+*  result of the first solver is stored in the problem object P.
+*
+*  The parameters smcp and iptcp point to the simplex and interior-
+*  point control parameters, respectively. If either is NULL, default
+*  parameters are used. The parameter meth of the simplex parameters is
+*  ignored. Terminal output of the solvers is suppressed.
+*
+*  On exit the routine stores in the location, which the parameter sol
+*  points to (unless it is NULL), the type of solution provided: GLP_SOL
+*  if the basic solution has been found by the primal or dual simplex,
+*  or GLP_IPT if the interior-point solution has been found. Only the
+*  solution of the corresponding type is changed in P.
+*
+*  If multi-threading is not supported, the solvers are run one after
+*  another in the order listed above, and the remaining solvers are
+*  skipped once a conclusive result has been reached.
+*
+*  RETURNS
+*
+*  The routine returns the code reported by the solver which has won.
+*  If none of the solvers has reached a conclusive result, the routine
+*  stores the basic solution found by the primal simplex (or by the dual
+*  simplex if the primal simplex has been cancelled) and returns the
+*  code reported by that solver. Return codes are the same as for the
+*  routines glp_simplex and glp_interior. */
+
+int glp_concurrent(glp_prob *P, const glp_smcp *smcp,
+      const glp_iptcp *iptcp, int *sol)
+{     ENV *env = get_env_ptr();
+      struct csa _csa, *csa = &_csa;
+      glp_smcp _smcp;
+      glp_iptcp _iptcp;
+      int t, ret, msg_lev, term_out;
+      if (smcp == NULL)
+         glp_init_smcp(&_smcp), smcp = &_smcp;
+      if (iptcp == NULL)
+         glp_init_iptcp(&_iptcp), iptcp = &_iptcp;
+      msg_lev = smcp->msg_lev;
+      if (!(msg_lev == GLP_MSG_OFF || msg_lev == GLP_MSG_ERR ||
+            msg_lev == GLP_MSG_ON  || msg_lev == GLP_MSG_ALL ||
+            msg_lev == GLP_MSG_DBG))
+         xerror("glp_concurrent: msg_lev = %d; invalid parameter\n",
+            msg_lev);
+      /* prepare working copies and control parameters */
+      for (t = 0; t < NSOLVERS; t++)
+      {  csa->lp[t] = glp_create_prob();
+         glp_copy_prob(csa->lp[t], P, GLP_OFF);
+         csa->smcp[t] = *smcp;
+         csa->smcp[t].msg_lev = GLP_MSG_OFF;
+         csa->lp[t]->stop = &csa->stop;
+         csa->ret[t] = GLP_ESTOP;
+         csa->time[t] = 0.0;
+      }
+      csa->smcp[PRIMAL].meth = GLP_PRIMAL;
+      csa->smcp[DUAL].meth = GLP_DUAL;
+      csa->iptcp = *iptcp;
+      csa->iptcp.msg_lev = GLP_MSG_OFF;
+      csa->stop = 0;
+      csa->winner = -1;
+      csa->lock = mutex_create();
+      if (msg_lev >= GLP_MSG_ALL)
+         xprintf("Concurrent optimizer: %s, %s, and %s\n",
+            name[PRIMAL], name[DUAL], name[INTERIOR]);
+      /* run the solvers; terminal output is suppressed, because the
+         solvers temporarily change this setting on their own */
+      term_out = env->term_out;
+      env->term_out = GLP_OFF;
+      thread_run(NSOLVERS, solve_func, csa);
+      env->term_out = term_out;
+      mutex_delete(csa->lock);
+      /* store the result */
+      t = csa->winner;
+      if (t < 0)
+      {  /* no conclusive result; use the primal simplex unless it has
+            been cancelled */
+         t = (csa->ret[PRIMAL] == GLP_ESTOP ? DUAL : PRIMAL);
+      }
+      if (t == INTERIOR)
+         copy_ipt(P, csa->lp[t]);
+      else
+         copy_sol(P, csa->lp[t]);
+      if (sol != NULL)
+         *sol = (t == INTERIOR ? GLP_IPT : GLP_SOL);
+      ret = csa->ret[t];
+      if (msg_lev >= GLP_MSG_ALL)
+      {  int k;
+         for (k = 0; k < NSOLVERS; k++)
+         {  xprintf("%-15s: %.1f secs; ", name[k], csa->time[k]);
+            if (csa->ret[k] == GLP_ESTOP)
+               xprintf("cancelled\n");
+            else if (is_conclusive(csa, k))
+               xprintf("finished\n");
+            else
+               xprintf("failed (ret = %d)\n", csa->ret[k]);
+         }
+      }
+      if (msg_lev >= GLP_MSG_ON)
+      {  if (csa->winner == INTERIOR)
+            xprintf("Concurrent optimizer: %s finished first; obj = %."
+               "9e\n", name[t], P->ipt_obj);
+         else if (csa->winner >= 0 && glp_get_status(P) == GLP_OPT)
+            xprintf("Concurrent optimizer: %s finished first; obj = %."
+               "9e\n", name[t], P->obj_val);
+         else if (csa->winner >= 0)
+            xprintf("Concurrent optimizer: %s finished first\n",
+               name[t]);
+         else
+            xprintf("Concurrent optimizer: no solver finished; using r"
+               "esult of %s\n", name[t]);
+      }
+      for (t = 0; t < NSOLVERS; t++)
+         glp_delete_prob(csa->lp[t]);
+      return ret;
+}
+
+/* eof */
@@ -130,6 +130,15 @@ struct glp_prob
 #endif
       BFD *bfd; /* BFD bfd[1:m,1:m]; */
       /* basis factorization driver; may be NULL */
+#if 1 /* 17/X-2026 */
+      void *spx_ws; /* SPXWS *spx_ws; */
+      /* simplex workspace kept across calls to the simplex solver;
+         may be NULL */
+      volatile int *stop;
+      /* pointer to cooperative stop flag; if the flag is set, the
+         simplex and interior-point solvers terminate (it is used by
+         the concurrent optimizer); NULL means no flag */
+#endif
       /*--------------------------------------------------------------*/
       /* basic solution (LP) */
       int pbs_stat;
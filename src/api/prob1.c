@@ -23,6 +23,9 @@
 
 #include "env.h"
 #include "ios.h"
+#if 1 /* 17/X-2026 */
+#include "spxlp.h"
+#endif
 
 /* CAUTION: DO NOT CHANGE THE LIMITS BELOW */
 
@@ -100,6 +103,10 @@ static void create_prob(glp_prob *lp)
       lp->bfcp = NULL;
 #endif
       lp->bfd = NULL;
+#if 1 /* 17/X-2026 */
+      lp->spx_ws = NULL;
+      lp->stop = NULL;
+#endif
       /* basic solution (LP) */
       lp->pbs_stat = lp->dbs_stat = GLP_UNDEF;
       lp->obj_val = 0.0;
@@ -922,6 +929,11 @@ void glp_set_mat_row(glp_prob *lp, int i, int len, const int ind[],
       {  xassert(tree->curr != NULL);
          xassert(row->level == tree->curr->level);
       }
+#if 1 /* 17/X-2026 */
+      /* pricing data saved by the simplex solver become invalid */
+      if (lp->spx_ws != NULL && i <= ((SPXWS *)lp->spx_ws)->se_m)
+         spx_ws_drop_se(lp->spx_ws);
+#endif
       /* remove all existing elements from i-th row */
       while (row->ptr != NULL)
       {  /* take next element in the row */
@@ -1046,6 +1058,11 @@ void glp_set_mat_col(glp_prob *lp, int j, int len, const int ind[],
          xerror("glp_set_mat_col: j = %d; column number out of range\n",
             j);
       col = lp->col[j];
+#if 1 /* 17/X-2026 */
+      /* pricing data saved by the simplex solver become invalid */
+      if (lp->spx_ws != NULL && j <= ((SPXWS *)lp->spx_ws)->se_n)
+         spx_ws_drop_se(lp->spx_ws);
+#endif
       /* remove all existing elements from j-th column */
       while (col->ptr != NULL)
       {  /* take next element in the column */
@@ -1164,6 +1181,11 @@ void glp_load_matrix(glp_prob *lp, int ne, const int ia[],
       int i, j, k;
       if (tree != NULL && tree->reason != 0)
          xerror("glp_load_matrix: operation not allowed\n");
+#if 1 /* 17/X-2026 */
+      /* pricing data saved by the simplex solver become invalid */
+      if (lp->spx_ws != NULL)
+         spx_ws_drop_se(lp->spx_ws);
+#endif
       /* clear the constraint matrix */
       for (i = 1; i <= lp->m; i++)
       {  row = lp->row[i];
@@ -1453,6 +1475,11 @@ void glp_del_rows(glp_prob *lp, int nrs, const int num[])
       if (!(1 <= nrs && nrs <= lp->m))
          xerror("glp_del_rows: nrs = %d; invalid number of rows\n",
             nrs);
+#if 1 /* 17/X-2026 */
+      /* pricing data saved by the simplex solver become invalid */
+      if (lp->spx_ws != NULL)
+         spx_ws_drop_se(lp->spx_ws);
+#endif
       for (k = 1; k <= nrs; k++)
       {  /* take the number of row to be deleted */
          i = num[k];
@@ -1540,6 +1567,11 @@ void glp_del_cols(glp_prob *lp, int ncs, const int num[])
       if (!(1 <= ncs && ncs <= lp->n))
          xerror("glp_del_cols: ncs = %d; invalid number of columns\n",
             ncs);
+#if 1 /* 17/X-2026 */
+      /* pricing data saved by the simplex solver become invalid */
+      if (lp->spx_ws != NULL)
+         spx_ws_drop_se(lp->spx_ws);
+#endif
 #ifdef CSL_MULTI_OBJECTIVE
       if( lp->cobj_num > 0)
          xerror("glp_del_cols: multiple objectives defined, cannot delete columns\n");
@@ -1789,6 +1821,9 @@ static void delete_prob(glp_prob *lp)
       if(lp->cobj_val != NULL) xfree(lp->cobj_val);
 #endif
       if (lp->bfd != NULL) bfd_delete_it(lp->bfd);
+#if 1 /* 17/X-2026 */
+      if (lp->spx_ws != NULL) spx_delete_ws(lp->spx_ws);
+#endif
       return;
 }
 
@@ -23,6 +23,9 @@
 
 #include "env.h"
 #include "prob.h"
+#if 1 /* 17/X-2026 */
+#include "spxlp.h"
+#endif
 
 /***********************************************************************
 *  NAME
@@ -54,6 +57,11 @@ void glp_set_rii(glp_prob *lp, int i, double rii)
             }
          }
       }
+#if 1 /* 17/X-2026 */
+      /* pricing data saved by the simplex solver become invalid */
+      if (lp->spx_ws != NULL && lp->row[i]->rii != rii)
+         spx_ws_drop_se(lp->spx_ws);
+#endif
       lp->row[i]->rii = rii;
       return;
 }
@@ -83,6 +91,11 @@ void glp_set_sjj(glp_prob *lp, int j, double sjj)
       {  /* invalidate the basis factorization */
          lp->valid = 0;
       }
+#if 1 /* 17/X-2026 */
+      /* pricing data saved by the simplex solver become invalid */
+      if (lp->spx_ws != NULL && lp->col[j]->sjj != sjj)
+         spx_ws_drop_se(lp->spx_ws);
+#endif
       lp->col[j]->sjj = sjj;
       return;
 }
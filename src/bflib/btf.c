@@ -250,6 +250,349 @@ void btf_build_a_rows(BTF *btf, int len[/*1+n*/])
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  btf_make_levels - determine level schedules for parallel solution
+*
+*  This routine partitions diagonal blocks of the BT-factorization into
+*  levels in such a way that all blocks of the same level can be
+*  processed independently by the routines btf_a_solve and btf_at_solve
+*  once all blocks of previous levels have been processed. Two level
+*  schedules are determined, one for each routine (see comments in the
+*  header file btf.h). Besides, the routine marks levels, which are
+*  large enough to be processed in parallel; if there are no such
+*  levels, the corresponding schedule is discarded.
+*
+*  The routine uses the row- as well as the column-wise representation
+*  of matrix A, so it should be called after btf_build_a_rows.
+*
+*  The working arrays lev and blk should have at least 1+n elements
+*  (lev[0] and blk[0] are not used). */
+
+static int sort_levels(int num, const int lev[], int dir, int lptr[],
+      int list[])
+{     /* store blocks level by level; blocks of the same level are
+       * stored in descending (dir < 0) or ascending (dir > 0) order of
+       * their numbers; returns the number of levels */
+      int k, l, nlev;
+      nlev = 0;
+      for (k = 1; k <= num; k++)
+      {  if (nlev < lev[k])
+            nlev = lev[k];
+      }
+      for (l = 1; l <= nlev+1; l++)
+         lptr[l] = 0;
+      for (k = 1; k <= num; k++)
+         lptr[lev[k]]++;
+      /* lptr[l] := 1 + (number of blocks in levels 1, ..., l) */
+      lptr[1]++;
+      for (l = 2; l <= nlev+1; l++)
+         lptr[l] += lptr[l-1];
+      /* fill the lists in reverse order, so lptr[l] becomes pointer to
+       * the first block of level l */
+      if (dir > 0)
+      {  for (k = num; k >= 1; k--)
+            list[--lptr[lev[k]]] = k;
+      }
+      else
+      {  for (k = 1; k <= num; k++)
+            list[--lptr[lev[k]]] = k;
+      }
+      return nlev;
+}
+
+#define PAR_MIN 1000
+/* minimal total order of non-trivial blocks of a level to process the
+ * level in parallel */
+
+static int mark_levels(BTF *btf, int nlev, const int lptr[],
+      const int list[], char lpar[])
+{     /* mark levels to be processed in parallel; level is processed in
+       * parallel if it contains at least two non-trivial blocks whose
+       * total order is not less than PAR_MIN; returns the number of
+       * levels marked */
+      int *beg = btf->beg;
+      int k, l, t, cnt, size, count;
+      count = 0;
+      for (l = 1; l <= nlev; l++)
+      {  cnt = size = 0;
+         for (t = lptr[l]; t < lptr[l+1]; t++)
+         {  k = list[t];
+            if (beg[k+1] - beg[k] > 1)
+               cnt++, size += beg[k+1] - beg[k];
+         }
+         lpar[l] = (char)(cnt >= 2 && size >= PAR_MIN);
+         if (lpar[l])
+            count++;
+      }
+      return count;
+}
+
+void btf_make_levels(BTF *btf, int lev[/*1+n*/], int blk[/*1+n*/])
+{     SVA *sva = btf->sva;
+      int *sv_ind = sva->ind;
+      int *pp_ind = btf->pp_ind;
+      int *pp_inv = btf->pp_inv;
+      int *qq_ind = btf->qq_ind;
+      int *qq_inv = btf->qq_inv;
+      int num = btf->num;
+      int *beg = btf->beg;
+      int *ar_ptr = &sva->ptr[btf->ar_ref-1];
+      int *ar_len = &sva->len[btf->ar_ref-1];
+      int *ac_ptr = &sva->ptr[btf->ac_ref-1];
+      int *ac_len = &sva->len[btf->ac_ref-1];
+      int i, ii, j, jj, k, l, ptr, end;
+      /* blk[ii] = number of diagonal block containing ii-th row and
+       * ii-th column of matrix A~ */
+      for (k = 1; k <= num; k++)
+      {  for (ii = beg[k]; ii < beg[k+1]; ii++)
+            blk[ii] = k;
+      }
+      /* solving A * x = b: block A~[k,k] depends on blocks A~[k',k'],
+       * k' > k, which are coupled with it by elements of rows of A
+       * corresponding to k-th block row of A~ */
+      for (k = num; k >= 1; k--)
+      {  l = 0;
+         for (ii = beg[k]; ii < beg[k+1]; ii++)
+         {  i = pp_inv[ii];
+            for (end = (ptr = ar_ptr[i]) + ar_len[i]; ptr < end; ptr++)
+            {  jj = qq_inv[sv_ind[ptr]];
+               xassert(blk[jj] > k);
+               if (l < lev[blk[jj]])
+                  l = lev[blk[jj]];
+            }
+         }
+         lev[k] = l + 1;
+      }
+      btf->a_nlev = sort_levels(num, lev, -1, btf->a_lptr,
+         btf->a_list);
+      if (mark_levels(btf, btf->a_nlev, btf->a_lptr, btf->a_list,
+            btf->a_lpar) == 0)
+         btf->a_nlev = 0;
+      /* solving A'* x = b: block A~[k,k] depends on blocks A~[k',k'],
+       * k' < k, which are coupled with it by elements of columns of A
+       * corresponding to k-th block column of A~ */
+      for (k = 1; k <= num; k++)
+      {  l = 0;
+         for (jj = beg[k]; jj < beg[k+1]; jj++)
+         {  j = qq_ind[jj];
+            for (end = (ptr = ac_ptr[j]) + ac_len[j]; ptr < end; ptr++)
+            {  ii = pp_ind[sv_ind[ptr]];
+               xassert(blk[ii] < k);
+               if (l < lev[blk[ii]])
+                  l = lev[blk[ii]];
+            }
+         }
+         lev[k] = l + 1;
+      }
+      btf->at_nlev = sort_levels(num, lev, +1, btf->at_lptr,
+         btf->at_list);
+      if (mark_levels(btf, btf->at_nlev, btf->at_lptr, btf->at_list,
+            btf->at_lpar) == 0)
+         btf->at_nlev = 0;
+      return;
+}
+#endif
+
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  Parallel solution
+*
+*  If btf->nt > 1, the routines btf_a_solve and btf_at_solve process
+*  diagonal blocks level by level (see the routine btf_make_levels).
+*  When all blocks of previous levels have been processed, right-hand
+*  sides B[k] of all blocks of the current level are known, so systems
+*  for these blocks can be solved independently of each other, in which
+*  case each block reads only its own components of b and writes only
+*  to its own components of x. Once the systems have been solved, their
+*  solutions are substituted into other equations sequentially, as in
+*  the sequential version; this keeps the sparsity of the right-hand
+*  side and avoids concurrent updates of b.
+*
+*  Blocks of a level are distributed among threads only if the level
+*  has been marked by the routine btf_make_levels; otherwise, the
+*  overhead of starting the threads would exceed the gain. Note that
+*  results of the parallel and the sequential versions may differ due
+*  to round-off errors, since the order, in which blocks are processed,
+*  is different. */
+
+static void solve_block(BTF *btf, int tr, int k, const double b[],
+      double x[], double bb[], double xx[])
+{     /* solve system A~[k,k] * X[k] = B[k] (tr = 0) or A~'[k,k] * X[k]
+       * = B[k] (tr = 1) */
+      int *beg = btf->beg;
+      int *ind1 = (tr ? btf->qq_ind : btf->pp_inv);
+      int *ind2 = (tr ? btf->pp_inv : btf->qq_ind);
+      LUF luf;
+      int i, beg_k, flag;
+      luf.n = beg[k+1] - (beg_k = beg[k]);
+      if (luf.n == 1)
+      {  /* trivial case */
+         x[ind2[beg_k]] = b[ind1[beg_k]] / btf->vr_piv[beg_k];
+         goto done;
+      }
+      /* construct B[k] */
+      flag = 0;
+      for (i = 1; i <= luf.n; i++)
+      {  if ((bb[i] = b[ind1[i + (beg_k-1)]]) != 0.0)
+            flag = 1;
+      }
+      if (!flag)
+      {  /* B[k] = 0, so X[k] = 0 */
+         for (i = 1; i <= luf.n; i++)
+            x[ind2[i + (beg_k-1)]] = 0.0;
+         goto done;
+      }
+      luf.sva = btf->sva;
+      luf.fr_ref = btf->fr_ref + (beg_k-1);
+      luf.fc_ref = btf->fc_ref + (beg_k-1);
+      luf.vr_ref = btf->vr_ref + (beg_k-1);
+      luf.vr_piv = btf->vr_piv + (beg_k-1);
+      luf.vc_ref = btf->vc_ref + (beg_k-1);
+      luf.pp_ind = btf->p1_ind + (beg_k-1);
+      luf.pp_inv = btf->p1_inv + (beg_k-1);
+      luf.qq_ind = btf->q1_ind + (beg_k-1);
+      luf.qq_inv = btf->q1_inv + (beg_k-1);
+      if (!tr)
+      {  luf_f_solve(&luf, bb);
+         luf_v_solve(&luf, bb, xx);
+      }
+      else
+      {  luf_vt_solve(&luf, bb, xx);
+         luf_ft_solve(&luf, xx);
+      }
+      /* store X[k] */
+      for (i = 1; i <= luf.n; i++)
+         x[ind2[i + (beg_k-1)]] = xx[i];
+done: return;
+}
+
+static void subst_block(BTF *btf, int tr, int k, double b[],
+      const double x[])
+{     /* substitute X[k] into other equations */
+      SVA *sva = btf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      int *beg = btf->beg;
+      int *ind2 = (tr ? btf->pp_inv : btf->qq_ind);
+      int ref = (tr ? btf->ar_ref : btf->ac_ref);
+      int *a_ptr = &sva->ptr[ref-1];
+      int *a_len = &sva->len[ref-1];
+      int j, jj, ptr, end;
+      double t;
+      for (jj = beg[k]; jj < beg[k+1]; jj++)
+      {  j = ind2[jj];
+         if ((t = x[j]) != 0.0)
+         {  for (end = (ptr = a_ptr[j]) + a_len[j]; ptr < end; ptr++)
+               b[sv_ind[ptr]] -= sv_val[ptr] * t;
+         }
+      }
+      return;
+}
+
+struct level
+{     /* blocks of a level processed in parallel */
+      BTF *btf;
+      int tr;
+      const double *b;
+      double *x;
+      const int *list;
+      /* list[1], ..., list[cnt] are numbers of blocks to be solved */
+      int cnt;
+      int next;
+      /* number of next block to be claimed by a thread */
+      void *lock;
+      /* mutex to serialize access to next */
+};
+
+static void level_func(void *info, int t)
+{     /* routine run by each thread */
+      struct level *lev = info;
+      BTF *btf = lev->btf;
+      int size = btf->n + 1;
+      double *bb = btf->work + (2*t) * size;
+      double *xx = btf->work + (2*t+1) * size;
+      int k;
+      xassert(0 <= t && t < btf->nt);
+      for (;;)
+      {  /* pull next block of the level */
+         mutex_lock(lev->lock);
+         k = lev->next++;
+         mutex_unlock(lev->lock);
+         if (k > lev->cnt)
+            break;
+         solve_block(btf, lev->tr, lev->list[k], lev->b, lev->x, bb,
+            xx);
+      }
+      return;
+}
+
+static void par_solve(BTF *btf, int tr, double b[], double x[],
+      double w1[], double w2[])
+{     /* solve system A * x = b (tr = 0) or A'* x = b (tr = 1) level by
+       * level */
+      int *beg = btf->beg;
+      int nlev = (tr ? btf->at_nlev : btf->a_nlev);
+      int *lptr = (tr ? btf->at_lptr : btf->a_lptr);
+      int *list = (tr ? btf->at_list : btf->a_list);
+      char *lpar = (tr ? btf->at_lpar : btf->a_lpar);
+      int *ind1 = (tr ? btf->qq_ind : btf->pp_inv);
+      int *ind2 = (tr ? btf->pp_inv : btf->qq_ind);
+      SVA *sva = btf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      int *a_ptr = &sva->ptr[(tr ? btf->ar_ref : btf->ac_ref)-1];
+      int *a_len = &sva->len[(tr ? btf->ar_ref : btf->ac_ref)-1];
+      struct level _lev, *lev = &_lev;
+      int k, l, t;
+      lev->btf = btf;
+      lev->tr = tr;
+      lev->b = b;
+      lev->x = x;
+      lev->lock = NULL;
+      for (l = 1; l <= nlev; l++)
+      {  if (lpar[l])
+         {  /* solve systems for blocks of l-th level in parallel */
+            if (lev->lock == NULL)
+               lev->lock = mutex_create();
+            lev->list = &list[lptr[l]-1];
+            lev->cnt = lptr[l+1] - lptr[l];
+            lev->next = 1;
+            thread_run(btf->nt < lev->cnt ? btf->nt : lev->cnt,
+               level_func, lev);
+            for (t = lptr[l]; t < lptr[l+1]; t++)
+               subst_block(btf, tr, list[t], b, x);
+         }
+         else
+         {  /* solve systems for blocks of l-th level sequentially */
+            for (t = lptr[l]; t < lptr[l+1]; t++)
+            {  k = list[t];
+               if (beg[k+1] - beg[k] == 1)
+               {  /* trivial case (handled here for efficiency) */
+                  int ptr, end;
+                  double temp;
+                  temp = x[ind2[beg[k]]] =
+                     b[ind1[beg[k]]] / btf->vr_piv[beg[k]];
+                  if (temp != 0.0)
+                  {  ptr = a_ptr[ind2[beg[k]]];
+                     end = ptr + a_len[ind2[beg[k]]];
+                     for (; ptr < end; ptr++)
+                        b[sv_ind[ptr]] -= sv_val[ptr] * temp;
+                  }
+               }
+               else
+               {  solve_block(btf, tr, k, b, x, w1, w2);
+                  subst_block(btf, tr, k, b, x);
+               }
+            }
+         }
+      }
+      if (lev->lock != NULL)
+         mutex_delete(lev->lock);
+      return;
+}
+#endif
+
 /***********************************************************************
 *  btf_a_solve - solve system A * x = b
 *
@@ -283,6 +626,12 @@ void btf_a_solve(BTF *btf, double b[/*1+n*/], double x[/*1+n*/],
       LUF luf;
       int i, j, jj, k, beg_k, flag;
       double t;
+#if 1 /* 17/X-2026 */
+      if (btf->nt > 1 && btf->a_nlev > 0)
+      {  par_solve(btf, 0, b, x, w1, w2);
+         return;
+      }
+#endif
       for (k = num; k >= 1; k--)
       {  /* determine order of diagonal block A~[k,k] */
          luf.n = beg[k+1] - (beg_k = beg[k]);
@@ -375,6 +724,12 @@ void btf_at_solve(BTF *btf, double b[/*1+n*/], double x[/*1+n*/],
       LUF luf;
       int i, j, jj, k, beg_k, flag;
       double t;
+#if 1 /* 17/X-2026 */
+      if (btf->nt > 1 && btf->at_nlev > 0)
+      {  par_solve(btf, 1, b, x, w1, w2);
+         return;
+      }
+#endif
       for (k = 1; k <= num; k++)
       {  /* determine order of diagonal block A~[k,k] */
          luf.n = beg[k+1] - (beg_k = beg[k]);
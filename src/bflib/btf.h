@@ -163,6 +163,38 @@ struct BTF
       int *q1_ind; /* int q1_ind[1+n]; */
       int *q1_inv; /* int q1_inv[1+n]; */
       /* permutation matrices P and Q for all diagonal blocks */
+#if 1 /* 17/X-2026 */
+      /*--------------------------------------------------------------*/
+      /* level schedules for solving systems in parallel */
+      int nt;
+      /* number of threads used by the routines btf_a_solve and
+       * btf_at_solve; if nt < 2, the routines process diagonal blocks
+       * sequentially, and level schedules are not used */
+      int a_nlev;
+      /* number of levels for solving system A * x = b */
+      int *a_lptr; /* int a_lptr[1+n+1]; */
+      int *a_list; /* int a_list[1+n]; */
+      /* diagonal blocks of level l, 1 <= l <= a_nlev, are blocks
+       * A~[k,k], where k = a_list[a_lptr[l]], ...,
+       * a_list[a_lptr[l+1]-1]; block A~[k,k] belongs to level l, if
+       * each block A~[k',k'], k' > k, such that A~[k,k'] != 0, belongs
+       * to one of levels 1, ..., l-1 (and l is the smallest such
+       * number), so all blocks of
+       * the same level can be processed independently; a_nlev = 0
+       * means that there is no level worth processing in parallel, in
+       * which case blocks are processed sequentially */
+      char *a_lpar; /* char a_lpar[1+n]; */
+      /* a_lpar[l] is set if level l is processed in parallel */
+      int at_nlev;
+      /* number of levels for solving system A'* x = b */
+      int *at_lptr; /* int at_lptr[1+n+1]; */
+      int *at_list; /* int at_list[1+n]; */
+      char *at_lpar; /* char at_lpar[1+n]; */
+      /* the same as above, however, block A~[k,k] depends on blocks
+       * A~[k',k'], k' < k, such that A~[k',k] != 0 */
+      double *work; /* double work[2*nt*(1+n)]; */
+      /* working arrays used by threads */
+#endif
 };
 
 #define btf_store_a_cols _glp_btf_store_a_cols
@@ -182,6 +214,12 @@ void btf_check_blocks(BTF *btf);
 void btf_build_a_rows(BTF *btf, int len[/*1+n*/]);
 /* build matrix A in row-wise format */
 
+#if 1 /* 17/X-2026 */
+#define btf_make_levels _glp_btf_make_levels
+void btf_make_levels(BTF *btf, int lev[/*1+n*/], int blk[/*1+n*/]);
+/* determine level schedules for parallel solution */
+#endif
+
 #define btf_a_solve _glp_btf_a_solve
 void btf_a_solve(BTF *btf, double b[/*1+n*/], double x[/*1+n*/],
       double w1[/*1+n*/], double w2[/*1+n*/]);
@@ -34,11 +34,20 @@ BTFINT *btfint_create(void)
       fi->btf = NULL;
       fi->sgf = NULL;
       fi->sva_n_max = fi->sva_size = 0;
+#if 1 /* 17/X-2026 */
+      fi->sva_slack = 0;
+#endif
       fi->delta_n0 = fi->delta_n = 0;
       fi->sgf_piv_tol = 0.10;
       fi->sgf_piv_lim = 4;
       fi->sgf_suhl = 1;
       fi->sgf_eps_tol = DBL_EPSILON;
+#if 1 /* 17/X-2026 */
+      fi->sgf_mkz_bnd = 0;
+#endif
+#if 1 /* 17/X-2026 */
+      fi->nt = 1;
+#endif
       return fi;
 }
 
@@ -207,6 +216,280 @@ static int factorize_block(BTFINT *fi, int k, int (*col)(void *info,
       return k;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  Parallel factorization
+*
+*  If fi->nt > 1, non-trivial diagonal blocks are factorized in several
+*  threads. Since SVA is not thread-safe, this is done in three steps.
+*  First, columns of matrix A are obtained sequentially (the callback
+*  routine is not assumed to be thread-safe), elements outside the
+*  diagonal blocks are stored in SVA as usual, and elements of the
+*  non-trivial diagonal blocks are stored in a temporary buffer. Then,
+*  the threads claim blocks one by one and factorize them using their
+*  private SVA and factorizer workspace. Finally, each thread copies
+*  the factors of its block from the private SVA to the common SVA;
+*  this is done under protection of a mutex. */
+
+struct par
+{     /* working area of parallel factorization */
+      BTFINT *fi;
+      int *d_ptr; /* int d_ptr[1+n+1]; */
+      /* elements of jj-th column of A~ which belong to the diagonal
+       * block containing this column are stored in locations d_ptr[jj],
+       * ..., d_ptr[jj+1]-1 of the arrays d_ind and d_val, where d_ind
+       * contains local row indices of the elements */
+      int *d_ind;
+      double *d_val;
+      int size;
+      /* maximal order of diagonal blocks */
+      int *list; /* int list[1+num]; */
+      /* list[1], ..., list[cnt] are numbers of non-trivial blocks */
+      int cnt;
+      int next;
+      /* number of next block to be claimed by a thread */
+      int fail;
+      /* set if factorization of some block failed */
+      void *lock;
+      /* mutex to serialize access to the fields above and to the
+       * common SVA */
+};
+
+struct blk
+{     /* information passed to the routine block_col */
+      struct par *par;
+      int beg_k;
+      /* number of first row/column of the block in A~ */
+};
+
+static int block_col(void *info, int j, int ind[], double val[])
+{     /* get j-th column of diagonal block */
+      struct blk *blk = info;
+      struct par *par = blk->par;
+      int jj = j + (blk->beg_k-1);
+      int ptr = par->d_ptr[jj];
+      int len = par->d_ptr[jj+1] - ptr;
+      memcpy(&ind[1], &par->d_ind[ptr], len * sizeof(int));
+      memcpy(&val[1], &par->d_val[ptr], len * sizeof(double));
+      return len;
+}
+
+static void copy_vecs(SVA *sva, int ref, SVA *src, int src_ref, int n)
+{     /* copy vectors src_ref, ..., src_ref+n-1 from SVA src to static
+       * part of SVA sva as vectors ref, ..., ref+n-1 */
+      int k, len;
+      for (k = 0; k < n; k++)
+      {  len = src->len[src_ref+k];
+         if (len == 0)
+            continue;
+         if (sva->r_ptr - sva->m_ptr < len)
+            sva_more_space(sva, len);
+         sva_reserve_cap(sva, ref+k, len);
+         memcpy(&sva->ind[sva->ptr[ref+k]],
+            &src->ind[src->ptr[src_ref+k]], len * sizeof(int));
+         memcpy(&sva->val[sva->ptr[ref+k]],
+            &src->val[src->ptr[src_ref+k]], len * sizeof(double));
+         sva->len[ref+k] = len;
+      }
+      return;
+}
+
+static void par_func(void *info, int t)
+{     /* routine run by each thread */
+      struct par *par = info;
+      BTFINT *fi = par->fi;
+      BTF *btf = fi->btf;
+      int size = par->size;
+      SVA *sva;
+      SGF _sgf, *sgf = &_sgf;
+      LUF luf;
+      struct blk blk;
+      int *ind;
+      double *val;
+      int k, t1, beg_k, ret;
+      xassert(t >= 0);
+      /* create private SVA and factorizer workspace */
+      sva = sva_create_area(4 * size, 10 * size);
+      memset(sgf, 0, sizeof(SGF));
+      sgf->rs_head = talloc(1+size, int);
+      sgf->rs_prev = talloc(1+size, int);
+      sgf->rs_next = talloc(1+size, int);
+      sgf->cs_head = talloc(1+size, int);
+      sgf->cs_prev = talloc(1+size, int);
+      sgf->cs_next = talloc(1+size, int);
+      sgf->vr_max = talloc(1+size, double);
+      sgf->flag = talloc(1+size, char);
+      sgf->work = talloc(1+size, double);
+      sgf->updat = 0;
+      sgf->piv_tol = fi->sgf_piv_tol;
+      sgf->piv_lim = fi->sgf_piv_lim;
+      sgf->suhl = fi->sgf_suhl;
+      sgf->eps_tol = fi->sgf_eps_tol;
+      sgf->mkz_bnd = fi->sgf_mkz_bnd;
+      sgf->luf = &luf;
+      ind = talloc(1+size, int);
+      val = talloc(1+size, double);
+      blk.par = par;
+      for (;;)
+      {  /* pull next block */
+         mutex_lock(par->lock);
+         t1 = par->next++;
+         mutex_unlock(par->lock);
+         if (t1 > par->cnt)
+            break;
+         k = par->list[t1];
+         /* initialize private SVA */
+         sva->n = 0;
+         sva->m_ptr = 1;
+         sva->r_ptr = sva->size + 1;
+         sva->head = sva->tail = 0;
+         /* construct LUF for LU-factorization of A~[k,k] */
+         luf.n = btf->beg[k+1] - (beg_k = btf->beg[k]);
+         luf.sva = sva;
+         luf.fr_ref = sva_alloc_vecs(sva, luf.n);
+         luf.fc_ref = sva_alloc_vecs(sva, luf.n);
+         luf.vr_ref = sva_alloc_vecs(sva, luf.n);
+         luf.vc_ref = sva_alloc_vecs(sva, luf.n);
+         luf.vr_piv = btf->vr_piv + (beg_k-1);
+         luf.pp_ind = btf->p1_ind + (beg_k-1);
+         luf.pp_inv = btf->p1_inv + (beg_k-1);
+         luf.qq_ind = btf->q1_ind + (beg_k-1);
+         luf.qq_inv = btf->q1_inv + (beg_k-1);
+         /* store A~[k,k] as initial matrix V and factorize it */
+         blk.beg_k = beg_k;
+         luf_store_v_cols(&luf, block_col, &blk, ind, val);
+         ret = sgf_factorize(sgf, 0 /* disable singleton phase */);
+         xassert(sva->m_ptr == 1);
+         /* copy factors of A~[k,k] to the common SVA */
+         mutex_lock(par->lock);
+         if (ret != 0)
+            par->fail = 1;
+         else
+         {  copy_vecs(fi->sva, btf->fr_ref + (beg_k-1), sva,
+               luf.fr_ref, luf.n);
+            copy_vecs(fi->sva, btf->fc_ref + (beg_k-1), sva,
+               luf.fc_ref, luf.n);
+            copy_vecs(fi->sva, btf->vr_ref + (beg_k-1), sva,
+               luf.vr_ref, luf.n);
+            copy_vecs(fi->sva, btf->vc_ref + (beg_k-1), sva,
+               luf.vc_ref, luf.n);
+         }
+         mutex_unlock(par->lock);
+      }
+      /* free working arrays */
+      sva_delete_area(sva);
+      tfree(sgf->rs_head);
+      tfree(sgf->rs_prev);
+      tfree(sgf->rs_next);
+      tfree(sgf->cs_head);
+      tfree(sgf->cs_prev);
+      tfree(sgf->cs_next);
+      tfree(sgf->vr_max);
+      tfree(sgf->flag);
+      tfree(sgf->work);
+      tfree(ind);
+      tfree(val);
+      return;
+}
+
+static int factorize_par(BTFINT *fi, int (*col)(void *info, int j,
+      int ind[], double val[]), void *info)
+{     /* compute LU-factorizations of diagonal blocks A~[k,k] in
+       * parallel and also store corresponding columns of matrix A
+       * except elements of all blocks A~[k,k] */
+      SVA *sva = fi->sva;
+      BTF *btf = fi->btf;
+      int n = btf->n;
+      int num = btf->num;
+      int *beg = btf->beg;
+      int *pp_ind = btf->pp_ind;
+      int *qq_ind = btf->qq_ind;
+      int *ac_ptr, *ac_len;
+      int *ind = (int *)fi->sgf->vr_max; /* working array */
+      double *val = fi->sgf->work; /* working array */
+      struct par _par, *par = &_par;
+      int i, ii, j, jj, k, t, len, cnt, nnz, d_max, beg_k;
+      par->fi = fi;
+      par->d_ptr = talloc(1+n+1, int);
+      d_max = n + 1;
+      par->d_ind = talloc(d_max, int);
+      par->d_val = talloc(d_max, double);
+      par->size = 0;
+      par->list = talloc(1+num, int);
+      par->cnt = 0;
+      nnz = 1;
+      for (k = 1; k <= num; k++)
+      {  beg_k = beg[k];
+         if (beg[k+1] - beg_k == 1)
+         {  /* trivial case (A~[k,k] has unity order) */
+            factorize_triv(fi, k, col, info);
+            par->d_ptr[beg_k] = nnz;
+            continue;
+         }
+         /* general case */
+         par->list[++(par->cnt)] = k;
+         if (par->size < beg[k+1] - beg_k)
+            par->size = beg[k+1] - beg_k;
+         for (jj = beg_k; jj < beg[k+1]; jj++)
+         {  /* jj-th column of A~ = j-th column of A */
+            j = qq_ind[jj];
+            len = col(info, j, ind, val);
+            /* move elements of diagonal block A~[k,k] to the buffer and
+             * other elements to the beginning of the column list */
+            par->d_ptr[jj] = nnz;
+            cnt = 0;
+            for (t = 1; t <= len; t++)
+            {  i = ind[t];
+               ii = pp_ind[i];
+               if (ii >= beg_k)
+               {  /* a~[ii,jj] = a[i,j] is in diagonal block A~[k,k] */
+                  if (nnz == d_max)
+                  {  d_max += d_max;
+                     par->d_ind = trealloc(par->d_ind, d_max, int);
+                     par->d_val = trealloc(par->d_val, d_max, double);
+                  }
+                  par->d_ind[nnz] = ii - (beg_k-1); /* local index */
+                  par->d_val[nnz] = val[t];
+                  nnz++;
+               }
+               else
+               {  cnt++;
+                  ind[cnt] = i;
+                  val[cnt] = val[t];
+               }
+            }
+            /* store j-th column of A (except elements of A~[k,k]) */
+            if (cnt > 0)
+            {  if (sva->r_ptr - sva->m_ptr < cnt)
+                  sva_more_space(sva, cnt);
+               sva_reserve_cap(sva, btf->ac_ref-1+j, cnt);
+               ac_ptr = &sva->ptr[btf->ac_ref-1];
+               ac_len = &sva->len[btf->ac_ref-1];
+               memcpy(&sva->ind[ac_ptr[j]], &ind[1], cnt * sizeof(int));
+               memcpy(&sva->val[ac_ptr[j]], &val[1],
+                  cnt * sizeof(double));
+               ac_len[j] = cnt;
+            }
+         }
+      }
+      par->d_ptr[n+1] = nnz;
+      /* factorize non-trivial diagonal blocks in parallel */
+      par->next = 1;
+      par->fail = 0;
+      if (par->cnt > 0)
+      {  par->lock = mutex_create();
+         thread_run(fi->nt < par->cnt ? fi->nt : par->cnt, par_func,
+            par);
+         mutex_delete(par->lock);
+      }
+      tfree(par->d_ptr);
+      tfree(par->d_ind);
+      tfree(par->d_val);
+      tfree(par->list);
+      return par->fail;
+}
+#endif
+
 int btfint_factorize(BTFINT *fi, int n, int (*col)(void *info, int j,
       int ind[], double val[]), void *info)
 {     /* compute BT-factorization of specified matrix A */
@@ -227,6 +510,9 @@ int btfint_factorize(BTFINT *fi, int n, int (*col)(void *info, int j,
             sva_size = 10 * n;
          sva = fi->sva = sva_create_area(sva_n_max, sva_size);
       }
+#if 1 /* 17/X-2026 */
+      sva->slack = fi->sva_slack;
+#endif
       /* allocate/reallocate underlying objects, if necessary */
       if (fi->n_max < n)
       {  int n_max = fi->n_max;
@@ -253,6 +539,14 @@ int btfint_factorize(BTFINT *fi, int n, int (*col)(void *info, int j,
             tfree(btf->p1_inv);
             tfree(btf->q1_ind);
             tfree(btf->q1_inv);
+#if 1 /* 17/X-2026 */
+            tfree(btf->a_lptr);
+            tfree(btf->a_list);
+            tfree(btf->a_lpar);
+            tfree(btf->at_lptr);
+            tfree(btf->at_list);
+            tfree(btf->at_lpar);
+#endif
          }
          btf->pp_ind = talloc(1+n_max, int);
          btf->pp_inv = talloc(1+n_max, int);
@@ -264,6 +558,14 @@ int btfint_factorize(BTFINT *fi, int n, int (*col)(void *info, int j,
          btf->p1_inv = talloc(1+n_max, int);
          btf->q1_ind = talloc(1+n_max, int);
          btf->q1_inv = talloc(1+n_max, int);
+#if 1 /* 17/X-2026 */
+         btf->a_lptr = talloc(1+n_max+1, int);
+         btf->a_list = talloc(1+n_max, int);
+         btf->a_lpar = talloc(1+n_max, char);
+         btf->at_lptr = talloc(1+n_max+1, int);
+         btf->at_list = talloc(1+n_max, int);
+         btf->at_lpar = talloc(1+n_max, char);
+#endif
          /* allocate/reallocate factorizer workspace (SGF) */
          /* (note that for SGF we could use the size of largest block
           * rather than n_max) */
@@ -341,9 +643,19 @@ int btfint_factorize(BTFINT *fi, int n, int (*col)(void *info, int j,
       sgf->piv_lim = fi->sgf_piv_lim;
       sgf->suhl = fi->sgf_suhl;
       sgf->eps_tol = fi->sgf_eps_tol;
+#if 1 /* 17/X-2026 */
+      sgf->mkz_bnd = fi->sgf_mkz_bnd;
+#endif
       /* compute LU-factorizations of diagonal blocks A~[k,k] and also
        * store corresponding columns of matrix A except elements of all
        * blocks A~[k,k] */
+#if 1 /* 17/X-2026 */
+      if (fi->nt > 1 && thread_avail())
+      {  if (factorize_par(fi, col, info) != 0)
+            return 2; /* factorization of some A~[k,k] failed */
+      }
+      else
+#endif
       for (k = 1; k <= btf->num; k++)
       {  if (btf->beg[k+1] - btf->beg[k] == 1)
          {  /* trivial case (A~[k,k] has unity order) */
@@ -362,6 +674,18 @@ int btfint_factorize(BTFINT *fi, int n, int (*col)(void *info, int j,
       btf_build_a_rows(fi->btf, fi->sgf->rs_head);
 #ifdef GLP_DEBUG
       sva_check_area(sva);
+#endif
+#if 1 /* 17/X-2026 */
+      /* prepare for solving systems in parallel, if required */
+      if (btf->work != NULL)
+      {  tfree(btf->work);
+         btf->work = NULL;
+      }
+      btf->nt = (thread_avail() ? fi->nt : 1);
+      if (btf->nt > 1)
+      {  btf_make_levels(btf, sgf->rs_head, sgf->rs_prev);
+         btf->work = talloc(2 * btf->nt * (1+n), double);
+      }
 #endif
       /* BT-factorization has been successfully computed */
       fi->valid = 1;
@@ -386,6 +710,16 @@ void btfint_delete(BTFINT *fi)
          tfree(btf->p1_inv);
          tfree(btf->q1_ind);
          tfree(btf->q1_inv);
+#if 1 /* 17/X-2026 */
+         tfree(btf->a_lptr);
+         tfree(btf->a_list);
+         tfree(btf->a_lpar);
+         tfree(btf->at_lptr);
+         tfree(btf->at_list);
+         tfree(btf->at_lpar);
+         if (btf->work != NULL)
+            tfree(btf->work);
+#endif
          tfree(btf);
       }
       if (sgf != NULL)
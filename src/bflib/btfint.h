@@ -45,6 +45,10 @@ struct BTFINT
       /* control parameters */
       int sva_n_max, sva_size;
       /* parameters passed to sva_create_area */
+#if 1 /* 17/X-2026 */
+      int sva_slack;
+      /* SVA growth strategy parameter (see sva->slack) */
+#endif
       int delta_n0, delta_n;
       /* if n_max = 0, set n_max = n + delta_n0
        * if n_max < n, set n_max = n + delta_n */
@@ -52,7 +56,15 @@ struct BTFINT
       int sgf_piv_lim;
       int sgf_suhl;
       double sgf_eps_tol;
+#if 1 /* 17/X-2026 */
+      int sgf_mkz_bnd;
+#endif
       /* factorizer control parameters */
+#if 1 /* 17/X-2026 */
+      int nt;
+      /* number of threads used to factorize diagonal blocks and to
+       * solve systems with the BT-factorization */
+#endif
 };
 
 #define btfint_create _glp_btfint_create
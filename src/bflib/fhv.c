@@ -241,6 +241,7 @@ int fhv_ft_update(FHV *fhv, int q, int aq_len, const int aq_ind[],
        * column-wise format */
       if (len > 0)
       {  if (vc_cap[q] < len)
+#if 0 /* 17/X-2026 */
          {  if (sva->r_ptr - sva->m_ptr < len)
             {  sva_more_space(sva, len);
                sv_ind = sva->ind;
@@ -248,6 +249,16 @@ int fhv_ft_update(FHV *fhv, int q, int aq_len, const int aq_ind[],
             }
             sva_enlarge_cap(sva, vc_ref-1+q, len, 0);
          }
+#else
+         {  int need = sva_slack_cap(sva, len, 0);
+            if (sva->r_ptr - sva->m_ptr < need)
+            {  sva_more_space(sva, need);
+               sv_ind = sva->ind;
+               sv_val = sva->val;
+            }
+            sva_enlarge_cap(sva, vc_ref-1+q, need, 0);
+         }
+#endif
          ptr = vc_ptr[q];
          memcpy(&sv_ind[ptr], &ind[1], len * sizeof(int));
          memcpy(&sv_val[ptr], &val[1], len * sizeof(double));
@@ -264,8 +275,10 @@ int fhv_ft_update(FHV *fhv, int q, int aq_len, const int aq_ind[],
          if (vr_cap[i] == vr_len[i])
          {  /* reserve extra locations in i-th row to reduce further
              * relocations of that row */
-#if 1 /* FIXME */
+#if 0 /* 17/X-2026 */
             int need = vr_len[i] + 5;
+#else
+            int need = sva_slack_cap(sva, vr_len[i], 5);
 #endif
             if (sva->r_ptr - sva->m_ptr < need)
             {  sva_more_space(sva, need);
@@ -455,8 +468,10 @@ int fhv_ft_update(FHV *fhv, int q, int aq_len, const int aq_ind[],
          if (vc_cap[j] == vc_len[j])
          {  /* reserve extra locations in j-th column to reduce further
              * relocations of that column */
-#if 1 /* FIXME */
+#if 0 /* 17/X-2026 */
             int need = vc_len[j] + 5;
+#else
+            int need = sva_slack_cap(sva, vc_len[j], 5);
 #endif
             if (sva->r_ptr - sva->m_ptr < need)
             {  sva_more_space(sva, need);
@@ -474,6 +489,7 @@ int fhv_ft_update(FHV *fhv, int q, int aq_len, const int aq_ind[],
       /* copy elements from working sparse vector to p-th row of matrix
        * V (this row is currently empty) */
       if (vr_cap[p] < len)
+#if 0 /* 17/X-2026 */
       {  if (sva->r_ptr - sva->m_ptr < len)
          {  sva_more_space(sva, len);
             sv_ind = sva->ind;
@@ -481,6 +497,16 @@ int fhv_ft_update(FHV *fhv, int q, int aq_len, const int aq_ind[],
          }
          sva_enlarge_cap(sva, vr_ref-1+p, len, 0);
       }
+#else
+      {  int need = sva_slack_cap(sva, len, 0);
+         if (sva->r_ptr - sva->m_ptr < need)
+         {  sva_more_space(sva, need);
+            sv_ind = sva->ind;
+            sv_val = sva->val;
+         }
+         sva_enlarge_cap(sva, vr_ref-1+p, need, 0);
+      }
+#endif
       ptr = vr_ptr[p];
       memcpy(&sv_ind[ptr], &ind[1], len * sizeof(int));
       memcpy(&sv_val[ptr], &val[1], len * sizeof(double));
@@ -583,4 +609,83 @@ void fhv_ht_solve(FHV *fhv, double x[/*1+n*/])
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  fhv_h_solve_s - solve system H * x = b (hypersparse version)
+*
+*  This routine is a hypersparse version of the routine fhv_h_solve.
+*
+*  On entry the locations ind[1], ..., ind[nnz] should contain indices
+*  of (all) non-zero elements of b, and the array x should contain the
+*  vector b in dense format. On exit the routine stores in the array
+*  locations ind[1], ..., ind[nnz'] indices of elements of the solution
+*  vector x, which may be non-zero, and returns nnz'. The array ind
+*  should have at least 1+n locations.
+*
+*  The array mark is a working array of at least 1+n locations, which
+*  should contain all zeros on entry; this status is retained on
+*  exit. */
+
+int fhv_h_solve_s(FHV *fhv, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], char mark[/*1+n*/])
+{     SVA *sva = fhv->luf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      int nfs = fhv->nfs;
+      int *hh_ind = fhv->hh_ind;
+      int hh_ref = fhv->hh_ref;
+      int *hh_ptr = &sva->ptr[hh_ref-1];
+      int *hh_len = &sva->len[hh_ref-1];
+      int i, k, end, ptr;
+      double x_i;
+      for (k = 1; k <= nnz; k++)
+         mark[ind[k]] = 1;
+      for (k = 1; k <= nfs; k++)
+      {  x_i = x[i = hh_ind[k]];
+         for (end = (ptr = hh_ptr[k]) + hh_len[k]; ptr < end; ptr++)
+            x_i -= sv_val[ptr] * x[sv_ind[ptr]];
+         x[i] = x_i;
+         if (x_i != 0.0 && !mark[i])
+            mark[i] = 1, ind[++nnz] = i;
+      }
+      for (k = 1; k <= nnz; k++)
+         mark[ind[k]] = 0;
+      return nnz;
+}
+
+/***********************************************************************
+*  fhv_ht_solve_s - solve system H' * x = b (hypersparse version)
+*
+*  This routine is a hypersparse version of the routine fhv_ht_solve.
+*  Its parameters are the same as for the routine fhv_h_solve_s. */
+
+int fhv_ht_solve_s(FHV *fhv, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], char mark[/*1+n*/])
+{     SVA *sva = fhv->luf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      int nfs = fhv->nfs;
+      int *hh_ind = fhv->hh_ind;
+      int hh_ref = fhv->hh_ref;
+      int *hh_ptr = &sva->ptr[hh_ref-1];
+      int *hh_len = &sva->len[hh_ref-1];
+      int j, k, end, ptr;
+      double x_j;
+      for (k = 1; k <= nnz; k++)
+         mark[ind[k]] = 1;
+      for (k = nfs; k >= 1; k--)
+      {  if ((x_j = x[hh_ind[k]]) == 0.0)
+            continue;
+         for (end = (ptr = hh_ptr[k]) + hh_len[k]; ptr < end; ptr++)
+         {  x[j = sv_ind[ptr]] -= sv_val[ptr] * x_j;
+            if (!mark[j])
+               mark[j] = 1, ind[++nnz] = j;
+         }
+      }
+      for (k = 1; k <= nnz; k++)
+         mark[ind[k]] = 0;
+      return nnz;
+}
+#endif
+
 /* eof */
@@ -109,6 +109,18 @@ void fhv_h_solve(FHV *fhv, double x[/*1+n*/]);
 void fhv_ht_solve(FHV *fhv, double x[/*1+n*/]);
 /* solve system H' * x = b */
 
+#if 1 /* 17/X-2026 */
+#define fhv_h_solve_s _glp_fhv_h_solve_s
+int fhv_h_solve_s(FHV *fhv, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], char mark[/*1+n*/]);
+/* solve system H * x = b (hypersparse version) */
+
+#define fhv_ht_solve_s _glp_fhv_ht_solve_s
+int fhv_ht_solve_s(FHV *fhv, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], char mark[/*1+n*/]);
+/* solve system H' * x = b (hypersparse version) */
+#endif
+
 #endif
 
 /* eof */
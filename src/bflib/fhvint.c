@@ -142,6 +142,125 @@ void fhvint_btran(FHVINT *fi, double x[])
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/* hypersparse solution is used only if the density of the right-hand
+ * side and the estimated density of the solution do not exceed this
+ * limit; otherwise, dense solution is faster */
+#define HYPER_DENS 0.10
+
+static void alloc_work(FHVINT *fi, int n)
+{     /* allocate working arrays used in hypersparse solution */
+      int w_max = fi->lufi->n_max;
+      xassert(w_max >= n);
+      if (fi->w_max < w_max)
+      {  if (fi->iwork != NULL)
+            tfree(fi->iwork);
+         if (fi->mark != NULL)
+            tfree(fi->mark);
+         if (fi->work != NULL)
+            tfree(fi->work);
+         fi->w_max = w_max;
+         fi->iwork = talloc(1+3*w_max, int);
+         fi->mark = talloc(1+w_max, char);
+         memset(fi->mark, 0, (1+w_max) * sizeof(char));
+         fi->work = talloc(1+w_max, double);
+         memset(fi->work, 0, (1+w_max) * sizeof(double));
+      }
+      return;
+}
+
+static int gather(int n, int ind[], double x[])
+{     /* store indices of non-zero elements of x in ind */
+      int j, nnz = 0;
+      for (j = n; j >= 1; j--)
+      {  if (x[j] != 0.0)
+            ind[++nnz] = j;
+      }
+      return nnz;
+}
+
+static int copy_sol(int nnz, int ind[], double x[], double work[])
+{     /* copy non-zero elements work[ind[k]] to x and clear work */
+      int j, k, cnt = 0;
+      for (k = 1; k <= nnz; k++)
+      {  j = ind[k];
+         if (work[j] != 0.0)
+         {  x[j] = work[j];
+            work[j] = 0.0;
+            ind[++cnt] = j;
+         }
+      }
+      return cnt;
+}
+
+int fhvint_ftran_s(FHVINT *fi, int nnz, int ind[], double x[])
+{     /* solve system A * x = b (sparse version) */
+      /* on entry ind[1], ..., ind[nnz] are indices of non-zero
+       * elements of b; on exit ind[1], ..., ind[nnz'] are indices of
+       * non-zero elements of x, and nnz' is returned */
+      FHV *fhv = &fi->fhv;
+      LUF *luf = fhv->luf;
+      int n = luf->n;
+      int *pp_ind = luf->pp_ind;
+      int *pp_inv = luf->pp_inv;
+      xassert(fi->valid);
+      xassert(0 <= nnz && nnz <= n);
+      if (nnz > HYPER_DENS * n || fi->ft_dens > HYPER_DENS)
+      {  /* dense solution */
+         fhvint_ftran(fi, x);
+         nnz = gather(n, ind, x);
+         goto done;
+      }
+      alloc_work(fi, n);
+      /* A = F * H * V */
+      /* x = inv(A) * b = inv(V) * inv(H) * inv(F) * b */
+      luf->pp_ind = fhv->p0_ind;
+      luf->pp_inv = fhv->p0_inv;
+      nnz = luf_f_solve_s(luf, nnz, ind, x, fi->iwork, fi->mark);
+      luf->pp_ind = pp_ind;
+      luf->pp_inv = pp_inv;
+      nnz = fhv_h_solve_s(fhv, nnz, ind, x, fi->mark);
+      nnz = luf_v_solve_s(luf, nnz, ind, x, fi->work, fi->iwork,
+         fi->mark);
+      nnz = copy_sol(nnz, ind, x, fi->work);
+done: fi->ft_dens = 0.5 * (fi->ft_dens + (double)nnz / (double)n);
+      return nnz;
+}
+
+int fhvint_btran_s(FHVINT *fi, int nnz, int ind[], double x[])
+{     /* solve system A'* x = b (sparse version) */
+      /* (see comments to fhvint_ftran_s) */
+      FHV *fhv = &fi->fhv;
+      LUF *luf = fhv->luf;
+      int n = luf->n;
+      int *pp_ind = luf->pp_ind;
+      int *pp_inv = luf->pp_inv;
+      xassert(fi->valid);
+      xassert(0 <= nnz && nnz <= n);
+      if (nnz > HYPER_DENS * n || fi->bt_dens > HYPER_DENS)
+      {  /* dense solution */
+         fhvint_btran(fi, x);
+         nnz = gather(n, ind, x);
+         goto done;
+      }
+      alloc_work(fi, n);
+      /* A' = (F * H * V)' = V'* H'* F' */
+      /* x = inv(A') * b = inv(F') * inv(H') * inv(V') * b */
+      nnz = luf_vt_solve_s(luf, nnz, ind, x, fi->work, fi->iwork,
+         fi->mark);
+      nnz = fhv_ht_solve_s(fhv, nnz, ind, fi->work, fi->mark);
+      luf->pp_ind = fhv->p0_ind;
+      luf->pp_inv = fhv->p0_inv;
+      nnz = luf_ft_solve_s(luf, nnz, ind, fi->work, fi->iwork,
+         fi->mark);
+      luf->pp_ind = pp_ind;
+      luf->pp_inv = pp_inv;
+      nnz = copy_sol(nnz, ind, x, fi->work);
+done: fi->bt_dens = 0.5 * (fi->bt_dens + (double)nnz / (double)n);
+      return nnz;
+}
+#endif
+
 double fhvint_estimate(FHVINT *fi)
 {     /* estimate 1-norm of inv(A) */
       double norm;
@@ -161,6 +280,14 @@ void fhvint_delete(FHVINT *fi)
          tfree(fi->fhv.p0_ind);
       if (fi->fhv.p0_inv != NULL)
          tfree(fi->fhv.p0_inv);
+#if 1 /* 17/X-2026 */
+      if (fi->iwork != NULL)
+         tfree(fi->iwork);
+      if (fi->mark != NULL)
+         tfree(fi->mark);
+      if (fi->work != NULL)
+         tfree(fi->work);
+#endif
       tfree(fi);
       return;
 }
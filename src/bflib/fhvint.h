@@ -41,6 +41,21 @@ struct FHVINT
       /* control parameters */
       int nfs_max;
       /* required maximal number of row-like factors */
+#if 1 /* 17/X-2026 */
+      /*--------------------------------------------------------------*/
+      /* hypersparse solution */
+      double ft_dens, bt_dens;
+      /* estimated density of solution vectors computed by FTRAN and
+       * BTRAN, respectively, used to choose between dense and
+       * hypersparse solution */
+      int w_max;
+      /* number of elements allocated in working arrays below */
+      int *iwork; /* int iwork[1+3*w_max]; */
+      char *mark; /* char mark[1+w_max]; */
+      double *work; /* double work[1+w_max]; */
+      /* working arrays; between calls all elements of the arrays mark
+       * and work are zero */
+#endif
 };
 
 #define fhvint_create _glp_fhvint_create
@@ -65,6 +80,16 @@ void fhvint_ftran(FHVINT *fi, double x[]);
 void fhvint_btran(FHVINT *fi, double x[]);
 /* solve system A'* x = b */
 
+#if 1 /* 17/X-2026 */
+#define fhvint_ftran_s _glp_fhvint_ftran_s
+int fhvint_ftran_s(FHVINT *fi, int nnz, int ind[], double x[]);
+/* solve system A * x = b (sparse version) */
+
+#define fhvint_btran_s _glp_fhvint_btran_s
+int fhvint_btran_s(FHVINT *fi, int nnz, int ind[], double x[]);
+/* solve system A'* x = b (sparse version) */
+#endif
+
 #define fhvint_estimate _glp_fhvint_estimate
 double fhvint_estimate(FHVINT *fi);
 /* estimate 1-norm of inv(A) */
@@ -658,6 +658,275 @@ void luf_vt_solve1(LUF *luf, double e[/*1+n*/], double y[/*1+n*/])
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  Hypersparse solution
+*
+*  If the right-hand side vector b has only a few non-zero elements,
+*  the solution vector x may be very sparse, too, in which case the
+*  routines below are much faster than their dense counterparts, since
+*  they only touch those elements of x, which may be non-zero.
+*
+*  The set of such elements is determined symbolically with a depth-
+*  first search on the graph of the corresponding factor, starting from
+*  the non-zero elements of b. The elements found are then processed in
+*  the same order as the dense routines do, so the results are exactly
+*  the same.
+*
+*  On entry the locations ind[1], ..., ind[nnz] should contain indices
+*  of (all) non-zero elements of b, and the array x (or b) should
+*  contain the vector b in dense format. On exit the routines store in
+*  the array locations ind[1], ..., ind[nnz'] indices of elements of
+*  the solution vector x, which may be non-zero, and return nnz'. The
+*  array ind should have at least 1+n locations.
+*
+*  The array iwork is a working array of at least 1+3*n locations. The
+*  array mark is a working array of at least 1+n locations, which
+*  should contain all zeros on entry; this status is retained on
+*  exit. */
+
+static int reach(int n, const int ptr[], const int len[],
+      const int sv_ind[], const int map1[], const int map2[], int nnz,
+      const int ind[], int iwork[], char mark[])
+{     /* determine the set of nodes reachable from nodes ind[1], ...,
+       * ind[nnz]; node v has arcs to nodes sv_ind[ptr[w]], ...,
+       * sv_ind[ptr[w]+len[w]-1], where w = v if map1 is NULL, and
+       * w = map2[map1[v]] otherwise; on exit the nodes found are
+       * marked and stored in locations list[1], ..., list[cnt], where
+       * list = iwork, and cnt is returned */
+      int *list = iwork;
+      int *stack = iwork + n;
+      int *pos = iwork + n + n;
+      int k, s, v, w, cnt, p, end;
+      cnt = 0;
+      for (k = 1; k <= nnz; k++)
+      {  v = ind[k];
+         if (mark[v])
+            continue;
+         /* depth-first search starting from node v */
+         mark[v] = 1;
+         s = 1, stack[1] = v;
+         w = (map1 == NULL ? v : map2[map1[v]]);
+         pos[1] = ptr[w];
+         while (s > 0)
+         {  v = stack[s];
+            w = (map1 == NULL ? v : map2[map1[v]]);
+            end = ptr[w] + len[w];
+            /* find next unmarked successor of node v */
+            for (p = pos[s]; p < end; p++)
+            {  if (!mark[sv_ind[p]])
+                  break;
+            }
+            if (p < end)
+            {  /* go down to the successor */
+               pos[s] = p+1;
+               v = sv_ind[p];
+               mark[v] = 1;
+               s++, stack[s] = v;
+               w = (map1 == NULL ? v : map2[map1[v]]);
+               pos[s] = ptr[w];
+            }
+            else
+            {  /* all successors of node v have been visited */
+               s--;
+               list[++cnt] = v;
+            }
+         }
+      }
+      return cnt;
+}
+
+static int fcmp(const void *p1, const void *p2)
+{     /* compare two integers */
+      int k1 = *(const int *)p1, k2 = *(const int *)p2;
+      return k1 < k2 ? -1 : k1 > k2 ? +1 : 0;
+}
+
+static void sort(int n, int cnt, int list[], const int key[],
+      const int inv[], int dir, const char mark[])
+{     /* sort marked nodes list[1], ..., list[cnt] in ascending (dir >
+       * 0) or descending (dir < 0) order of their keys key[v], where
+       * v = inv[key[v]] */
+      int k, t, tmp;
+      if (cnt > n / 16)
+      {  /* it is cheaper to scan all nodes */
+         cnt = 0;
+         for (k = 1; k <= n; k++)
+         {  if (mark[inv[k]])
+               list[++cnt] = inv[k];
+         }
+      }
+      else
+      {  for (t = 1; t <= cnt; t++)
+            list[t] = key[list[t]];
+         qsort(&list[1], cnt, sizeof(int), fcmp);
+         for (t = 1; t <= cnt; t++)
+            list[t] = inv[list[t]];
+      }
+      if (dir < 0)
+      {  for (t = 1, k = cnt; t < k; t++, k--)
+            tmp = list[t], list[t] = list[k], list[k] = tmp;
+      }
+      return;
+}
+
+/***********************************************************************
+*  luf_f_solve_s - solve system F * x = b (hypersparse version)
+*
+*  This routine is a hypersparse version of the routine luf_f_solve
+*  (see comments above). */
+
+int luf_f_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], int iwork[/*1+3*n*/], char mark[/*1+n*/])
+{     int n = luf->n;
+      SVA *sva = luf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      int fc_ref = luf->fc_ref;
+      int *fc_ptr = &sva->ptr[fc_ref-1];
+      int *fc_len = &sva->len[fc_ref-1];
+      int *list = iwork;
+      int j, t, cnt, ptr, end;
+      double x_j;
+      cnt = reach(n, fc_ptr, fc_len, sv_ind, NULL, NULL, nnz, ind,
+         iwork, mark);
+      sort(n, cnt, list, luf->pp_ind, luf->pp_inv, +1, mark);
+      for (t = 1; t <= cnt; t++)
+      {  j = list[t];
+         mark[j] = 0;
+         ind[t] = j;
+         if ((x_j = x[j]) != 0.0)
+         {  for (end = (ptr = fc_ptr[j]) + fc_len[j]; ptr < end; ptr++)
+               x[sv_ind[ptr]] -= sv_val[ptr] * x_j;
+         }
+      }
+      return cnt;
+}
+
+/***********************************************************************
+*  luf_ft_solve_s - solve system F' * x = b (hypersparse version)
+*
+*  This routine is a hypersparse version of the routine luf_ft_solve
+*  (see comments above). */
+
+int luf_ft_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], int iwork[/*1+3*n*/], char mark[/*1+n*/])
+{     int n = luf->n;
+      SVA *sva = luf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      int fr_ref = luf->fr_ref;
+      int *fr_ptr = &sva->ptr[fr_ref-1];
+      int *fr_len = &sva->len[fr_ref-1];
+      int *list = iwork;
+      int i, t, cnt, ptr, end;
+      double x_i;
+      cnt = reach(n, fr_ptr, fr_len, sv_ind, NULL, NULL, nnz, ind,
+         iwork, mark);
+      sort(n, cnt, list, luf->pp_ind, luf->pp_inv, -1, mark);
+      for (t = 1; t <= cnt; t++)
+      {  i = list[t];
+         mark[i] = 0;
+         ind[t] = i;
+         if ((x_i = x[i]) != 0.0)
+         {  for (end = (ptr = fr_ptr[i]) + fr_len[i]; ptr < end; ptr++)
+               x[sv_ind[ptr]] -= sv_val[ptr] * x_i;
+         }
+      }
+      return cnt;
+}
+
+/***********************************************************************
+*  luf_v_solve_s - solve system V * x = b (hypersparse version)
+*
+*  This routine is a hypersparse version of the routine luf_v_solve
+*  (see comments above). On entry the array x should contain zeros
+*  (at least in locations, which may be non-zero on exit). On exit all
+*  elements of the array b are zero. */
+
+int luf_v_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double b[/*1+n*/], double x[/*1+n*/], int iwork[/*1+3*n*/],
+      char mark[/*1+n*/])
+{     int n = luf->n;
+      SVA *sva = luf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      double *vr_piv = luf->vr_piv;
+      int vc_ref = luf->vc_ref;
+      int *vc_ptr = &sva->ptr[vc_ref-1];
+      int *vc_len = &sva->len[vc_ref-1];
+      int *pp_ind = luf->pp_ind;
+      int *pp_inv = luf->pp_inv;
+      int *qq_ind = luf->qq_ind;
+      int *list = iwork;
+      int i, j, t, cnt, ptr, end;
+      double x_j;
+      /* i-th row of V corresponds to j-th column of V, where
+       * j = qq_ind[pp_ind[i]] */
+      cnt = reach(n, vc_ptr, vc_len, sv_ind, pp_ind, qq_ind, nnz, ind,
+         iwork, mark);
+      sort(n, cnt, list, pp_ind, pp_inv, -1, mark);
+      for (t = 1; t <= cnt; t++)
+      {  i = list[t];
+         mark[i] = 0;
+         j = qq_ind[pp_ind[i]];
+         ind[t] = j;
+         x_j = x[j] = b[i] / vr_piv[i];
+         b[i] = 0.0;
+         if (x_j != 0.0)
+         {  for (end = (ptr = vc_ptr[j]) + vc_len[j]; ptr < end; ptr++)
+               b[sv_ind[ptr]] -= sv_val[ptr] * x_j;
+         }
+      }
+      return cnt;
+}
+
+/***********************************************************************
+*  luf_vt_solve_s - solve system V' * x = b (hypersparse version)
+*
+*  This routine is a hypersparse version of the routine luf_vt_solve
+*  (see comments above). On entry the array x should contain zeros
+*  (at least in locations, which may be non-zero on exit). On exit all
+*  elements of the array b are zero. */
+
+int luf_vt_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double b[/*1+n*/], double x[/*1+n*/], int iwork[/*1+3*n*/],
+      char mark[/*1+n*/])
+{     int n = luf->n;
+      SVA *sva = luf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      double *vr_piv = luf->vr_piv;
+      int vr_ref = luf->vr_ref;
+      int *vr_ptr = &sva->ptr[vr_ref-1];
+      int *vr_len = &sva->len[vr_ref-1];
+      int *pp_inv = luf->pp_inv;
+      int *qq_ind = luf->qq_ind;
+      int *qq_inv = luf->qq_inv;
+      int *list = iwork;
+      int i, j, t, cnt, ptr, end;
+      double x_i;
+      /* j-th column of V corresponds to i-th row of V, where
+       * i = pp_inv[qq_inv[j]] */
+      cnt = reach(n, vr_ptr, vr_len, sv_ind, qq_inv, pp_inv, nnz, ind,
+         iwork, mark);
+      sort(n, cnt, list, qq_inv, qq_ind, +1, mark);
+      for (t = 1; t <= cnt; t++)
+      {  j = list[t];
+         mark[j] = 0;
+         i = pp_inv[qq_inv[j]];
+         ind[t] = i;
+         x_i = x[i] = b[j] / vr_piv[i];
+         b[j] = 0.0;
+         if (x_i != 0.0)
+         {  for (end = (ptr = vr_ptr[i]) + vr_len[i]; ptr < end; ptr++)
+               b[sv_ind[ptr]] -= sv_val[ptr] * x_i;
+         }
+      }
+      return cnt;
+}
+#endif
+
 /***********************************************************************
 *  luf_estimate_norm - estimate 1-norm of inv(A)
 *
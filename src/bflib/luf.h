@@ -217,6 +217,30 @@ void luf_vt_solve(LUF *luf, double b[/*1+n*/], double x[/*1+n*/]);
 void luf_vt_solve1(LUF *luf, double e[/*1+n*/], double y[/*1+n*/]);
 /* solve system V' * y = e' to cause growth in y */
 
+#if 1 /* 17/X-2026 */
+#define luf_f_solve_s _glp_luf_f_solve_s
+int luf_f_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], int iwork[/*1+3*n*/], char mark[/*1+n*/]);
+/* solve system F * x = b (hypersparse version) */
+
+#define luf_ft_solve_s _glp_luf_ft_solve_s
+int luf_ft_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double x[/*1+n*/], int iwork[/*1+3*n*/], char mark[/*1+n*/]);
+/* solve system F' * x = b (hypersparse version) */
+
+#define luf_v_solve_s _glp_luf_v_solve_s
+int luf_v_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double b[/*1+n*/], double x[/*1+n*/], int iwork[/*1+3*n*/],
+      char mark[/*1+n*/]);
+/* solve system V * x = b (hypersparse version) */
+
+#define luf_vt_solve_s _glp_luf_vt_solve_s
+int luf_vt_solve_s(LUF *luf, int nnz, int ind[/*1+n*/],
+      double b[/*1+n*/], double x[/*1+n*/], int iwork[/*1+3*n*/],
+      char mark[/*1+n*/]);
+/* solve system V' * x = b (hypersparse version) */
+#endif
+
 #define luf_estimate_norm _glp_luf_estimate_norm
 double luf_estimate_norm(LUF *luf, double w1[/*1+n*/], double
       w2[/*1+n*/]);
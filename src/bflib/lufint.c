@@ -34,12 +34,18 @@ LUFINT *lufint_create(void)
       fi->luf = NULL;
       fi->sgf = NULL;
       fi->sva_n_max = fi->sva_size = 0;
+#if 1 /* 17/X-2026 */
+      fi->sva_slack = 0;
+#endif
       fi->delta_n0 = fi->delta_n = 0;
       fi->sgf_updat = 0;
       fi->sgf_piv_tol = 0.10;
       fi->sgf_piv_lim = 4;
       fi->sgf_suhl = 1;
       fi->sgf_eps_tol = DBL_EPSILON;
+#if 1 /* 17/X-2026 */
+      fi->sgf_mkz_bnd = 0;
+#endif
       return fi;
 }
 
@@ -63,6 +69,9 @@ int lufint_factorize(LUFINT *fi, int n, int (*col)(void *info, int j,
             sva_size = 10 * n;
          sva = fi->sva = sva_create_area(sva_n_max, sva_size);
       }
+#if 1 /* 17/X-2026 */
+      sva->slack = fi->sva_slack;
+#endif
       /* allocate/reallocate underlying objects, if necessary */
       if (fi->n_max < n)
       {  int n_max = fi->n_max;
@@ -141,6 +150,9 @@ int lufint_factorize(LUFINT *fi, int n, int (*col)(void *info, int j,
       sgf->piv_lim = fi->sgf_piv_lim;
       sgf->suhl = fi->sgf_suhl;
       sgf->eps_tol = fi->sgf_eps_tol;
+#if 1 /* 17/X-2026 */
+      sgf->mkz_bnd = fi->sgf_mkz_bnd;
+#endif
       /* compute LU-factorization of specified matrix A */
       k = sgf_factorize(sgf, 1);
       if (k == 0)
@@ -23,6 +23,9 @@
 
 #include "env.h"
 #include "sgf.h"
+#if 1 /* 17/X-2026 */
+#include "vscan.h"
+#endif
 
 /***********************************************************************
 *  sgf_reduce_nuc - initial reordering to minimize nucleus size
@@ -408,6 +411,258 @@ int sgf_singl_phase(LUF *luf, int k1, int k2, int updat,
       return k2;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  choose_bnd - choose pivot element v[p,q] (bounded search)
+*
+*  This routine is an alternative to the routine sgf_choose_pivot (see
+*  comments below). It walks through the same sets R[len] and C[len]
+*  in the same order and applies the same stability condition, however,
+*  the search is bounded by Markowitz cost of the best pivot candidate
+*  found so far as follows.
+*
+*  1. Once all rows and columns having len non-zeros have been scanned,
+*     any element of the active submatrix, which has not been considered
+*     yet, is placed in row and column having at least len+1 non-zeros,
+*     so its Markowitz cost is not less than len**2. Therefore, if the
+*     best candidate is not more expensive, the search is terminated.
+*     Note that if the number of pivot candidates is less than piv_lim,
+*     the routine sgf_choose_pivot scans all the sets up to R[n] and
+*     C[n], most of which are empty.
+*
+*  2. On scanning a row (column) having len non-zeros, elements placed
+*     in columns (rows) having cnt >= lim non-zeros are skipped, where
+*     lim is the smallest cnt, for which (len-1) * (cnt-1) >= best.
+*
+*  3. On scanning a column the routine considers its elements in order
+*     of increasing lengths of rows they are placed in, so the stability
+*     condition, which requires locating the element in its row and, if
+*     the row has been changed, computing the largest magnitude in that
+*     row, is checked only for elements in shortest rows. (The routine
+*     sgf_choose_pivot checks it for each element that is in a shorter
+*     row than the current candidate, starting from the first element,
+*     which may be placed in a long, dense row.)
+*
+*  Due to the item 3 the candidate chosen in a column is always the
+*  element placed in a shortest row among the elements satisfying the
+*  stability condition, so this routine may choose a different pivot
+*  element than the routine sgf_choose_pivot. */
+
+static double row_max(SGF *sgf, int i)
+{     /* determine largest magnitude of elements in i-th row */
+      LUF *luf = sgf->luf;
+      SVA *sva = luf->sva;
+      double *sv_val = sva->val;
+      int vr_ref = luf->vr_ref;
+      int *vr_ptr = &sva->ptr[vr_ref-1];
+      int *vr_len = &sva->len[vr_ref-1];
+      double *vr_max = sgf->vr_max;
+      int i_ptr, i_end;
+      double big, temp;
+      if ((big = vr_max[i]) < 0.0)
+      {  /* largest magnitude is unknown; compute it */
+         for (i_end = (i_ptr = vr_ptr[i]) + vr_len[i];
+            i_ptr < i_end; i_ptr++)
+         {  if ((temp = sv_val[i_ptr]) < 0.0)
+               temp = -temp;
+            if (big < temp)
+               big = temp;
+         }
+         xassert(big > 0.0);
+         vr_max[i] = big;
+      }
+      return big;
+}
+
+static int cost_lim(double best, int len)
+{     /* determine the smallest cnt, for which Markowitz cost of an
+       * element in row (column) having len non-zeros and column (row)
+       * having cnt non-zeros is not less than best */
+      double temp;
+      if (best == DBL_MAX)
+         return INT_MAX;
+      temp = ceil(best / (double)(len - 1)) + 1.0;
+      return temp >= (double)INT_MAX ? INT_MAX : (int)temp;
+}
+
+static int choose_bnd(SGF *sgf, int *p_, int *q_)
+{     LUF *luf = sgf->luf;
+      int n = luf->n;
+      SVA *sva = luf->sva;
+      int *sv_ind = sva->ind;
+      double *sv_val = sva->val;
+      int vr_ref = luf->vr_ref;
+      int *vr_ptr = &sva->ptr[vr_ref-1];
+      int *vr_len = &sva->len[vr_ref-1];
+      int vc_ref = luf->vc_ref;
+      int *vc_ptr = &sva->ptr[vc_ref-1];
+      int *vc_len = &sva->len[vc_ref-1];
+      int *rs_head = sgf->rs_head;
+      int *rs_next = sgf->rs_next;
+      int *cs_head = sgf->cs_head;
+      int *cs_prev = sgf->cs_prev;
+      int *cs_next = sgf->cs_next;
+      double piv_tol = sgf->piv_tol;
+      int piv_lim = sgf->piv_lim;
+      int suhl = sgf->suhl;
+      int cnt, i, i_ptr, i_end, j, j_ptr, j_end, len, lim, min_i, min_j,
+         min_len, ncand, next_j, p, q, skip;
+      double best, big, cost, temp;
+      /* no pivot candidate has been chosen so far */
+      p = q = 0, best = DBL_MAX, ncand = 0;
+      /* choose column singleton, if any */
+      j = cs_head[1];
+      if (j != 0)
+      {  xassert(vc_len[j] == 1);
+         p = sv_ind[vc_ptr[j]], q = j;
+         goto done;
+      }
+      /* choose row singleton, if any */
+      i = rs_head[1];
+      if (i != 0)
+      {  xassert(vr_len[i] == 1);
+         p = i, q = sv_ind[vr_ptr[i]];
+         goto done;
+      }
+      /* walk thru other non-empty rows and columns */
+      for (len = 2; len <= n; len++)
+      {  /* no element not considered yet can be cheaper than
+          * (len-1)**2 (see item 1 above) */
+         if (best <= (double)(len - 1) * (double)(len - 1))
+            goto done;
+         /* determine lim (see item 2 above) */
+         lim = cost_lim(best, len);
+         /* consider active columns containing len non-zeros */
+         for (j = cs_head[len]; j != 0; j = next_j)
+         {  /* save the number of next column of the same length */
+            next_j = cs_next[j];
+            /* find an element in j-th column, which is placed in the
+             * shortest row and satisfies to the stability condition;
+             * rows having cnt non-zeros, cnt <= min_len, have been
+             * checked and do not contain such element */
+            min_i = 0, min_len = skip = 0;
+            while (min_i == 0)
+            {  /* determine length of next shortest row */
+               cnt = lim;
+               for (j_end = (j_ptr = vc_ptr[j]) + vc_len[j];
+                  j_ptr < j_end; j_ptr++)
+               {  i = sv_ind[j_ptr];
+                  if (min_len < vr_len[i] && vr_len[i] < cnt)
+                     cnt = vr_len[i];
+               }
+               if (cnt == lim)
+               {  /* no more rows to check; remaining elements of j-th
+                   * column (if any) are not cheaper than the best
+                   * candidate */
+                  skip = (lim < INT_MAX);
+                  break;
+               }
+               min_len = cnt;
+               /* check elements placed in rows of length min_len */
+               for (j_ptr = vc_ptr[j]; j_ptr < j_end; j_ptr++)
+               {  i = sv_ind[j_ptr];
+                  if (vr_len[i] != min_len)
+                     continue;
+                  /* big := max|v[i,*]| */
+                  big = row_max(sgf, i);
+                  /* find v[i,j] in i-th row */
+                  for (i_end = (i_ptr = vr_ptr[i]) + vr_len[i];
+                     sv_ind[i_ptr] != j; i_ptr++)
+                     /* nop */;
+                  xassert(i_ptr < i_end);
+                  /* if |v[i,j]| >= piv_tol * max|v[i,*]|, v[i,j] is
+                   * the candidate */
+                  if ((temp = sv_val[i_ptr]) < 0.0)
+                     temp = -temp;
+                  if (temp >= piv_tol * big)
+                  {  min_i = i;
+                     break;
+                  }
+               }
+            }
+            /* j-th column has been scanned */
+            if (min_i != 0)
+            {  /* element v[min_i,j] is a next pivot candidate; if its
+                * Markowitz cost is not greater than (len-1)**2, choose
+                * it as the pivot right now */
+               if (min_len <= len)
+               {  p = min_i, q = j;
+                  goto done;
+               }
+               ncand++;
+               cost = (double)(min_len - 1) * (double)(len - 1);
+               if (cost < best)
+               {  p = min_i, q = j, best = cost;
+                  lim = cost_lim(best, len);
+               }
+               if (ncand == piv_lim)
+                  goto done;
+            }
+            else if (skip)
+            {  /* j-th column may contain a candidate, which, however,
+                * is not better than the best one; count it */
+               if (++ncand == piv_lim)
+                  goto done;
+            }
+            else if (suhl)
+            {  /* j-th column has no eligible elements; exclude it from
+                * further considerations (see sgf_choose_pivot) */
+               sgf_deactivate_col(j);
+               cs_prev[j] = cs_next[j] = j;
+            }
+         }
+         /* consider active rows containing len non-zeros */
+         for (i = rs_head[len]; i != 0; i = rs_next[i])
+         {  /* big := max|v[i,*]| */
+            big = row_max(sgf, i);
+            /* find an element in i-th row, which is placed in the
+             * column with minimal number of non-zeros, which is less
+             * than lim, and satisfies to the stability condition */
+            min_i = min_j = 0, min_len = lim;
+            for (i_end = (i_ptr = vr_ptr[i]) + vr_len[i];
+               i_ptr < i_end; i_ptr++)
+            {  /* get column index of v[i,j] */
+               j = sv_ind[i_ptr];
+               /* if j-th column is not shorter, skip v[i,j] */
+               if (vc_len[j] >= min_len)
+                  continue;
+               /* if |v[i,j]| < piv_tol * max|v[i,*]|, skip v[i,j] */
+               if ((temp = sv_val[i_ptr]) < 0.0)
+                  temp = -temp;
+               if (temp < piv_tol * big)
+                  continue;
+               /* v[i,j] is a better candidate */
+               min_i = i, min_j = j, min_len = vc_len[j];
+               /* if Markowitz cost of v[i,j] is not greater than
+                * (len-1)**2, choose it as the pivot right now */
+               if (min_len <= len)
+               {  p = min_i, q = min_j;
+                  goto done;
+               }
+            }
+            /* i-th row has been scanned; note that if no element has
+             * been found, the row contains a candidate (an element of
+             * largest magnitude), which is not better than the best one
+             * (this is possible only if lim < INT_MAX) */
+            xassert(min_i != 0 || lim < INT_MAX);
+            ncand++;
+            if (min_i != 0)
+            {  cost = (double)(len - 1) * (double)(min_len - 1);
+               if (cost < best)
+               {  p = min_i, q = min_j, best = cost;
+                  lim = cost_lim(best, len);
+               }
+            }
+            if (ncand == piv_lim)
+               goto done;
+         }
+      }
+done: /* report the pivot to the factorization routine */
+      *p_ = p, *q_ = q;
+      return (p == 0);
+}
+#endif
+
 /***********************************************************************
 *  sgf_choose_pivot - choose pivot element v[p,q]
 *
@@ -491,6 +746,10 @@ int sgf_choose_pivot(SGF *sgf, int *p_, int *q_)
       int i, i_ptr, i_end, j, j_ptr, j_end, len, min_i, min_j, min_len,
          ncand, next_j, p, q;
       double best, big, cost, temp;
+#if 1 /* 17/X-2026 */
+      if (sgf->mkz_bnd)
+         return choose_bnd(sgf, p_, q_);
+#endif
       /* no pivot candidate has been chosen so far */
       p = q = 0, best = DBL_MAX, ncand = 0;
       /* if the active submatrix contains a column having the only
@@ -966,11 +1225,10 @@ skip:    /* return i-th row to the active set with new length */
 }
 
 /***********************************************************************
-*  sgf_dense_lu - compute dense LU-factorization with full pivoting
+*  sgf_dense_lu - compute dense LU-factorization
 *
-*  This routine performs Gaussian elimination with full pivoting to
-*  compute dense LU-factorization of the specified matrix A of order n
-*  in the form:
+*  This routine performs Gaussian elimination to compute dense
+*  LU-factorization of the specified matrix A of order n in the form:
 *
 *     A = P * L * U * Q,                                             (1)
 *
@@ -1002,16 +1260,42 @@ skip:    /* return i-th row to the active set with new length */
 *  returns zero. Otherwise, if on k-th elimination step, 1 <= k <= n,
 *  all elements of the active submatrix are close to zero, the routine
 *  returns k, in which case a partial factorization is stored in the
-*  array a. */
+*  array a.
+*
+*  If n is small, the routine uses full pivoting. Otherwise, it uses a
+*  blocked right-looking algorithm with partial (row) pivoting: columns
+*  of A are processed in panels of NB columns; once a panel has been
+*  factorized, the corresponding block row of U is computed, and the
+*  remaining active submatrix is updated with one pass over its rows
+*  (see the routine vscan_update). The active submatrix is updated in
+*  vertical strips of NW columns, so the block row of U used for the
+*  update of a strip stays in cache.
+*
+*  Partial pivoting is used only while the largest element in the
+*  pivot column is not less than PIV_REL times the largest element of
+*  the original matrix A. Once this condition fails, which usually means
+*  that the active submatrix is nearly singular, all pending updates
+*  are applied, and the factorization is completed with full pivoting,
+*  which is numerically more reliable. */
 
-int sgf_dense_lu(int n, double a_[], int r[], int c[], double eps)
-{     /* non-optimized version */
+#define NB 32
+/* number of columns in panel */
+
+#define NW 256
+/* number of columns in vertical strip */
+
+#define PIV_REL 1e-8
+/* relative pivot tolerance for partial pivoting */
+
+static int full_lu(int n, double a_[], int k0, int r[], int c[],
+      double eps)
+{     /* perform elimination steps k0+1, ..., n with full pivoting */
       int i, j, k, p, q, ref;
       double akk, big, temp;
 #     define a(i,j) a_[(i)*n+(j)]
       /* initially U = A, L = P = Q = I */
       /* main elimination loop */
-      for (k = 0; k < n; k++)
+      for (k = k0; k < n; k++)
       {  /* choose pivot u[p,q], k <= p, q <= n */
          p = q = -1, big = eps;
          for (i = k; i < n; i++)
@@ -1056,6 +1340,88 @@ int sgf_dense_lu(int n, double a_[], int r[], int c[], double eps)
       return 0;
 }
 
+static void update_rest(int n, double a_[], int kb, int k1, int ke)
+{     /* apply elimination steps kb+1, ..., k1 (performed on columns
+       * kb, ..., ke-1 only) to columns ke, ..., n-1 */
+      int i, j, jw, k;
+#     define a(i,j) a_[(i)*n+(j)]
+      for (j = ke; j < n; j += NW)
+      {  /* process vertical strip of columns j, ..., j+jw-1 */
+         jw = (n - j < NW ? n - j : NW);
+         /* compute rows kb, ..., k1-1 of U in the strip */
+         for (k = kb+1; k < k1; k++)
+            vscan_update(jw, k-kb, &a(k,kb)-1, &a(kb,j)-1, n,
+               &a(k,j)-1);
+         /* update rows k1, ..., n-1 of active submatrix */
+         for (i = k1; i < n; i++)
+            vscan_update(jw, k1-kb, &a(i,kb)-1, &a(kb,j)-1, n,
+               &a(i,j)-1);
+      }
+#     undef a
+      return;
+}
+
+int sgf_dense_lu(int n, double a_[], int r[], int c[], double eps)
+{     int i, j, k, p, kb, ke, ref;
+      double akk, big, tol, temp;
+#     define a(i,j) a_[(i)*n+(j)]
+      if (n < NB + NB)
+      {  /* blocking gives no gain */
+         return full_lu(n, a_, 0, r, c, eps);
+      }
+      /* determine tolerance for partial pivoting */
+      tol = 0.0;
+      for (i = 0; i < n; i++)
+      {  temp = vscan_amax(n, &a(i,0)-1);
+         if (tol < temp)
+            tol = temp;
+      }
+      tol *= PIV_REL;
+      if (tol < eps)
+         tol = eps;
+      /* process panels of columns kb, ..., ke-1 */
+      for (kb = 0; kb < n; kb = ke)
+      {  ke = (n - kb < NB ? n : kb + NB);
+         /* factorize the panel with partial pivoting */
+         for (k = kb; k < ke; k++)
+         {  /* choose pivot u[p,k], k <= p <= n */
+            p = -1, big = tol;
+            for (i = k; i < n; i++)
+            {  if ((temp = a(i,k)) < 0.0)
+                  temp = -temp;
+               if (big < temp)
+                  p = i, big = temp;
+            }
+            if (p < 0)
+            {  /* apply pending updates and continue with full
+                * pivoting */
+               update_rest(n, a_, kb, k, ke);
+               return full_lu(n, a_, k, r, c, eps);
+            }
+            /* permute rows k and p */
+            if (k != p)
+            {  for (j = 0; j < n; j++)
+                  temp = a(k,j), a(k,j) = a(p,j), a(p,j) = temp;
+               ref = r[k], r[k] = r[p], r[p] = ref;
+            }
+            /* eliminate subdiagonal elements u[k+1,k], ..., u[n,k]
+             * within the panel */
+            akk = a(k,k);
+            for (i = k+1; i < n; i++)
+            {  if (a(i,k) != 0.0)
+               {  temp = (a(i,k) /= akk);
+                  for (j = k+1; j < ke; j++)
+                     a(i,j) -= temp * a(k,j);
+               }
+            }
+         }
+         /* update the rest of the matrix */
+         update_rest(n, a_, kb, ke, ke);
+      }
+#     undef a
+      return 0;
+}
+
 /***********************************************************************
 *  sgf_dense_phase - compute LU-factorization (dense phase)
 *
@@ -1065,9 +1431,10 @@ int sgf_dense_lu(int n, double a_[], int r[], int c[], double eps)
 *  to dense phase when the active submatrix is relatively dense, so
 *  using dense format allows significantly reduces overheads needed to
 *  maintain sparse data structures. And second, that is more important,
-*  on dense phase full pivoting is used (rather than partial pivoting)
-*  that allows improving numerical stability, since round-off errors
-*  tend to increase on last steps of the elimination process.
+*  on dense phase pivots are chosen by magnitude only (rather than with
+*  the threshold pivoting used on sparse phase) that allows improving
+*  numerical stability, since round-off errors tend to increase on last
+*  steps of the elimination process (see the routine sgf_dense_lu).
 *
 *  On entry the routine assumes that elimination steps 1, 2, ..., k-1
 *  have been performed, so partially transformed matrices L = P'* F * P
@@ -1091,9 +1458,9 @@ int sgf_dense_lu(int n, double a_[], int r[], int c[], double eps)
 *  active submatrix A~, whose elements are marked by '*'.
 *
 *  The routine copies the active submatrix A~ to a working array in
-*  dense format, compute dense factorization A~ = P~* L~* U~* Q~ using
-*  full pivoting, and then copies non-zero elements of factors L~ and
-*  U~ back to factors L and U (more precisely, to factors F and V).
+*  dense format, compute dense factorization A~ = P~* L~* U~* Q~, and
+*  then copies non-zero elements of factors L~ and U~ back to factors L
+*  and U (more precisely, to factors F and V).
 *
 *  If the factorization has been successfully computed, the routine
 *  returns zero. Otherwise, if on k-th elimination step, 1 <= k <= n,
@@ -1440,4 +1807,169 @@ int sgf_factorize(SGF *sgf, int singl)
       return 0;
 }
 
+#ifdef GLP_TEST
+/***********************************************************************
+*  This is a benchmark program, which compares the pivoting strategies
+*  of the sparse Gaussian factorizer on bases of real LP problems.
+*
+*  Usage: sgf problem basis1 [basis2 ...]
+*
+*  The problem should be specified in free MPS format (or in CPLEX LP
+*  format, if the file name ends with '.lp'). Each basis should be
+*  specified in GLPK format used to store basic solutions, so it can
+*  be dumped with the glpsol option '-w' or with the API routine
+*  glp_write_sol.
+*
+*  For each basis and each pivoting strategy (the original Duff's
+*  search and the search bounded by Markowitz cost) the program reports
+*  average time of computing the LU-factorization, the number of
+*  non-zeros in factors F and V (including the diagonal of V), the
+*  fill-in, and the maximal error |x[j] - 1| of the solution to the
+*  system B * x = b, where b = B * (1, ..., 1).
+*
+*  To build the program, compile this file with -DGLP_TEST and link it
+*  with the static GLPK library, for example:
+*
+*     cd glpk/src
+*     gcc -O2 -DGLP_TEST -I. -Ibflib -Ienv -Imisc bflib/sgf.c \
+*        .libs/libglpk.a -lm -o sgfbench */
+
+#include "glpk.h"
+#include "lufint.h"
+
+struct basis
+{     /* basis matrix B */
+      glp_prob *P;
+      /* LP problem */
+      int m;
+      /* order of B */
+      int *head; /* int head[1+m]; */
+      /* head[k] = i means that k-th column of B is i-th column of the
+       * augmented matrix (I | -A) */
+      int *ind; /* int ind[1+m]; */
+      double *val; /* double val[1+m]; */
+      /* working arrays */
+};
+
+static int col(void *info, int k, int ind[], double val[])
+{     /* retrieve k-th column of B */
+      struct basis *B = info;
+      int len, t;
+      if (B->head[k] <= B->m)
+      {  ind[1] = B->head[k], val[1] = 1.0;
+         return 1;
+      }
+      len = glp_get_mat_col(B->P, B->head[k] - B->m, ind, val);
+      for (t = 1; t <= len; t++)
+         val[t] = - val[t];
+      return len;
+}
+
+static void bench(struct basis *B, const char *name, int mkz_bnd)
+{     LUFINT *fi;
+      LUF *luf;
+      SVA *sva;
+      int m = B->m;
+      int i, k, t, len, cnt, ret, nnz_b, nnz_f, nnz_v;
+      double tm, tm_beg, err, *x, *b;
+      fi = lufint_create();
+      fi->sgf_mkz_bnd = mkz_bnd;
+      /* factorize B several times to obtain reliable timing */
+      cnt = 0, tm = 0.0;
+      tm_beg = glp_time();
+      do
+      {  ret = lufint_factorize(fi, m, col, B);
+         cnt++;
+         tm = glp_difftime(glp_time(), tm_beg);
+      } while (tm < 1.0 || cnt < 3);
+      luf = fi->luf, sva = luf->sva;
+      /* count non-zeros in B, F, and V */
+      nnz_b = 0;
+      for (k = 1; k <= m; k++)
+         nnz_b += col(B, k, B->ind, B->val);
+      nnz_f = nnz_v = 0;
+      for (i = 1; i <= m; i++)
+      {  nnz_f += sva->len[luf->fc_ref-1+i];
+         nnz_v += sva->len[luf->vr_ref-1+i] + 1;
+      }
+      /* solve B * x = b, where b = B * (1, ..., 1) */
+      err = DBL_MAX;
+      if (ret == 0)
+      {  x = talloc(1+m, double);
+         b = talloc(1+m, double);
+         for (i = 1; i <= m; i++)
+            b[i] = 0.0;
+         for (k = 1; k <= m; k++)
+         {  len = col(B, k, B->ind, B->val);
+            for (t = 1; t <= len; t++)
+               b[B->ind[t]] += B->val[t];
+         }
+         luf_f_solve(luf, b);
+         luf_v_solve(luf, b, x);
+         err = 0.0;
+         for (k = 1; k <= m; k++)
+         {  if (err < fabs(x[k] - 1.0))
+               err = fabs(x[k] - 1.0);
+         }
+         tfree(x);
+         tfree(b);
+      }
+      xprintf("%-20.20s %-5s %9.2f %9d %9d %9d %10.3e%s\n", name,
+         mkz_bnd ? "bnd" : "duff", 1000.0 * tm / (double)cnt, nnz_f,
+         nnz_v, nnz_f + nnz_v - nnz_b, err,
+         ret == 0 ? "" : " (singular)");
+      lufint_delete(fi);
+      return;
+}
+
+int main(int argc, char *argv[])
+{     struct basis _B, *B = &_B;
+      int i, j, k, n, len, ret;
+      if (argc < 3)
+      {  xprintf("Usage: %s problem basis1 [basis2 ...]\n", argv[0]);
+         return 1;
+      }
+      B->P = glp_create_prob();
+      len = strlen(argv[1]);
+      if (len > 3 && strcmp(argv[1] + len - 3, ".lp") == 0)
+         ret = glp_read_lp(B->P, NULL, argv[1]);
+      else
+         ret = glp_read_mps(B->P, GLP_MPS_FILE, NULL, argv[1]);
+      if (ret != 0)
+         return 1;
+      B->m = glp_get_num_rows(B->P);
+      n = glp_get_num_cols(B->P);
+      B->head = talloc(1+B->m, int);
+      B->ind = talloc(1+B->m, int);
+      B->val = talloc(1+B->m, double);
+      xprintf("%-20s %-5s %9s %9s %9s %9s %10s\n", "basis", "srch",
+         "time, ms", "nnz(F)", "nnz(V)", "fill-in", "max err");
+      for (k = 2; k < argc; k++)
+      {  if (glp_read_sol(B->P, argv[k]) != 0)
+            continue;
+         /* build the basis header */
+         len = 0;
+         for (i = 1; i <= B->m; i++)
+         {  if (glp_get_row_stat(B->P, i) == GLP_BS && ++len <= B->m)
+               B->head[len] = i;
+         }
+         for (j = 1; j <= n; j++)
+         {  if (glp_get_col_stat(B->P, j) == GLP_BS && ++len <= B->m)
+               B->head[len] = B->m + j;
+         }
+         if (len != B->m)
+         {  xprintf("%s: invalid basis\n", argv[k]);
+            continue;
+         }
+         bench(B, argv[k], 0);
+         bench(B, argv[k], 1);
+      }
+      tfree(B->head);
+      tfree(B->ind);
+      tfree(B->val);
+      glp_delete_prob(B->P);
+      return 0;
+}
+#endif
+
 /* eof */
@@ -110,6 +110,13 @@ struct SGF
       double eps_tol;
       /* epsilon tolerance; each element of the active submatrix, whose
        * magnitude is less than eps_tol, is replaced by exact zero */
+#if 1 /* 17/X-2026 */
+      int mkz_bnd;
+      /* if this flag is set, the pivoting routine bounds the search by
+       * Markowitz cost of the best pivot candidate found so far, i.e.
+       * skips rows and columns, which cannot give a better candidate,
+       * and terminates as soon as no better candidate can be found */
+#endif
 #if 0 /* FIXME */
       double den_lim;
       /* density limit; if the density of the active submatrix reaches
@@ -188,7 +195,7 @@ int sgf_eliminate(SGF *sgf, int p, int q);
 
 #define sgf_dense_lu _glp_sgf_dense_lu
 int sgf_dense_lu(int n, double a[], int r[], int c[], double eps);
-/* compute dense LU-factorization with full pivoting */
+/* compute dense LU-factorization */
 
 #define sgf_dense_phase _glp_sgf_dense_phase
 int sgf_dense_phase(LUF *luf, int k, int updat);
@@ -57,6 +57,11 @@ SVA *sva_create_area(int n_max, int size)
       sva->ind = talloc(1+size, int);
       sva->val = talloc(1+size, double);
       sva->talky = 0;
+#if 1 /* 17/X-2026 */
+      sva->slack = 0;
+      sva->n_defrag = sva->n_resize = 0;
+      sva->moved = 0.0;
+#endif
       return sva;
 }
 
@@ -146,6 +151,10 @@ void sva_resize_area(SVA *sva, int delta)
       xassert(delta != 0);
       /* determine size of the right part, in locations */
       r_size = size - r_ptr + 1;
+#if 1 /* 17/X-2026 */
+      sva->n_resize++;
+      sva->moved += (double)r_size * (sizeof(int) + sizeof(double));
+#endif
       /* relocate the right part in case of negative delta */
       if (delta < 0)
       {  xassert(delta >= m_ptr - r_ptr);
@@ -198,6 +207,9 @@ void sva_defrag_area(SVA *sva)
       int *ind = sva->ind;
       double *val = sva->val;
       int k, next_k, ptr_k, len_k, m_ptr, head, tail;
+#if 1 /* 17/X-2026 */
+      double moved = 0.0;
+#endif
 #if 1
       if (sva->talky)
       {  xprintf("sva_defrag_area:\n");
@@ -231,6 +243,9 @@ void sva_defrag_area(SVA *sva)
                memmove(&val[m_ptr], &val[ptr_k],
                   len_k * sizeof(double));
                ptr[k] = m_ptr;
+#if 1 /* 17/X-2026 */
+               moved += len_k;
+#endif
             }
             /* remove unused locations from k-th vector */
             cap[k] = len_k;
@@ -252,6 +267,10 @@ void sva_defrag_area(SVA *sva)
       /* set new head and tail of the linked list */
       sva->head = head;
       sva->tail = tail;
+#if 1 /* 17/X-2026 */
+      sva->n_defrag++;
+      sva->moved += moved * (sizeof(int) + sizeof(double));
+#endif
 #if 1
       if (sva->talky)
          xprintf("after defragmenting = %d %d %d\n", sva->m_ptr - 1,
@@ -272,17 +291,41 @@ void sva_defrag_area(SVA *sva)
 *
 *  First, the routine defragments the left part of SVA. Then, if the
 *  size of the left part has not sufficiently increased, the routine
-*  increases the total size of the SVA storage by reallocating it. */
+*  increases the total size of the SVA storage by reallocating it.
+*
+*  If the growth strategy is used (sva->slack > 0), the left part is
+*  defragmented only if at least a half of its locations are unused,
+*  since otherwise defragmenting would move more locations than it
+*  would reclaim. */
 
 void sva_more_space(SVA *sva, int m_size)
 {     int size, delta;
+#if 1 /* 17/X-2026 */
+      int k, used;
+#endif
 #if 1
       if (sva->talky)
          xprintf("sva_more_space: m_size = %d\n", m_size);
 #endif
       xassert(m_size > sva->r_ptr - sva->m_ptr);
+#if 0 /* 17/X-2026 */
       /* defragment the left part */
       sva_defrag_area(sva);
+#else
+      if (sva->slack > 0)
+      {  /* determine number of used locations in the left part */
+         used = 0;
+         for (k = sva->head; k != 0; k = sva->next[k])
+            used += sva->len[k];
+         /* defragment the left part, if it is worth doing */
+         if (used <= (sva->m_ptr - 1) / 2)
+            sva_defrag_area(sva);
+      }
+      else
+      {  /* defragment the left part */
+         sva_defrag_area(sva);
+      }
+#endif
       /* set, heuristically, the minimal size of the middle part to be
        * not less than the size of the defragmented left part */
       if (m_size < sva->m_ptr - 1)
@@ -385,6 +428,31 @@ void sva_enlarge_cap(SVA *sva, int k, int new_cap, int skip)
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  sva_slack_cap - determine new capacity of vector to be relocated
+*
+*  This routine determines the capacity to be allocated to a vector,
+*  whose length is len, on relocating it with sva_enlarge_cap, so that
+*  the vector could be further enlarged in place.
+*
+*  The parameter extra specifies the minimal number of extra locations
+*  to be reserved, extra >= 0.
+*
+*  The routine returns len + max(extra, len * slack / 100), where slack
+*  is a parameter of SVA (see comments in sva.h). */
+
+int sva_slack_cap(SVA *sva, int len, int extra)
+{     int more;
+      xassert(len >= 0 && extra >= 0);
+      more = (int)((double)len * (double)sva->slack / 100.0);
+      if (more < extra)
+         more = extra;
+      xassert(more < INT_MAX - len);
+      return len + more;
+}
+
+#endif
 /***********************************************************************
 *  sva_reserve_cap - reserve locations for specified vector
 *
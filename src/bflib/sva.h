@@ -63,6 +63,25 @@
 *  part of SVA. This part is used to store vectors, whose capacity is
 *  not changed. */
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  By default, if the middle part is exhausted, SVA first defragments
+*  its left part and only then, if there is still not enough room,
+*  enlarges the storage. This is not efficient when vectors in the left
+*  part are relocated one by one (as on Forrest-Tomlin updates), since
+*  each defragmentation moves the entire left part, while a few
+*  locations are actually reclaimed.
+*
+*  If the parameter slack is positive, SVA uses another (growth)
+*  strategy: the left part is defragmented only if at least a half of
+*  it is unused, otherwise the storage is enlarged, and on relocating
+*  a vector its capacity is increased by slack percents of its length
+*  (see sva_slack_cap) to reduce further relocations of that vector.
+*  With this strategy the number of locations moved on defragmenting
+*  never exceeds the number of unused locations reclaimed. */
+#endif
+
+
 typedef struct SVA SVA;
 
 struct SVA
@@ -114,6 +133,18 @@ struct SVA
       int talky;
       /* option to enable talky mode */
 #endif
+#if 1 /* 17/X-2026 */
+      int slack;
+      /* extra capacity reserved on relocating vectors, in percents of
+       * their lengths; 0 means the default strategy (see above) */
+      int n_defrag;
+      /* number of times the left part was defragmented */
+      int n_resize;
+      /* number of times the storage was enlarged */
+      double moved;
+      /* total number of bytes moved on defragmenting the left part
+       * and on relocating the right part due to resizing */
+#endif
 };
 
 #define sva_create_area _glp_sva_create_area
@@ -140,6 +171,12 @@ void sva_more_space(SVA *sva, int m_size);
 void sva_enlarge_cap(SVA *sva, int k, int new_cap, int skip);
 /* enlarge capacity of specified vector */
 
+#if 1 /* 17/X-2026 */
+#define sva_slack_cap _glp_sva_slack_cap
+int sva_slack_cap(SVA *sva, int len, int extra);
+/* determine new capacity of vector to be relocated */
+
+#endif
 #define sva_reserve_cap _glp_sva_reserve_cap
 void sva_reserve_cap(SVA *sva, int k, int new_cap);
 /* reserve locations for specified vector */
@@ -105,6 +105,11 @@ void bfd_set_bfcp(BFD *bfd, const void /* glp_bfcp */ *parm)
          bfd->parm.eps_tol = DBL_EPSILON;
          bfd->parm.nfs_max = 100;
          bfd->parm.nrs_max = 70;
+#if 1 /* 17/X-2026 */
+         bfd->parm.threads = 1;
+         bfd->parm.sva_slack = 0;
+         bfd->parm.mkz_bnd = GLP_OFF;
+#endif
       }
       else
          memcpy(&bfd->parm, parm, sizeof(glp_bfcp));
@@ -215,6 +220,10 @@ int bfd_factorize(BFD *bfd, int m, /*const int bh[],*/ int (*col1)
             bfd->u.fhvi->lufi->sgf_suhl = bfd->parm.suhl;
             bfd->u.fhvi->lufi->sgf_eps_tol = bfd->parm.eps_tol;
             bfd->u.fhvi->nfs_max = bfd->parm.nfs_max;
+#if 1 /* 17/X-2026 */
+            bfd->u.fhvi->lufi->sva_slack = bfd->parm.sva_slack;
+            bfd->u.fhvi->lufi->sgf_mkz_bnd = bfd->parm.mkz_bnd;
+#endif
             ret = fhvint_factorize(bfd->u.fhvi, m, bfd_col, &info);
 #if 1 /* FIXME */
             if (ret == 0)
@@ -229,12 +238,21 @@ int bfd_factorize(BFD *bfd, int m, /*const int bh[],*/ int (*col1)
                bfd->u.scfi->u.lufi->sgf_piv_lim = bfd->parm.piv_lim;
                bfd->u.scfi->u.lufi->sgf_suhl = bfd->parm.suhl;
                bfd->u.scfi->u.lufi->sgf_eps_tol = bfd->parm.eps_tol;
+#if 1 /* 17/X-2026 */
+               bfd->u.scfi->u.lufi->sva_slack = bfd->parm.sva_slack;
+               bfd->u.scfi->u.lufi->sgf_mkz_bnd = bfd->parm.mkz_bnd;
+#endif
             }
             else if (bfd->u.scfi->scf.type == 2)
             {  bfd->u.scfi->u.btfi->sgf_piv_tol = bfd->parm.piv_tol;
                bfd->u.scfi->u.btfi->sgf_piv_lim = bfd->parm.piv_lim;
                bfd->u.scfi->u.btfi->sgf_suhl = bfd->parm.suhl;
                bfd->u.scfi->u.btfi->sgf_eps_tol = bfd->parm.eps_tol;
+#if 1 /* 17/X-2026 */
+               bfd->u.scfi->u.btfi->nt = bfd->parm.threads;
+               bfd->u.scfi->u.btfi->sva_slack = bfd->parm.sva_slack;
+               bfd->u.scfi->u.btfi->sgf_mkz_bnd = bfd->parm.mkz_bnd;
+#endif
             }
             else
                xassert(bfd != bfd);
@@ -361,11 +379,22 @@ void bfd_ftran(BFD *bfd, double x[])
 #if 1 /* 30/III-2016 */
 void bfd_ftran_s(BFD *bfd, FVS *x)
 {     /* sparse version of bfd_ftran */
+#if 0 /* 17/X-2026 */
       /* (sparse mode is not implemented yet) */
+#endif
       int n = x->n;
       int *ind = x->ind;
       double *vec = x->vec;
       int j, nnz = 0;
+#if 1 /* 17/X-2026 */
+      xassert(bfd->valid);
+      if (bfd->type == 1)
+      {  /* hypersparse mode is used if x is sparse enough */
+         x->nnz = fhvint_ftran_s(bfd->u.fhvi, x->nnz, ind, vec);
+         return;
+      }
+      /* (sparse mode is not implemented yet) */
+#endif
       bfd_ftran(bfd, vec);
       for (j = n; j >= 1; j--)
       {  if (vec[j] != 0.0)
@@ -420,11 +449,22 @@ void bfd_btran(BFD *bfd, double x[])
 #if 1 /* 30/III-2016 */
 void bfd_btran_s(BFD *bfd, FVS *x)
 {     /* sparse version of bfd_btran */
+#if 0 /* 17/X-2026 */
       /* (sparse mode is not implemented yet) */
+#endif
       int n = x->n;
       int *ind = x->ind;
       double *vec = x->vec;
       int j, nnz = 0;
+#if 1 /* 17/X-2026 */
+      xassert(bfd->valid);
+      if (bfd->type == 1)
+      {  /* hypersparse mode is used if x is sparse enough */
+         x->nnz = fhvint_btran_s(bfd->u.fhvi, x->nnz, ind, vec);
+         return;
+      }
+      /* (sparse mode is not implemented yet) */
+#endif
       bfd_btran(bfd, vec);
       for (j = n; j >= 1; j--)
       {  if (vec[j] != 0.0)
@@ -519,6 +559,40 @@ int bfd_get_count(BFD *bfd)
       return bfd->upd_cnt;
 }
 
+#if 1 /* 17/X-2026 */
+void bfd_get_stats(BFD *bfd, int *n_defrag, int *n_resize,
+      double *moved)
+{     /* retrieve SVA statistics */
+      SVA *sva;
+      sva = NULL;
+      switch (bfd->type)
+      {  case 0:
+            break;
+         case 1:
+            sva = bfd->u.fhvi->lufi->sva;
+            break;
+         case 2:
+            if (bfd->u.scfi->scf.type == 1)
+               sva = bfd->u.scfi->u.lufi->sva;
+            else if (bfd->u.scfi->scf.type == 2)
+               sva = bfd->u.scfi->u.btfi->sva;
+            else
+               xassert(bfd != bfd);
+            break;
+         default:
+            xassert(bfd != bfd);
+      }
+      if (sva == NULL)
+         *n_defrag = *n_resize = 0, *moved = 0.0;
+      else
+      {  *n_defrag = sva->n_defrag;
+         *n_resize = sva->n_resize;
+         *moved = sva->moved;
+      }
+      return;
+}
+
+#endif
 void bfd_delete_it(BFD *bfd)
 {     /* delete LP basis factorization */
       switch (bfd->type)
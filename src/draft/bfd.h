@@ -98,6 +98,13 @@ int bfd_update(BFD *bfd, int j, int len, const int ind[], const double
 int bfd_get_count(BFD *bfd);
 /* determine factorization update count */
 
+#if 1 /* 17/X-2026 */
+#define bfd_get_stats _glp_bfd_get_stats
+void bfd_get_stats(BFD *bfd, int *n_defrag, int *n_resize,
+      double *moved);
+/* retrieve SVA statistics */
+#endif
+
 #define bfd_delete_it _glp_bfd_delete_it
 void bfd_delete_it(BFD *bfd);
 /* delete LP basis factorization */
@@ -288,6 +288,9 @@ static int preprocess_and_solve_lp(glp_prob *P, const glp_smcp *parm)
       /* build transformed LP */
       lp = glp_create_prob();
       npp_build_prob(npp, lp);
+#if 1 /* 17/X-2026 */
+      lp->stop = P->stop;
+#endif
       /* if the transformed LP is empty, it has empty solution, which
          is optimal */
       if (lp->m == 0 && lp->n == 0)
@@ -391,6 +394,9 @@ int glp_simplex(glp_prob *P, const glp_smcp *parm)
          xerror("glp_simplex: meth = %d; invalid parameter\n",
             parm->meth);
       if (!(parm->pricing == GLP_PT_STD ||
+#if 1 /* 17/X-2026 */
+            parm->pricing == GLP_PT_PARTIAL ||
+#endif
             parm->pricing == GLP_PT_PSE))
          xerror("glp_simplex: pricing = %d; invalid parameter\n",
             parm->pricing);
@@ -439,6 +445,11 @@ int glp_simplex(glp_prob *P, const glp_smcp *parm)
       if (!(parm->aorn == GLP_USE_AT || parm->aorn == GLP_USE_NT))
          xerror("glp_simplex: aorn = %d; invalid parameter\n",
             parm->aorn);
+#endif
+#if 1 /* 17/X-2026 */
+      if (!(parm->incr == GLP_ON || parm->incr == GLP_OFF))
+         xerror("glp_simplex: incr = %d; invalid parameter\n",
+            parm->incr);
 #endif
       /* basic solution is currently undefined */
       P->pbs_stat = P->dbs_stat = GLP_UNDEF;
@@ -527,6 +538,9 @@ void glp_init_smcp(glp_smcp *parm)
       parm->shift = GLP_ON;
       parm->aorn = GLP_USE_NT;
 #endif
+#if 1 /* 17/X-2026 */
+      parm->incr = GLP_OFF;
+#endif
 #ifdef CSL_MULTI_OBJECTIVE
       parm->mobj = GLP_OFF;
 #endif
@@ -25,6 +25,9 @@
 #include "env.h"
 #include "glpipm.h"
 #include "npp.h"
+#if 1 /* 17/X-2026 */
+#include "simplex.h"
+#endif
 
 /***********************************************************************
 *  NAME
@@ -51,6 +54,10 @@
 *  the transformed problem, and then transforms an obtained solution to
 *  the solution of the original problem.
 *
+*  If the ubnd option is enabled, double-bounded variables are not
+*  split; they are only shifted to have zero lower bounds, and their
+*  upper bounds are handled directly by the interior-point solver.
+*
 *  RETURNS
 *
 *  0  The LP problem instance has been successfully solved. This code
@@ -67,9 +74,18 @@
 *     Iteration limit exceeded.
 *
 *  GLP_EINSTAB
-*     Numerical instability on solving Newtonian system. */
+*     Numerical instability on solving Newtonian system.
+*
+*  If the crossover is enabled and the interior-point solution is
+*  optimal, the routine also finds an optimal basic solution (see the
+*  routine crossover below). In this case it returns the code reported
+*  by the simplex solver, if the latter fails. */
 
+#if 0 /* 17/X-2026 */
 static void transform(NPP *npp)
+#else
+static void transform(NPP *npp, int ubnd)
+#endif
 {     /* transform LP to the standard formulation */
       NPPROW *row, *prev_row;
       NPPCOL *col, *prev_col;
@@ -105,7 +121,14 @@ static void transform(NPP *npp)
             }
             else
                npp_ubnd_col(npp, col);
+#if 0 /* 17/X-2026 */
             npp_dbnd_col(npp, col);
+#else
+            /* if ubnd is set, upper bound is handled by the routine
+               ipm_solve */
+            if (!ubnd)
+               npp_dbnd_col(npp, col);
+#endif
          }
          else
             npp_fixed_col(npp, col);
@@ -113,10 +136,53 @@ static void transform(NPP *npp)
       for (row = npp->r_head; row != NULL; row = row->next)
          xassert(row->lb == row->ub);
       for (col = npp->c_head; col != NULL; col = col->next)
+#if 0 /* 17/X-2026 */
          xassert(col->lb == 0.0 && col->ub == +DBL_MAX);
+#else
+         xassert(col->lb == 0.0 &&
+            (ubnd ? col->ub > 0.0 : col->ub == +DBL_MAX));
+#endif
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  crossover - find optimal basic solution from interior point
+*
+*  This routine constructs an advanced basis from the optimal
+*  interior-point solution stored in the problem object P with the
+*  crossover procedure (see spxcross.c), and then calls the primal
+*  simplex method to find an optimal basic solution starting from that
+*  basis. The interior-point solution is kept unchanged. */
+
+static int crossover(glp_prob *P, const glp_iptcp *parm)
+{     glp_smcp smcp;
+      int np, nd, it_cnt, ret;
+      double tm_beg, tm_push;
+      glp_init_smcp(&smcp);
+      smcp.msg_lev = parm->msg_lev;
+      tm_beg = xtime();
+      if (parm->msg_lev >= GLP_MSG_ON)
+         xprintf("Crossover to basic solution...\n");
+      if (spx_crossover(P, &smcp, &np, &nd) != 0)
+      {  if (parm->msg_lev >= GLP_MSG_ERR)
+            xprintf("Warning: crossover failed; starting simplex from s"
+               "tandard basis\n");
+      }
+      tm_push = xdifftime(xtime(), tm_beg);
+      if (parm->msg_lev >= GLP_MSG_ON)
+         xprintf("%d primal push(es), %d dual push(es), %.1f secs\n",
+            np, nd, tm_push);
+      tm_beg = xtime();
+      it_cnt = P->it_cnt;
+      ret = glp_simplex(P, &smcp);
+      if (parm->msg_lev >= GLP_MSG_ON)
+         xprintf("Simplex cleanup: %d iteration(s), %.1f secs\n",
+            P->it_cnt - it_cnt, xdifftime(xtime(), tm_beg));
+      return ret;
+}
+
+#endif
 int glp_interior(glp_prob *P, const glp_iptcp *parm)
 {     glp_iptcp _parm;
       GLPROW *row;
@@ -124,6 +190,9 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
       NPP *npp = NULL;
       glp_prob *prob = NULL;
       int i, j, ret;
+#if 1 /* 17/X-2026 */
+      double tm_beg;
+#endif
       /* check control parameters */
       if (parm == NULL)
          glp_init_iptcp(&_parm), parm = &_parm;
@@ -139,6 +208,20 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
             parm->ord_alg == GLP_ORD_SYMAMD))
          xerror("glp_interior: ord_alg = %d; invalid parameter\n",
             parm->ord_alg);
+#if 1 /* 17/X-2026 */
+      if (!(1 <= parm->threads && parm->threads <= 256))
+         xerror("glp_interior: threads = %d; invalid parameter\n",
+            parm->threads);
+      if (!(parm->crossover == GLP_ON || parm->crossover == GLP_OFF))
+         xerror("glp_interior: crossover = %d; invalid parameter\n",
+            parm->crossover);
+      if (!(0 <= parm->mcc && parm->mcc <= 10))
+         xerror("glp_interior: mcc = %d; invalid parameter\n",
+            parm->mcc);
+      if (!(parm->ubnd == GLP_ON || parm->ubnd == GLP_OFF))
+         xerror("glp_interior: ubnd = %d; invalid parameter\n",
+            parm->ubnd);
+#endif
       /* interior-point solution is currently undefined */
       P->ipt_stat = GLP_UNDEF;
       P->ipt_obj = 0.0;
@@ -169,9 +252,16 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
             "ero(s)\n", P->m, P->n, P->nnz);
       npp = npp_create_wksp();
       npp_load_prob(npp, P, GLP_OFF, GLP_IPT, GLP_ON);
+#if 0 /* 17/X-2026 */
       transform(npp);
+#else
+      transform(npp, parm->ubnd == GLP_ON);
+#endif
       prob = glp_create_prob();
       npp_build_prob(npp, prob);
+#if 1 /* 17/X-2026 */
+      prob->stop = P->stop;
+#endif
       if (parm->msg_lev >= GLP_MSG_ALL)
          xprintf("Working LP has %d row(s), %d column(s), and %d non-ze"
             "ro(s)\n", prob->m, prob->n, prob->nnz);
@@ -191,6 +281,7 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
          glp_scale_prob(prob, GLP_SF_EQ);
          env->term_out = term_out;
       }
+#if 0 /* 17/X-2026 */
       /* warn about dense columns */
       if (parm->msg_lev >= GLP_MSG_ON && prob->m >= 200)
       {  int len, cnt = 0;
@@ -203,8 +294,19 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
          else if (cnt > 0)
             xprintf("WARNING: PROBLEM HAS %d DENSE COLUMNS\n", cnt);
       }
+#else
+      /* dense columns are handled by the routine ipm_solve */
+#endif
       /* solve the transformed LP */
+#if 1 /* 17/X-2026 */
+      tm_beg = xtime();
+#endif
       ret = ipm_solve(prob, parm);
+#if 1 /* 17/X-2026 */
+      if (parm->crossover == GLP_ON && parm->msg_lev >= GLP_MSG_ON)
+         xprintf("Interior-point method: %.1f secs\n",
+            xdifftime(xtime(), tm_beg));
+#endif
       /* postprocess solution from the transformed LP */
       npp_postprocess(npp, prob);
       /* and store solution to the original LP */
@@ -212,6 +314,12 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
 done: /* free working program objects */
       if (npp != NULL) npp_delete_wksp(npp);
       if (prob != NULL) glp_delete_prob(prob);
+#if 1 /* 17/X-2026 */
+      /* find optimal basic solution, if required */
+      if (ret == 0 && parm->crossover == GLP_ON &&
+          P->ipt_stat == GLP_OPT)
+         ret = crossover(P, parm);
+#endif
       /* return to the application program */
       return ret;
 }
@@ -236,6 +344,12 @@ done: /* free working program objects */
 void glp_init_iptcp(glp_iptcp *parm)
 {     parm->msg_lev = GLP_MSG_ALL;
       parm->ord_alg = GLP_ORD_AMD;
+#if 1 /* 17/X-2026 */
+      parm->threads = 1;
+      parm->crossover = GLP_OFF;
+      parm->mcc = 0;
+      parm->ubnd = GLP_OFF;
+#endif
       return;
 }
 
@@ -467,7 +467,12 @@ int glp_intopt(glp_prob *P, const glp_iocp *parm)
             parm->br_tech == GLP_BR_LFV ||
             parm->br_tech == GLP_BR_MFV ||
             parm->br_tech == GLP_BR_DTH ||
+#if 0 /* 17/X-2026 */
             parm->br_tech == GLP_BR_PCH))
+#else
+            parm->br_tech == GLP_BR_PCH ||
+            parm->br_tech == GLP_BR_RLB))
+#endif
          xerror("glp_intopt: br_tech = %d; invalid parameter\n",
             parm->br_tech);
       if (!(parm->bt_tech == GLP_BT_DFS ||
@@ -523,6 +528,28 @@ int glp_intopt(glp_prob *P, const glp_iocp *parm)
       if (!(parm->fp_heur == GLP_ON || parm->fp_heur == GLP_OFF))
          xerror("glp_intopt: fp_heur = %d; invalid parameter\n",
             parm->fp_heur);
+#if 1 /* 16/X-2026 */
+      if (!(1 <= parm->threads && parm->threads <= 256))
+         xerror("glp_intopt: threads = %d; invalid parameter\n",
+            parm->threads);
+      if (!(parm->sb_par == GLP_ON || parm->sb_par == GLP_OFF))
+         xerror("glp_intopt: sb_par = %d; invalid parameter\n",
+            parm->sb_par);
+#if 1 /* 17/X-2026 */
+      if (!(1 <= parm->rel_min && parm->rel_min <= 100))
+         xerror("glp_intopt: rel_min = %d; invalid parameter\n",
+            parm->rel_min);
+      if (parm->sb_nd_lim < 0)
+         xerror("glp_intopt: sb_nd_lim = %d; invalid parameter\n",
+            parm->sb_nd_lim);
+      if (parm->sb_it_lim < 0)
+         xerror("glp_intopt: sb_it_lim = %d; invalid parameter\n",
+            parm->sb_it_lim);
+      if (parm->nf_mem < 0)
+         xerror("glp_intopt: nf_mem = %d; invalid parameter\n",
+            parm->nf_mem);
+#endif
+#endif
 #if 1 /* 28/V-2010 */
       if (!(parm->alien == GLP_ON || parm->alien == GLP_OFF))
          xerror("glp_intopt: alien = %d; invalid parameter\n",
@@ -692,6 +719,17 @@ void glp_init_iocp(glp_iocp *parm)
 #endif
 #else
       parm->flip = GLP_ON;
+#endif
+#if 1 /* 16/X-2026 */
+      parm->threads = 1;
+      parm->sb_par = GLP_ON;
+#if 1 /* 17/X-2026 */
+      parm->rel_min = 4;
+      parm->sb_nd_lim = 5000;
+      parm->sb_it_lim = 100000;
+      parm->nf_mem = 0;
+      parm->nf_dir = NULL;
+#endif
 #endif
       return;
 }
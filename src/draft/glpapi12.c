@@ -203,6 +203,49 @@ int glp_bf_updated(glp_prob *lp)
       return cnt;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  NAME
+*
+*  glp_bf_stats - retrieve basis factorization storage statistics
+*
+*  SYNOPSIS
+*
+*  void glp_bf_stats(glp_prob *P, int *n_defrag, int *n_resize,
+*     double *moved);
+*
+*  DESCRIPTION
+*
+*  The routine glp_bf_stats reports how the sparse vector area, where
+*  the basis factorization associated with the specified problem object
+*  is stored, has been maintained since it was created.
+*
+*  The routine stores the number of times the storage was defragmented
+*  (compacted) and the number of times it was enlarged to locations,
+*  which the parameters n_defrag and n_resize point to, resp., and the
+*  total number of bytes moved on these operations to the location,
+*  which the parameter moved points to. Any of these parameters may be
+*  specified as NULL, in which case the corresponding value is not
+*  stored. */
+
+void glp_bf_stats(glp_prob *P, int *n_defrag, int *n_resize,
+      double *moved)
+{     int nd, nr;
+      double mv;
+      if (P->bfd == NULL)
+         nd = nr = 0, mv = 0.0;
+      else
+         bfd_get_stats(P->bfd, &nd, &nr, &mv);
+      if (n_defrag != NULL)
+         *n_defrag = nd;
+      if (n_resize != NULL)
+         *n_resize = nr;
+      if (moved != NULL)
+         *moved = mv;
+      return;
+}
+
+#endif
 /***********************************************************************
 *  NAME
 *
@@ -281,6 +324,17 @@ void glp_set_bfcp(glp_prob *P, const glp_bfcp *parm)
          if (!(1 <= parm->nrs_max && parm->nrs_max <= 32767))
             xerror("glp_set_bfcp: nrs_max = %d; invalid parameter\n",
                parm->nrs_max);
+#if 1 /* 17/X-2026 */
+         if (!(1 <= parm->threads && parm->threads <= 256))
+            xerror("glp_set_bfcp: threads = %d; invalid parameter\n",
+               parm->threads);
+         if (!(0 <= parm->sva_slack && parm->sva_slack <= 1000))
+            xerror("glp_set_bfcp: sva_slack = %d; invalid parameter\n",
+               parm->sva_slack);
+         if (!(parm->mkz_bnd == GLP_ON || parm->mkz_bnd == GLP_OFF))
+            xerror("glp_set_bfcp: mkz_bnd = %d; invalid parameter\n",
+               parm->mkz_bnd);
+#endif
       }
       bfd_set_bfcp(P->bfd, parm);
       return;
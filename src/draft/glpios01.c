@@ -25,6 +25,9 @@
 #include "env.h"
 #include "ios.h"
 #include "misc.h"
+#if 1 /* 17/X-2026 */
+#include "spxlp.h"
+#endif
 
 static int lpx_eval_tab_row(glp_prob *lp, int k, int ind[],
       double val[])
@@ -107,6 +110,11 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
       tree->slot = NULL;
       tree->head = tree->tail = NULL;
       tree->a_cnt = tree->n_cnt = tree->t_cnt = 0;
+#if 1 /* 17/X-2026 */
+      tree->pq_max = tree->pq_cnt = 0;
+      tree->bnd_pq = tree->est_pq = NULL;
+      tree->est_type = 0, tree->est_deg = 0.0;
+#endif
       /* the root subproblem is not solved yet, so its final components
          are unknown so far */
       tree->root_m = 0;
@@ -149,6 +157,14 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
 #endif
       /* pseudocost branching */
       tree->pcost = NULL;
+#if 1 /* 16/X-2026 */
+      tree->eval = NULL;
+#endif
+#if 1 /* 17/X-2026 */
+      tree->sb_cnt = tree->sb_itc = tree->sb_out = 0;
+      tree->lst_size = 0;
+      tree->nfile = NULL;
+#endif
       tree->iwrk = xcalloc(1+n, sizeof(int));
       tree->dwrk = xcalloc(1+n, sizeof(double));
       /* initialize control parameters */
@@ -178,10 +194,363 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
       tree->stop = 0;
       /* create the root subproblem, which initially is identical to
          the original MIP */
+#if 0 /* 17/X-2026 */
       new_node(tree, NULL);
+#else
+      tree->loaded = new_node(tree, NULL);
+      tree->undo = NULL;
+      tree->bf_keep = 0;
+#endif
       return tree;
 }
 
+#if 1 /* 17/X-2026 */
+static void *get_list(glp_tree *tree, int size)
+{     /* allocate memory for change list */
+      xassert(size > 0);
+      /* small lists, which are most common, are allocated from the
+         memory pool */
+      if (size <= 256)
+         return dmp_get_atom(tree->pool, size);
+      else
+         return xalloc(1, size);
+}
+
+static void free_list(glp_tree *tree, void *ptr, int size)
+{     /* free memory allocated for change list */
+      if (ptr == NULL)
+         xassert(size == 0);
+      else if (size <= 256)
+         dmp_free_atom(tree->pool, ptr, size);
+      else
+         xfree(ptr);
+      return;
+}
+
+/***********************************************************************
+*  ios_bnd_list - allocate bound change list of subproblem
+*
+*  This routine frees the bound change list of the specified subproblem
+*  and allocates a new list of len entries, which should be then filled
+*  by the calling routine. The routine returns node->b_ptr. */
+
+IOSBND *ios_bnd_list(glp_tree *tree, IOSNPD *node, int len)
+{     xassert(len >= 0);
+      /* the change lists must be kept in memory */
+      xassert(node->nf_ref == 0);
+      free_list(tree, node->b_ptr, node->b_len * sizeof(IOSBND));
+      tree->lst_size -= node->b_len * sizeof(IOSBND);
+      node->b_len = len;
+      node->b_ptr = (len == 0 ? NULL :
+         get_list(tree, len * sizeof(IOSBND)));
+      tree->lst_size += len * sizeof(IOSBND);
+      return node->b_ptr;
+}
+
+/***********************************************************************
+*  ios_stat_list - allocate status change list of subproblem
+*
+*  This routine frees the status change list of the specified
+*  subproblem and allocates a new list of len entries, which should be
+*  then filled by the calling routine. The routine returns
+*  node->s_ptr. */
+
+IOSTAT *ios_stat_list(glp_tree *tree, IOSNPD *node, int len)
+{     xassert(len >= 0);
+      /* the change lists must be kept in memory */
+      xassert(node->nf_ref == 0);
+      free_list(tree, node->s_ptr, node->s_len * sizeof(IOSTAT));
+      tree->lst_size -= node->s_len * sizeof(IOSTAT);
+      node->s_len = len;
+      node->s_ptr = (len == 0 ? NULL :
+         get_list(tree, len * sizeof(IOSTAT)));
+      tree->lst_size += len * sizeof(IOSTAT);
+      return node->s_ptr;
+}
+
+/***********************************************************************
+*  ios_free_rows - delete row addition list of subproblem
+*
+*  This routine deletes the row addition list of the specified
+*  subproblem. */
+
+void ios_free_rows(glp_tree *tree, IOSNPD *node)
+{     while (node->r_ptr != NULL)
+      {  IOSROW *r;
+         r = node->r_ptr;
+         if (r->name != NULL)
+         {  tree->lst_size -= strlen(r->name)+1;
+            dmp_free_atom(tree->pool, r->name, strlen(r->name)+1);
+         }
+         while (r->ptr != NULL)
+         {  IOSAIJ *a;
+            a = r->ptr;
+            r->ptr = a->next;
+            tree->lst_size -= sizeof(IOSAIJ);
+            dmp_free_atom(tree->pool, a, sizeof(IOSAIJ));
+         }
+         node->r_ptr = r->next;
+         tree->lst_size -= sizeof(IOSROW);
+         dmp_free_atom(tree->pool, r, sizeof(IOSROW));
+      }
+      return;
+}
+
+struct undo
+{     /* undo log; it keeps original attributes of rows and columns of
+         the parent subproblem changed by every subproblem on the path
+         from the root to the subproblem loaded, so the problem object
+         can be returned to any subproblem on this path */
+      int depth;
+      /* number of subproblems on the path (except the root), whose
+         changes are logged */
+      int l_max;
+      /* length of arrays b_lev and s_lev (enlarged automatically) */
+      int *b_lev; /* int b_lev[1+l_max]; */
+      int *s_lev; /* int s_lev[1+l_max]; */
+      /* b_lev[d] and s_lev[d], 1 <= d <= depth, are positions in the
+         logs, where entries for the subproblem at level d begin */
+      int b_max, b_len;
+      IOSBND *b_ptr; /* IOSBND b_ptr[b_max]; */
+      /* log of original types and bounds, b_ptr[0], ..., b_ptr[b_len-1]
+         are used */
+      int s_max, s_len;
+      IOSTAT *s_ptr; /* IOSTAT s_ptr[s_max]; */
+      /* log of original statuses, s_ptr[0], ..., s_ptr[s_len-1] are
+         used */
+};
+
+static struct undo *get_undo(glp_tree *tree)
+{     /* obtain pointer to undo log, creating it, if necessary */
+      struct undo *und = tree->undo;
+      if (und == NULL)
+      {  und = tree->undo = talloc(1, struct undo);
+         und->depth = 0;
+         und->l_max = 0;
+         und->b_lev = und->s_lev = NULL;
+         und->b_max = und->b_len = 0;
+         und->b_ptr = NULL;
+         und->s_max = und->s_len = 0;
+         und->s_ptr = NULL;
+      }
+      return und;
+}
+
+static void undo_open(struct undo *und, int level)
+{     /* start logging changes made by subproblem at specified level */
+      xassert(level == und->depth + 1);
+      if (und->l_max < level)
+      {  int l_max = und->l_max;
+         int *b_lev = und->b_lev, *s_lev = und->s_lev;
+         und->l_max = (l_max == 0 ? 100 : l_max + l_max);
+         und->b_lev = talloc(1+und->l_max, int);
+         und->s_lev = talloc(1+und->l_max, int);
+         if (l_max != 0)
+         {  memcpy(&und->b_lev[1], &b_lev[1], l_max * sizeof(int));
+            memcpy(&und->s_lev[1], &s_lev[1], l_max * sizeof(int));
+            tfree(b_lev);
+            tfree(s_lev);
+         }
+      }
+      und->depth = level;
+      und->b_lev[level] = und->b_len;
+      und->s_lev[level] = und->s_len;
+      return;
+}
+
+static void undo_bnd(struct undo *und, int k, int type, double lb,
+      double ub)
+{     /* log original type and bounds of row/column */
+      IOSBND *b;
+      if (und->b_len == und->b_max)
+      {  IOSBND *save = und->b_ptr;
+         und->b_max = (und->b_max == 0 ? 100 : und->b_max + und->b_max);
+         und->b_ptr = talloc(und->b_max, IOSBND);
+         if (save != NULL)
+         {  memcpy(und->b_ptr, save, und->b_len * sizeof(IOSBND));
+            tfree(save);
+         }
+      }
+      b = &und->b_ptr[und->b_len++];
+      b->k = k;
+      b->type = (unsigned char)type;
+      b->lb = lb;
+      b->ub = ub;
+      return;
+}
+
+static void undo_stat(struct undo *und, int k, int stat)
+{     /* log original status of row/column */
+      IOSTAT *s;
+      if (und->s_len == und->s_max)
+      {  IOSTAT *save = und->s_ptr;
+         und->s_max = (und->s_max == 0 ? 100 : und->s_max + und->s_max);
+         und->s_ptr = talloc(und->s_max, IOSTAT);
+         if (save != NULL)
+         {  memcpy(und->s_ptr, save, und->s_len * sizeof(IOSTAT));
+            tfree(save);
+         }
+      }
+      s = &und->s_ptr[und->s_len++];
+      s->k = k;
+      s->stat = (unsigned char)stat;
+      return;
+}
+
+static void apply_node(glp_tree *tree, IOSNPD *node, int save)
+{     /* go down from the parent subproblem to specified subproblem;
+         if the flag save is set, original attributes of rows and
+         columns are logged */
+      glp_prob *mip = tree->mip;
+      struct undo *und = NULL;
+      int m = mip->m;
+      int n = mip->n;
+      int k;
+      if (save)
+      {  und = get_undo(tree);
+         undo_open(und, node->level);
+         /* statuses should be logged before changing bounds, because
+            changing the type of a row/column may change its status */
+         for (k = 0; k < node->s_len; k++)
+         {  IOSTAT *s = &node->s_ptr[k];
+            if (s->k <= m)
+               undo_stat(und, s->k, mip->row[s->k]->stat);
+            else
+               undo_stat(und, s->k, mip->col[s->k-m]->stat);
+         }
+      }
+      /* change bounds of rows and columns */
+      for (k = 0; k < node->b_len; k++)
+      {  IOSBND *b = &node->b_ptr[k];
+         if (b->k <= m)
+         {  GLPROW *row = mip->row[b->k];
+            if (save)
+               undo_bnd(und, b->k, row->type, row->lb, row->ub);
+            glp_set_row_bnds(mip, b->k, b->type, b->lb, b->ub);
+         }
+         else
+         {  GLPCOL *col = mip->col[b->k-m];
+            if (save)
+               undo_bnd(und, b->k, col->type, col->lb, col->ub);
+            glp_set_col_bnds(mip, b->k-m, b->type, b->lb, b->ub);
+         }
+      }
+      /* change statuses of rows and columns */
+      for (k = 0; k < node->s_len; k++)
+      {  IOSTAT *s = &node->s_ptr[k];
+         if (s->k <= m)
+            glp_set_row_stat(mip, s->k, s->stat);
+         else
+            glp_set_col_stat(mip, s->k-m, s->stat);
+      }
+      /* add new rows */
+      if (node->r_ptr != NULL)
+      {  IOSROW *r;
+         IOSAIJ *a;
+         int i, len, *ind;
+         double *val;
+         ind = xcalloc(1+n, sizeof(int));
+         val = xcalloc(1+n, sizeof(double));
+         for (r = node->r_ptr; r != NULL; r = r->next)
+         {  i = glp_add_rows(mip, 1);
+            glp_set_row_name(mip, i, r->name);
+            xassert(mip->row[i]->level == 0);
+            mip->row[i]->level = node->level;
+            mip->row[i]->origin = r->origin;
+            mip->row[i]->klass = r->klass;
+            glp_set_row_bnds(mip, i, r->type, r->lb, r->ub);
+            len = 0;
+            for (a = r->ptr; a != NULL; a = a->next)
+               len++, ind[len] = a->j, val[len] = a->val;
+            glp_set_mat_row(mip, i, len, ind, val);
+            glp_set_rii(mip, i, r->rii);
+            glp_set_row_stat(mip, i, r->stat);
+         }
+         xfree(ind);
+         xfree(val);
+      }
+      return;
+}
+
+static void undo_node(glp_tree *tree, IOSNPD *node)
+{     /* go up from specified subproblem to its parent subproblem */
+      glp_prob *mip = tree->mip;
+      struct undo *und;
+      int m, k;
+      if (node->up == NULL)
+      {  /* the root subproblem has no changes */
+         goto done;
+      }
+      und = tree->undo;
+      xassert(und != NULL && und->depth == node->level);
+      /* remove rows added to the parent subproblem */
+      if (node->r_ptr != NULL)
+      {  IOSROW *r;
+         int i, nrs, *num;
+         nrs = 0;
+         for (r = node->r_ptr; r != NULL; r = r->next)
+            nrs++;
+         xassert(mip->m - nrs >= tree->root_m);
+         num = xcalloc(1+nrs, sizeof(int));
+         for (i = 1; i <= nrs; i++)
+            num[i] = mip->m - nrs + i;
+         glp_del_rows(mip, nrs, num);
+         xfree(num);
+      }
+      m = mip->m;
+      /* restore bounds of rows and columns */
+      for (k = und->b_len-1; k >= und->b_lev[node->level]; k--)
+      {  IOSBND *b = &und->b_ptr[k];
+         if (b->k <= m)
+            glp_set_row_bnds(mip, b->k, b->type, b->lb, b->ub);
+         else
+            glp_set_col_bnds(mip, b->k-m, b->type, b->lb, b->ub);
+      }
+      /* restore statuses of rows and columns */
+      for (k = und->s_len-1; k >= und->s_lev[node->level]; k--)
+      {  IOSTAT *s = &und->s_ptr[k];
+         if (s->k <= m)
+            glp_set_row_stat(mip, s->k, s->stat);
+         else
+            glp_set_col_stat(mip, s->k-m, s->stat);
+      }
+      und->b_len = und->b_lev[node->level];
+      und->s_len = und->s_lev[node->level];
+      und->depth--;
+done: return;
+}
+
+static void load_node(glp_tree *tree, IOSNPD *node)
+{     /* make the problem object correspond to specified subproblem */
+      IOSNPD *a, *b, *path;
+      a = tree->loaded;
+      xassert(a != NULL);
+      /* go up from the loaded subproblem and build path from the
+         specified subproblem to their common ancestor */
+      path = NULL;
+      for (b = node; b->level > a->level; b = b->up)
+         b->temp = path, path = b;
+      for (; a->level > b->level; a = a->up)
+         undo_node(tree, a);
+      while (a != b)
+      {  undo_node(tree, a);
+         a = a->up;
+         b->temp = path, path = b;
+         b = b->up;
+      }
+      /* go down from the common ancestor to the specified
+         subproblem */
+      for (b = path; b != NULL; b = b->temp)
+      {  /* change lists might be written to node file */
+         ios_nf_fetch(tree, b);
+         apply_node(tree, b, 1);
+      }
+      tree->loaded = node;
+      return;
+}
+
+#endif
+
 /***********************************************************************
 *  NAME
 *
@@ -198,8 +567,15 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
 *  reference number is p, and thereby makes it the current subproblem.
 *  Note that the specified subproblem must be active. Besides, if the
 *  current subproblem already exists, it must be frozen before reviving
-*  another subproblem. */
+*  another subproblem.
+*
+*  Since the problem object keeps LP relaxation of the most recently
+*  frozen subproblem, the routine goes up from that subproblem to its
+*  common ancestor with the specified subproblem undoing changes and
+*  then goes down to the specified subproblem applying changes, so only
+*  nodes, on which the paths differ, are visited. */
 
+#if 0 /* 17/X-2026 */
 void ios_revive_node(glp_tree *tree, int p)
 {     glp_prob *mip = tree->mip;
       IOSNPD *node, *root;
@@ -361,6 +737,90 @@ void ios_revive_node(glp_tree *tree, int p)
 #endif
 done: return;
 }
+#else
+void ios_revive_node(glp_tree *tree, int p)
+{     glp_prob *mip = tree->mip;
+      IOSNPD *node;
+      /* obtain pointer to the specified subproblem */
+      xassert(1 <= p && p <= tree->nslots);
+      node = tree->slot[p].node;
+      xassert(node != NULL);
+      /* the specified subproblem must be active */
+      xassert(node->count == 0);
+      /* the current subproblem must not exist */
+      xassert(tree->curr == NULL);
+      /* the specified subproblem becomes current */
+      tree->curr = node;
+      /* if the root subproblem should be revived, there is nothing
+         more to do */
+      if (node->up == NULL)
+      {  xassert(tree->loaded == node);
+         goto done;
+      }
+      /* make the problem object correspond to the parent subproblem */
+      load_node(tree, node->up);
+      /* the basis factorization of the most recently frozen
+         subproblem is kept only if it would be kept on going to the
+         parent subproblem through the root subproblem; otherwise the
+         LP relaxation would be solved starting from another
+         factorization of the same basis, and the search tree would
+         depend on the path, by which the subproblem is revived (note
+         that if the factorization is kept, no rows were added or
+         removed, and the basic variables are the same as in that
+         subproblem, so it corresponds to the current basis) */
+      mip->valid = (tree->bf_keep && node->up->root_bas);
+      /* and save attributes of its rows and columns */
+      {  int m = mip->m;
+         int n = mip->n;
+         int i, j;
+         tree->pred_m = m;
+         /* allocate/reallocate arrays, if necessary */
+         if (tree->pred_max < m + n)
+         {  int new_size = m + n + 100;
+            if (tree->pred_type != NULL) xfree(tree->pred_type);
+            if (tree->pred_lb != NULL) xfree(tree->pred_lb);
+            if (tree->pred_ub != NULL) xfree(tree->pred_ub);
+            if (tree->pred_stat != NULL) xfree(tree->pred_stat);
+            tree->pred_max = new_size;
+            tree->pred_type = xcalloc(1+new_size, sizeof(char));
+            tree->pred_lb = xcalloc(1+new_size, sizeof(double));
+            tree->pred_ub = xcalloc(1+new_size, sizeof(double));
+            tree->pred_stat = xcalloc(1+new_size, sizeof(char));
+         }
+         /* save row attributes */
+         for (i = 1; i <= m; i++)
+         {  GLPROW *row = mip->row[i];
+            tree->pred_type[i] = (char)row->type;
+            tree->pred_lb[i] = row->lb;
+            tree->pred_ub[i] = row->ub;
+            tree->pred_stat[i] = (char)row->stat;
+         }
+         /* save column attributes */
+         for (j = 1; j <= n; j++)
+         {  GLPCOL *col = mip->col[j];
+            tree->pred_type[m+j] = (char)col->type;
+            tree->pred_lb[m+j] = col->lb;
+            tree->pred_ub[m+j] = col->ub;
+            tree->pred_stat[m+j] = (char)col->stat;
+         }
+      }
+      /* make changes to restore components of the specified
+         subproblem */
+      ios_nf_fetch(tree, node);
+      apply_node(tree, node, 0);
+      /* the specified subproblem has been revived, so delete its
+         change lists */
+      ios_bnd_list(tree, node, 0);
+      ios_stat_list(tree, node, 0);
+      /* delete its row addition list (additional rows may appear, for
+         example, due to branching on GUB constraints */
+      ios_free_rows(tree, node);
+done: /* while the current subproblem exists, the problem object
+         corresponds to it */
+      tree->loaded = NULL;
+      return;
+}
+#endif
 
 /***********************************************************************
 *  NAME
@@ -376,6 +836,7 @@ done: return;
 *
 *  The routine ios_freeze_node freezes the current subproblem. */
 
+#if 0 /* 17/X-2026 */
 void ios_freeze_node(glp_tree *tree)
 {     glp_prob *mip = tree->mip;
       int m = mip->m;
@@ -547,6 +1008,188 @@ void ios_freeze_node(glp_tree *tree)
       tree->curr = NULL;
       return;
 }
+#else
+void ios_freeze_node(glp_tree *tree)
+{     glp_prob *mip = tree->mip;
+      int m = mip->m;
+      int n = mip->n;
+      IOSNPD *node;
+      /* obtain pointer to the current subproblem */
+      node = tree->curr;
+      xassert(node != NULL);
+      if (node->up == NULL)
+      {  /* freeze the root subproblem */
+         int k;
+         xassert(node->p == 1);
+         xassert(tree->root_m == 0);
+         xassert(tree->root_type == NULL);
+         xassert(tree->root_lb == NULL);
+         xassert(tree->root_ub == NULL);
+         xassert(tree->root_stat == NULL);
+         tree->root_m = m;
+         tree->root_type = xcalloc(1+m+n, sizeof(char));
+         tree->root_lb = xcalloc(1+m+n, sizeof(double));
+         tree->root_ub = xcalloc(1+m+n, sizeof(double));
+         tree->root_stat = xcalloc(1+m+n, sizeof(char));
+         for (k = 1; k <= m+n; k++)
+         {  if (k <= m)
+            {  GLPROW *row = mip->row[k];
+               tree->root_type[k] = (char)row->type;
+               tree->root_lb[k] = row->lb;
+               tree->root_ub[k] = row->ub;
+               tree->root_stat[k] = (char)row->stat;
+            }
+            else
+            {  GLPCOL *col = mip->col[k-m];
+               tree->root_type[k] = (char)col->type;
+               tree->root_lb[k] = col->lb;
+               tree->root_ub[k] = col->ub;
+               tree->root_stat[k] = (char)col->stat;
+            }
+         }
+         /* the problem object is kept as is */
+         node->root_bas = 1;
+         tree->bf_keep = mip->valid;
+      }
+      else
+      {  /* freeze non-root subproblem */
+         int pred_m = tree->pred_m;
+         int k, b_beg, s_beg, t, same;
+         struct undo *und = get_undo(tree);
+         xassert(pred_m <= m);
+         /* the basis factorization would remain valid on returning to
+            the root subproblem only if no rows are removed and the
+            basic variables are the same as in the root subproblem */
+         same = (m == tree->root_m);
+         /* scan rows and columns which exist in the parent subproblem
+            and log original attributes of those changed in the current
+            subproblem; the log entries then define change lists */
+         xassert(node->b_len == 0 && node->s_len == 0);
+         undo_open(und, node->level);
+         b_beg = und->b_len, s_beg = und->s_len;
+         for (k = 1; k <= pred_m + n; k++)
+         {  int type, stat;
+            double lb, ub;
+            /* determine attributes in the current subproblem */
+            if (k <= pred_m)
+            {  GLPROW *row = mip->row[k];
+               type = row->type;
+               lb = row->lb;
+               ub = row->ub;
+               stat = row->stat;
+            }
+            else
+            {  GLPCOL *col = mip->col[k - pred_m];
+               type = col->type;
+               lb = col->lb;
+               ub = col->ub;
+               stat = col->stat;
+            }
+            /* log type and bounds of a row/column, if changed */
+            if (!(tree->pred_type[k] == type &&
+                  tree->pred_lb[k] == lb && tree->pred_ub[k] == ub))
+               undo_bnd(und, k, tree->pred_type[k], tree->pred_lb[k],
+                  tree->pred_ub[k]);
+            /* log status of a row/column, if changed */
+            if (tree->pred_stat[k] != stat)
+               undo_stat(und, k, tree->pred_stat[k]);
+            /* note that pred_m = root_m, if same is set */
+            if (same && (tree->root_stat[k] == GLP_BS) !=
+                  (stat == GLP_BS))
+               same = 0;
+         }
+         node->root_bas = (same && node->up->root_bas);
+         tree->bf_keep = (same && mip->valid);
+         /* removing rows would discard pricing data kept by the simplex
+            solver, so do the same to solve subproblems as if they were
+            revived through the root subproblem */
+         if (m != tree->root_m && mip->spx_ws != NULL)
+            spx_ws_drop_se(mip->spx_ws);
+         /* build change lists; new attributes are taken from the
+            problem object */
+         ios_bnd_list(tree, node, und->b_len - b_beg);
+         for (t = 0; t < node->b_len; t++)
+         {  IOSBND *b = &node->b_ptr[t];
+            k = und->b_ptr[b_beg + t].k;
+            b->k = k;
+            if (k <= pred_m)
+            {  GLPROW *row = mip->row[k];
+               b->type = (unsigned char)row->type;
+               b->lb = row->lb;
+               b->ub = row->ub;
+            }
+            else
+            {  GLPCOL *col = mip->col[k - pred_m];
+               b->type = (unsigned char)col->type;
+               b->lb = col->lb;
+               b->ub = col->ub;
+            }
+         }
+         ios_stat_list(tree, node, und->s_len - s_beg);
+         for (t = 0; t < node->s_len; t++)
+         {  IOSTAT *s = &node->s_ptr[t];
+            k = und->s_ptr[s_beg + t].k;
+            s->k = k;
+            if (k <= pred_m)
+               s->stat = (unsigned char)mip->row[k]->stat;
+            else
+               s->stat = (unsigned char)mip->col[k - pred_m]->stat;
+         }
+         /* save new rows added to the current subproblem */
+         xassert(node->r_ptr == NULL);
+         if (pred_m < m)
+         {  int i, len, *ind;
+            double *val;
+            ind = xcalloc(1+n, sizeof(int));
+            val = xcalloc(1+n, sizeof(double));
+            for (i = m; i > pred_m; i--)
+            {  GLPROW *row = mip->row[i];
+               IOSROW *r;
+               const char *name;
+               r = dmp_get_atom(tree->pool, sizeof(IOSROW));
+               tree->lst_size += sizeof(IOSROW);
+               name = glp_get_row_name(mip, i);
+               if (name == NULL)
+                  r->name = NULL;
+               else
+               {  r->name = dmp_get_atom(tree->pool, strlen(name)+1);
+                  strcpy(r->name, name);
+                  tree->lst_size += strlen(name)+1;
+               }
+               r->origin = row->origin;
+               r->klass = row->klass;
+               r->type = (unsigned char)row->type;
+               r->lb = row->lb;
+               r->ub = row->ub;
+               r->ptr = NULL;
+               len = glp_get_mat_row(mip, i, ind, val);
+               for (k = 1; k <= len; k++)
+               {  IOSAIJ *a;
+                  a = dmp_get_atom(tree->pool, sizeof(IOSAIJ));
+                  a->j = ind[k];
+                  a->val = val[k];
+                  a->next = r->ptr;
+                  r->ptr = a;
+               }
+               tree->lst_size += len * sizeof(IOSAIJ);
+               r->rii = row->rii;
+               r->stat = (unsigned char)row->stat;
+               r->next = node->r_ptr;
+               node->r_ptr = r;
+            }
+            xfree(ind);
+            xfree(val);
+         }
+         /* the problem object is kept as is, since the subproblem
+            to be revived next is likely to be close to the current
+            one (see the routine ios_revive_node) */
+      }
+      /* the current subproblem has been frozen */
+      tree->curr = NULL;
+      tree->loaded = node;
+      return;
+}
+#endif
 
 /***********************************************************************
 *  NAME
@@ -616,6 +1259,9 @@ static IOSNPD *new_node(glp_tree *tree, IOSNPD *parent)
       node->up = parent;
       node->level = (parent == NULL ? 0 : parent->level + 1);
       node->count = 0;
+#if 1 /* 17/X-2026 */
+      node->b_len = node->s_len = 0;
+#endif
       node->b_ptr = NULL;
       node->s_ptr = NULL;
       node->r_ptr = NULL;
@@ -632,6 +1278,9 @@ static IOSNPD *new_node(glp_tree *tree, IOSNPD *parent)
          -DBL_MAX : +DBL_MAX) : parent->bound);
       node->br_var = 0;
       node->br_val = 0.0;
+#if 1 /* 16/X-2026 */
+      node->ahead = 0;
+#endif
       node->ii_cnt = 0;
       node->ii_sum = 0.0;
 #if 1 /* 30/XI-2009 */
@@ -655,6 +1304,14 @@ static IOSNPD *new_node(glp_tree *tree, IOSNPD *parent)
       tree->a_cnt++;
       tree->n_cnt++;
       tree->t_cnt++;
+#if 1 /* 17/X-2026 */
+      /* add the new subproblem to the priority queues */
+      node->seq = tree->t_cnt;
+      ios_pq_add(tree, node);
+      node->nf_ref = 0;
+      node->nf_use = tree->t_cnt;
+      node->root_bas = 0;
+#endif
       /* increase the number of child subproblems */
       if (parent == NULL)
          xassert(p == 1);
@@ -686,6 +1343,9 @@ void ios_clone_node(glp_tree *tree, int p, int nnn, int ref[])
          node->next->prev = node->prev;
       node->prev = node->next = NULL;
       tree->a_cnt--;
+#if 1 /* 17/X-2026 */
+      ios_pq_del(tree, node);
+#endif
       /* create clone subproblems */
       xassert(nnn > 0);
       for (k = 1; k <= nnn; k++)
@@ -735,7 +1395,19 @@ void ios_delete_node(glp_tree *tree, int p)
          node->next->prev = node->prev;
       node->prev = node->next = NULL;
       tree->a_cnt--;
+#if 1 /* 17/X-2026 */
+      ios_pq_del(tree, node);
+#endif
 loop: /* recursive deletion starts here */
+#if 1 /* 17/X-2026 */
+      /* if the problem object corresponds to the subproblem, make it
+         correspond to the parent subproblem */
+      if (tree->loaded == node)
+      {  undo_node(tree, node);
+         tree->loaded = node->up;
+      }
+#endif
+#if 0 /* 17/X-2026 */
       /* delete the bound change list */
       {  IOSBND *b;
          while (node->b_ptr != NULL)
@@ -752,7 +1424,16 @@ loop: /* recursive deletion starts here */
             dmp_free_atom(tree->pool, s, sizeof(IOSTAT));
          }
       }
+#else
+      /* if the change lists are stored in node file, discard them */
+      if (node->nf_ref != 0)
+         ios_nf_drop(tree, node);
+      /* delete the bound and status change lists */
+      ios_bnd_list(tree, node, 0);
+      ios_stat_list(tree, node, 0);
+#endif
       /* delete the row addition list */
+#if 0 /* 17/X-2026 */
       while (node->r_ptr != NULL)
       {  IOSROW *r;
          r = node->r_ptr;
@@ -767,6 +1448,9 @@ loop: /* recursive deletion starts here */
          node->r_ptr = r->next;
          dmp_free_atom(tree->pool, r, sizeof(IOSROW));
       }
+#else
+      ios_free_rows(tree, node);
+#endif
 #if 0
       /* delete the edge addition list */
       /* delete the clique addition list */
@@ -863,7 +1547,34 @@ void ios_delete_tree(glp_tree *tree)
       /* delete the branch-and-bound tree */
       xassert(tree->local != NULL);
       ios_delete_pool(tree, tree->local);
+#if 1 /* 17/X-2026 */
+      /* delete node files, if any */
+      if (tree->nfile != NULL)
+         ios_nf_free(tree);
+      /* large change lists are not allocated from the memory pool, so
+         they should be freed explicitly */
+      {  int p;
+         for (p = 1; p <= tree->nslots; p++)
+         {  IOSNPD *node = tree->slot[p].node;
+            if (node != NULL)
+            {  node->nf_ref = 0;
+               ios_bnd_list(tree, node, 0);
+               ios_stat_list(tree, node, 0);
+            }
+         }
+      }
+#endif
       dmp_delete_pool(tree->pool);
+#if 1 /* 17/X-2026 */
+      if (tree->undo != NULL)
+      {  struct undo *und = tree->undo;
+         if (und->b_lev != NULL) tfree(und->b_lev);
+         if (und->s_lev != NULL) tfree(und->s_lev);
+         if (und->b_ptr != NULL) tfree(und->b_ptr);
+         if (und->s_ptr != NULL) tfree(und->s_ptr);
+         tfree(und);
+      }
+#endif
       xfree(tree->orig_type);
       xfree(tree->orig_lb);
       xfree(tree->orig_ub);
@@ -871,6 +1582,10 @@ void ios_delete_tree(glp_tree *tree)
       xfree(tree->orig_prim);
       xfree(tree->orig_dual);
       xfree(tree->slot);
+#if 1 /* 17/X-2026 */
+      if (tree->bnd_pq != NULL) xfree(tree->bnd_pq);
+      if (tree->est_pq != NULL) xfree(tree->est_pq);
+#endif
       if (tree->root_type != NULL) xfree(tree->root_type);
       if (tree->root_lb != NULL) xfree(tree->root_lb);
       if (tree->root_ub != NULL) xfree(tree->root_ub);
@@ -882,6 +1597,9 @@ void ios_delete_tree(glp_tree *tree)
       xfree(tree->j_ref);
 #endif
       if (tree->pcost != NULL) ios_pcost_free(tree);
+#if 1 /* 16/X-2026 */
+      if (tree->eval != NULL) ios_eval_free(tree);
+#endif
       xfree(tree->iwrk);
       xfree(tree->dwrk);
 #if 0
@@ -1229,6 +1947,13 @@ int ios_is_hopeful(glp_tree *tree, double bound)
 *  for the best node. However, if the tree is empty, it returns zero. */
 
 int ios_best_node(glp_tree *tree)
+#if 1 /* 17/X-2026 */
+{     /* the best node is kept at the top of the priority queue */
+      IOSNPD *best;
+      best = ios_pq_bound(tree);
+      return best == NULL ? 0 : best->p;
+}
+#else
 {     IOSNPD *node, *best = NULL;
       switch (tree->mip->dir)
       {  case GLP_MIN:
@@ -1248,6 +1973,7 @@ int ios_best_node(glp_tree *tree)
       }
       return best == NULL ? 0 : best->p;
 }
+#endif
 
 /***********************************************************************
 *  NAME
@@ -48,7 +48,12 @@
 *  the number of open (active) subproblems;
 *
 *  the number of completely explored subproblems, i.e. whose nodes have
-*  been removed from the tree. */
+*  been removed from the tree.
+*
+*  If LP relaxations have been solved by strong branching since the
+*  last display, the routine also displays the total number of such LP
+*  relaxations and the total number of simplex iterations spent on
+*  solving them. */
 
 static void show_progress(glp_tree *T, int bingo)
 {     int p;
@@ -98,6 +103,13 @@ static void show_progress(glp_tree *T, int bingo)
       xprintf("+%6d: %s %s %s %s %s (%d; %d)\n",
          T->mip->it_cnt, bingo ? ">>>>>" : "mip =", best_mip, rho,
          best_bound, rel_gap, T->a_cnt, T->t_cnt - T->n_cnt);
+#if 1 /* 17/X-2026 */
+      if (T->sb_cnt != T->sb_out)
+      {  xprintf("%8sstrong branching: %d LP(s), %d iteration(s)\n",
+            "", T->sb_cnt, T->sb_itc);
+         T->sb_out = T->sb_cnt;
+      }
+#endif
       T->tm_lag = xtime();
       return;
 }
@@ -476,6 +488,7 @@ static int branch_on(glp_tree *T, int j, int next)
       node = T->slot[clone[1]].node;
       xassert(node != NULL);
       xassert(node->up != NULL);
+#if 0 /* 17/X-2026 */
       xassert(node->b_ptr == NULL);
       node->b_ptr = dmp_get_atom(T->pool, sizeof(IOSBND));
       node->b_ptr->k = m + j;
@@ -483,6 +496,15 @@ static int branch_on(glp_tree *T, int j, int next)
       node->b_ptr->lb = lb;
       node->b_ptr->ub = new_ub;
       node->b_ptr->next = NULL;
+#else
+      xassert(node->b_len == 0);
+      {  IOSBND *b = ios_bnd_list(T, node, 1);
+         b->k = m + j;
+         b->type = (unsigned char)dn_type;
+         b->lb = lb;
+         b->ub = new_ub;
+      }
+#endif
       node->lp_obj = dn_lp;
       if (mip->dir == GLP_MIN)
       {  if (node->bound < dn_bnd)
@@ -498,6 +520,7 @@ static int branch_on(glp_tree *T, int j, int next)
       node = T->slot[clone[2]].node;
       xassert(node != NULL);
       xassert(node->up != NULL);
+#if 0 /* 17/X-2026 */
       xassert(node->b_ptr == NULL);
       node->b_ptr = dmp_get_atom(T->pool, sizeof(IOSBND));
       node->b_ptr->k = m + j;
@@ -505,6 +528,15 @@ static int branch_on(glp_tree *T, int j, int next)
       node->b_ptr->lb = new_lb;
       node->b_ptr->ub = ub;
       node->b_ptr->next = NULL;
+#else
+      xassert(node->b_len == 0);
+      {  IOSBND *b = ios_bnd_list(T, node, 1);
+         b->k = m + j;
+         b->type = (unsigned char)up_type;
+         b->lb = new_lb;
+         b->ub = ub;
+      }
+#endif
       node->lp_obj = up_lp;
       if (mip->dir == GLP_MIN)
       {  if (node->bound < up_bnd)
@@ -918,6 +950,15 @@ int ios_driver(glp_tree *T)
 #if 1 /* 27/II-2016 by Chris */
       int root_done = 0;
 #endif
+#if 1 /* 17/X-2026 */
+      int cleaned = 0;
+      double cln_obj = 0.0;
+      /* if cleaned is set, cln_obj is the incumbent objective value,
+         for which hopeless branches were last pruned; since local
+         bounds of active subproblems in the tree are never changed by
+         other subproblems, walking through the active list makes sense
+         only if the incumbent has been improved */
+#endif
 #if 0
       ((glp_iocp *)T->parm)->msg_lev = GLP_MSG_DBG;
 #endif
@@ -940,10 +981,29 @@ loop: /* main loop starts here */
          xassert(dmp_in_use(T->pool).lo == 0);
 #else
          xassert(dmp_in_use(T->pool) == 0);
+#endif
+#if 1 /* 17/X-2026 */
+         xassert(T->lst_size == 0);
 #endif
          ret = 0;
          goto done;
       }
+#if 1 /* 17/X-2026 */
+      /* if change lists of subproblems take too much memory, write
+         least recently used ones to node files */
+      if (T->parm->nf_mem > 0)
+         ios_nf_spill(T);
+#endif
+#if 1 /* 16/X-2026 */
+      /* solve LP relaxations of some active subproblems in advance
+         using multiple threads */
+      if (T->parm->threads > 1)
+      {  ios_eval_nodes(T);
+         /* some subproblems might be pruned */
+         if (T->head == NULL)
+            goto loop;
+      }
+#endif
       /* select some active subproblem to continue the search */
       xassert(T->next_p == 0);
       /* let the application program select subproblem */
@@ -1481,7 +1541,15 @@ fath: /* the current subproblem has been fathomed */
       ios_delete_node(T, p);
       /* if a new integer feasible solution has just been found, other
          branches may become hopeless and therefore must be pruned */
+#if 0 /* 17/X-2026 */
       if (T->mip->mip_stat == GLP_FEAS) cleanup_the_tree(T);
+#else
+      if (T->mip->mip_stat == GLP_FEAS &&
+         !(cleaned && cln_obj == T->mip->mip_obj))
+      {  cleanup_the_tree(T);
+         cleaned = 1, cln_obj = T->mip->mip_obj;
+      }
+#endif
       /* new subproblem selection is needed due to backtracking */
       pred_p = 0;
       goto loop;
@@ -1503,6 +1571,10 @@ done: /* display progress of the search on exit from the solver */
          ios_clq_term(T->clq_gen), T->clq_gen = NULL;
 #else
          glp_cfg_free(T->clq_gen), T->clq_gen = NULL;
+#endif
+#if 1 /* 16/X-2026 */
+      if (T->eval != NULL)
+         ios_eval_free(T);
 #endif
       /* return to the calling program */
       return ret;
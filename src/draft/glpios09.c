@@ -72,6 +72,12 @@ int ios_choose_var(glp_tree *T, int *next)
       {  /* hybrid pseudocost heuristic */
          j = ios_pcost_branch(T, next);
       }
+#if 1 /* 17/X-2026 */
+      else if (T->parm->br_tech == GLP_BR_RLB)
+      {  /* reliability branching */
+         j = ios_pcost_branch(T, next);
+      }
+#endif
       else
          xassert(T != T);
       return j;
@@ -403,6 +409,39 @@ struct csa
       double *up_sum; /* double up_sum[1+n]; */
       /* up_sum[j] is the sum of per unit degradations of the objective
          over all up_cnt[j] subproblems */
+#if 1 /* 16/X-2026 */
+      double *dn_deg; /* double dn_deg[1+n]; */
+      double *up_deg; /* double up_deg[1+n]; */
+      /* dn_deg[j] and up_deg[j] are degradations of the objective for
+         down- and up-branches of x[j] computed in advance by parallel
+         strong branching for the current subproblem; negative value
+         means the degradation has not been computed */
+#endif
+#if 1 /* 17/X-2026 */
+      IOSPRB *prb;
+      /* probe used to compute degradations for the current subproblem
+         in place; NULL means the probe has not been created yet */
+      int *dn_itc; /* int dn_itc[1+n]; */
+      int *up_itc; /* int up_itc[1+n]; */
+      /* dn_itc[j] and up_itc[j] are numbers of simplex iterations spent
+         to compute dn_deg[j] and up_deg[j] */
+      int rel_min;
+      /* reliability threshold: pseudocost of x[j] is initialized with
+         strong branching until it is based on at least rel_min
+         observations (1 for the hybrid pseudocost heuristic) */
+      int nd_itc;
+      /* number of simplex iterations spent on strong branching for the
+         current subproblem */
+      int nd_lim, it_lim;
+      /* limits on the number of simplex iterations spent on strong
+         branching for one subproblem and in total (applied only to
+         the reliability branching) */
+      double dn_avg, up_avg;
+      /* average down and up pseudocosts over all variables, whose
+         pseudocosts are initialized; used for variables, whose
+         pseudocosts cannot be initialized due to strong branching
+         iteration limits */
+#endif
 };
 
 void *ios_pcost_init(glp_tree *tree)
@@ -418,19 +457,77 @@ void *ios_pcost_init(glp_tree *tree)
       {  csa->dn_cnt[j] = csa->up_cnt[j] = 0;
          csa->dn_sum[j] = csa->up_sum[j] = 0.0;
       }
+#if 1 /* 16/X-2026 */
+      csa->dn_deg = xcalloc(1+n, sizeof(double));
+      csa->up_deg = xcalloc(1+n, sizeof(double));
+      for (j = 1; j <= n; j++)
+         csa->dn_deg[j] = csa->up_deg[j] = -1.0;
+#endif
+#if 1 /* 17/X-2026 */
+      csa->prb = NULL;
+      csa->dn_itc = xcalloc(1+n, sizeof(int));
+      csa->up_itc = xcalloc(1+n, sizeof(int));
+      for (j = 1; j <= n; j++)
+         csa->dn_itc[j] = csa->up_itc[j] = 0;
+      if (tree->parm->br_tech == GLP_BR_RLB)
+         csa->rel_min = tree->parm->rel_min;
+      else
+         csa->rel_min = 1;
+      csa->nd_itc = 0;
+      if (tree->parm->br_tech == GLP_BR_RLB)
+      {  csa->nd_lim = tree->parm->sb_nd_lim;
+         csa->it_lim = tree->parm->sb_it_lim;
+      }
+      else
+         csa->nd_lim = csa->it_lim = INT_MAX;
+      csa->dn_avg = csa->up_avg = 1.0;
+#endif
       return csa;
 }
 
+#if 1 /* 16/X-2026 */
+static double solve_degrad(IOSPRB *prb, glp_prob *P, int j,
+      double bnd, int *itc);
+
+static double eval_degrad(glp_tree *T, int j, double bnd, int *itc)
+{     /* compute degradation of the objective on fixing x[j] at given
+         value with a limited number of dual simplex iterations */
+      struct csa *csa = T->pcost;
+      /* LP relaxation of the current subproblem is probed in place;
+         the probe is created on the first call for the subproblem */
+      if (csa->prb == NULL)
+         csa->prb = ios_probe_init(T->mip);
+      return solve_degrad(csa->prb, T->mip, j, bnd, itc);
+}
+#endif
+
+#if 0 /* 16/X-2026 */
 static double eval_degrad(glp_prob *P, int j, double bnd)
+#else
+static double solve_degrad(IOSPRB *prb, glp_prob *P, int j,
+      double bnd, int *itc)
+#endif
 {     /* compute degradation of the objective on fixing x[j] at given
          value with a limited number of dual simplex iterations */
       /* this routine fixes column x[j] at specified value bnd,
          solves resulting LP, and returns a lower bound to degradation
          of the objective, degrad >= 0 */
+#if 0 /* 16/X-2026 */
       glp_prob *lp;
+#else
+      /* P is the problem object being probed with prb; on entry and
+         on exit it has the optimal basis saved in the probe; on exit
+         the number of simplex iterations performed is stored to *itc */
+      glp_prob *lp = P;
+      double obj_val = P->obj_val;
+      int it_cnt = P->it_cnt;
+#endif
+#if 0 /* 16/X-2026 */
       glp_smcp parm;
+#endif
       int ret;
       double degrad;
+#if 0 /* 16/X-2026 */
       /* the current basis must be optimal */
       xassert(glp_get_status(P) == GLP_OPT);
       /* create a copy of P */
@@ -446,6 +543,12 @@ static double eval_degrad(glp_prob *P, int j, double bnd)
       parm.out_dly = 1000;
       parm.meth = GLP_DUAL;
       ret = glp_simplex(lp, &parm);
+#else
+      /* fix column x[j] at specified value */
+      ios_probe_bnds(prb, j, GLP_FX, bnd, bnd);
+      /* try to solve resulting LP starting from the optimal basis */
+      ret = ios_probe_solve(prb, 30);
+#endif
       if (ret == 0 || ret == GLP_EITLIM)
       {  if (glp_get_prim_stat(lp) == GLP_NOFEAS)
          {  /* resulting LP has no primal feasible solution */
@@ -454,17 +557,30 @@ static double eval_degrad(glp_prob *P, int j, double bnd)
          else if (glp_get_dual_stat(lp) == GLP_FEAS)
          {  /* resulting basis is optimal or at least dual feasible,
                so we have the correct lower bound to degradation */
+#if 0 /* 16/X-2026 */
             if (P->dir == GLP_MIN)
                degrad = lp->obj_val - P->obj_val;
             else if (P->dir == GLP_MAX)
                degrad = P->obj_val - lp->obj_val;
             else
                xassert(P != P);
+#else
+            if (P->dir == GLP_MIN)
+               degrad = lp->obj_val - obj_val;
+            else if (P->dir == GLP_MAX)
+               degrad = obj_val - lp->obj_val;
+            else
+               xassert(P != P);
+#endif
             /* degradation cannot be negative by definition */
             /* note that the lower bound to degradation may be close
                to zero even if its exact value is zero due to round-off
                errors on computing the objective value */
+#if 0 /* 16/X-2026 */
             if (degrad < 1e-6 * (1.0 + 0.001 * fabs(P->obj_val)))
+#else
+            if (degrad < 1e-6 * (1.0 + 0.001 * fabs(obj_val)))
+#endif
                degrad = 0.0;
          }
          else
@@ -478,8 +594,14 @@ static double eval_degrad(glp_prob *P, int j, double bnd)
       {  /* the simplex solver failed */
          degrad = 0.0;
       }
+#if 0 /* 16/X-2026 */
       /* delete the copy of P */
       glp_delete_prob(lp);
+#else
+      *itc = lp->it_cnt - it_cnt;
+      /* restore original bounds and optimal basis */
+      ios_probe_restore(prb);
+#endif
       return degrad;
 }
 
@@ -533,11 +655,169 @@ void ios_pcost_free(glp_tree *tree)
       xfree(csa->dn_sum);
       xfree(csa->up_cnt);
       xfree(csa->up_sum);
+#if 1 /* 16/X-2026 */
+      xfree(csa->dn_deg);
+      xfree(csa->up_deg);
+#endif
+#if 1 /* 17/X-2026 */
+      if (csa->prb != NULL)
+         ios_probe_free(csa->prb);
+      xfree(csa->dn_itc);
+      xfree(csa->up_itc);
+#endif
       xfree(csa);
       tree->pcost = NULL;
       return;
 }
 
+#if 1 /* 16/X-2026 */
+struct sbw
+{     /* working area used on parallel strong branching */
+      glp_tree *T;
+      /* branch-and-bound tree */
+      int cnt;
+      /* number of degradations to be computed */
+      int *ind; /* int ind[1+cnt]; */
+      /* ind[k] = +j means down-branch of x[j], ind[k] = -j means
+         up-branch of x[j] */
+      void *lock;
+      /* mutex to protect the following field */
+      int next;
+      /* number of degradations computed or being computed */
+};
+
+static void sb_func(void *info, int t)
+{     /* routine run by each thread */
+      struct sbw *sbw = info;
+      glp_prob *P = sbw->T->mip, *lp = NULL;
+      struct csa *csa = sbw->T->pcost;
+      IOSPRB *prb = NULL;
+      int j, k;
+      double beta;
+      xassert(0 <= t && t < sbw->T->parm->threads);
+      for (;;)
+      {  /* pull next branch to be evaluated */
+         mutex_lock(sbw->lock);
+         k = ++(sbw->next);
+         mutex_unlock(sbw->lock);
+         if (k > sbw->cnt)
+            break;
+         /* create a private copy of P on the first pass */
+         if (lp == NULL)
+         {  lp = glp_create_prob();
+            ios_probe_copy(lp, P);
+            prb = ios_probe_init(lp);
+         }
+         /* compute degradation of the objective */
+         j = sbw->ind[k];
+         if (j > 0)
+         {  beta = P->col[j]->prim;
+            csa->dn_deg[j] = solve_degrad(prb, lp, j, floor(beta),
+               &csa->dn_itc[j]);
+         }
+         else
+         {  j = -j;
+            beta = P->col[j]->prim;
+            csa->up_deg[j] = solve_degrad(prb, lp, j, ceil(beta),
+               &csa->up_itc[j]);
+         }
+         /* the optimal basis and its fresh factorization have been
+            restored by the probe, so the result does not depend on
+            the order, in which branches are evaluated */
+      }
+      if (lp != NULL)
+      {  ios_probe_free(prb);
+         glp_delete_prob(lp);
+      }
+      return;
+}
+
+static void sb_eval(glp_tree *T)
+{     /* compute degradations for all uninitialized pseudocosts of all
+         branching candidates in parallel */
+      struct csa *csa = T->pcost;
+      struct sbw _sbw, *sbw = &_sbw;
+      int j;
+      /* the current basis must be optimal */
+      xassert(glp_get_status(T->mip) == GLP_OPT);
+      sbw->T = T;
+      sbw->ind = talloc(1+2*T->n, int);
+      sbw->cnt = 0;
+#if 1 /* 17/X-2026 */
+      /* nothing can be computed if strong branching iteration limits
+         have been exhausted */
+      if (csa->nd_lim == 0 || T->sb_itc >= csa->it_lim)
+         goto skip;
+#endif
+      for (j = 1; j <= T->n; j++)
+      {  if (!glp_ios_can_branch(T, j)) continue;
+#if 0 /* 17/X-2026 */
+         if (csa->dn_cnt[j] == 0)
+            sbw->ind[++(sbw->cnt)] = +j;
+         if (csa->up_cnt[j] == 0)
+            sbw->ind[++(sbw->cnt)] = -j;
+#else
+         if (csa->dn_cnt[j] < csa->rel_min)
+            sbw->ind[++(sbw->cnt)] = +j;
+         if (csa->up_cnt[j] < csa->rel_min)
+            sbw->ind[++(sbw->cnt)] = -j;
+#endif
+      }
+      /* it makes no sense to run threads for a few branches */
+      if (sbw->cnt >= 2)
+      {  sbw->lock = mutex_create();
+         sbw->next = 0;
+         thread_run(T->parm->threads, sb_func, sbw);
+         mutex_delete(sbw->lock);
+      }
+#if 1 /* 17/X-2026 */
+skip:
+#endif
+      tfree(sbw->ind);
+      return;
+}
+#endif
+
+#if 1 /* 17/X-2026 */
+static int sb_allowed(glp_tree *T)
+{     /* check if strong branching iteration limits allow computing one
+         more degradation */
+      struct csa *csa = T->pcost;
+      return csa->nd_itc < csa->nd_lim && T->sb_itc < csa->it_lim;
+}
+
+static double strong_degrad(glp_tree *T, int j, int brnch)
+{     /* compute degradation of the objective for down- or up-branch of
+         x[j] with strong branching */
+      struct csa *csa = T->pcost;
+      int itc;
+      double beta, degrad;
+      beta = T->mip->col[j]->prim;
+      if (brnch == GLP_DN_BRNCH)
+      {  if (csa->dn_deg[j] >= 0.0)
+            degrad = csa->dn_deg[j], itc = csa->dn_itc[j];
+         else
+            degrad = eval_degrad(T, j, floor(beta), &itc);
+      }
+      else
+      {  if (csa->up_deg[j] >= 0.0)
+            degrad = csa->up_deg[j], itc = csa->up_itc[j];
+         else
+            degrad = eval_degrad(T, j, ceil(beta), &itc);
+      }
+      /* update strong branching statistics */
+      T->sb_cnt++;
+      /* the total iteration count saturates to avoid overflow */
+      if (T->sb_itc <= INT_MAX - itc)
+         T->sb_itc += itc;
+      else
+         T->sb_itc = INT_MAX;
+      csa->nd_itc += itc;
+      return degrad;
+}
+#endif
+
+#if 0 /* 17/X-2026 */
 static double eval_psi(glp_tree *T, int j, int brnch)
 {     /* compute estimation of pseudocost of variable x[j] for down-
          or up-branch */
@@ -550,7 +830,14 @@ static double eval_psi(glp_tree *T, int j, int brnch)
          if (csa->dn_cnt[j] == 0)
          {  /* initialize down pseudocost */
             beta = T->mip->col[j]->prim;
+#if 0 /* 16/X-2026 */
             degrad = eval_degrad(T->mip, j, floor(beta));
+#else
+            if (csa->dn_deg[j] >= 0.0)
+               degrad = csa->dn_deg[j];
+            else
+               degrad = eval_degrad(T, j, floor(beta));
+#endif
             if (degrad == DBL_MAX)
             {  psi = DBL_MAX;
                goto done;
@@ -565,7 +852,14 @@ static double eval_psi(glp_tree *T, int j, int brnch)
          if (csa->up_cnt[j] == 0)
          {  /* initialize up pseudocost */
             beta = T->mip->col[j]->prim;
+#if 0 /* 16/X-2026 */
             degrad = eval_degrad(T->mip, j, ceil(beta));
+#else
+            if (csa->up_deg[j] >= 0.0)
+               degrad = csa->up_deg[j];
+            else
+               degrad = eval_degrad(T, j, ceil(beta));
+#endif
             if (degrad == DBL_MAX)
             {  psi = DBL_MAX;
                goto done;
@@ -579,6 +873,78 @@ static double eval_psi(glp_tree *T, int j, int brnch)
          xassert(brnch != brnch);
 done: return psi;
 }
+#else
+static double eval_psi(glp_tree *T, int j, int brnch)
+{     /* compute estimation of pseudocost of variable x[j] for down-
+         or up-branch */
+      struct csa *csa = T->pcost;
+      double beta, degrad, psi;
+      xassert(csa != NULL);
+      xassert(1 <= j && j <= T->n);
+      beta = T->mip->col[j]->prim;
+      if (brnch == GLP_DN_BRNCH)
+      {  /* down-branch */
+         if (csa->dn_cnt[j] < csa->rel_min && sb_allowed(T))
+         {  /* down pseudocost is unreliable; add one more observation
+               obtained with strong branching */
+            degrad = strong_degrad(T, j, GLP_DN_BRNCH);
+            if (degrad == DBL_MAX)
+            {  psi = DBL_MAX;
+               goto done;
+            }
+            csa->dn_cnt[j]++;
+            csa->dn_sum[j] += degrad / (beta - floor(beta));
+         }
+         if (csa->dn_cnt[j] == 0)
+            psi = csa->dn_avg;
+         else
+            psi = csa->dn_sum[j] / (double)csa->dn_cnt[j];
+      }
+      else if (brnch == GLP_UP_BRNCH)
+      {  /* up-branch */
+         if (csa->up_cnt[j] < csa->rel_min && sb_allowed(T))
+         {  /* up pseudocost is unreliable; add one more observation
+               obtained with strong branching */
+            degrad = strong_degrad(T, j, GLP_UP_BRNCH);
+            if (degrad == DBL_MAX)
+            {  psi = DBL_MAX;
+               goto done;
+            }
+            csa->up_cnt[j]++;
+            csa->up_sum[j] += degrad / (ceil(beta) - beta);
+         }
+         if (csa->up_cnt[j] == 0)
+            psi = csa->up_avg;
+         else
+            psi = csa->up_sum[j] / (double)csa->up_cnt[j];
+      }
+      else
+         xassert(brnch != brnch);
+done: return psi;
+}
+
+static void eval_avg(glp_tree *T)
+{     /* compute average pseudocosts */
+      struct csa *csa = T->pcost;
+      int j, dn_nv = 0, up_nv = 0;
+      double dn_sum = 0.0, up_sum = 0.0;
+      for (j = 1; j <= T->n; j++)
+      {  if (csa->dn_cnt[j] > 0)
+         {  dn_nv++;
+            dn_sum += csa->dn_sum[j] / (double)csa->dn_cnt[j];
+         }
+         if (csa->up_cnt[j] > 0)
+         {  up_nv++;
+            up_sum += csa->up_sum[j] / (double)csa->up_cnt[j];
+         }
+      }
+      /* if no pseudocost is initialized, all variables are considered
+         as equivalent */
+      csa->dn_avg = (dn_nv == 0 ? 1.0 : dn_sum / (double)dn_nv);
+      csa->up_avg = (up_nv == 0 ? 1.0 : up_sum / (double)up_nv);
+      return;
+}
+#endif
 
 static void progress(glp_tree *T)
 {     /* display progress of pseudocost initialization */
@@ -607,6 +973,17 @@ int ios_pcost_branch(glp_tree *T, int *_next)
       /* initialize the working arrays */
       if (T->pcost == NULL)
          T->pcost = ios_pcost_init(T);
+#if 1 /* 17/X-2026 */
+      /* start counting strong branching iterations for the current
+         subproblem */
+      ((struct csa *)T->pcost)->nd_itc = 0;
+      eval_avg(T);
+#endif
+#if 1 /* 16/X-2026 */
+      /* initialize pseudocosts with parallel strong branching */
+      if (T->parm->threads > 1 && T->parm->sb_par == GLP_ON)
+         sb_eval(T);
+#endif
       /* nothing has been chosen so far */
       jjj = 0, dmax = -1.0;
       /* go through the list of branching candidates */
@@ -657,7 +1034,21 @@ int ios_pcost_branch(glp_tree *T, int *_next)
             fractional value */
          jjj = branch_mostf(T, &sel);
       }
-done: *_next = sel;
+done:
+#if 1 /* 16/X-2026 */
+      /* degradations computed in advance are valid only for the
+         current subproblem */
+      {  struct csa *csa = T->pcost;
+         for (j = 1; j <= T->n; j++)
+            csa->dn_deg[j] = csa->up_deg[j] = -1.0;
+#if 1 /* 17/X-2026 */
+         /* the probe is valid only for the current subproblem */
+         if (csa->prb != NULL)
+            ios_probe_free(csa->prb), csa->prb = NULL;
+#endif
+      }
+#endif
+      *_next = sel;
       return jjj;
 }
 
@@ -84,6 +84,12 @@ int ios_choose_node(glp_tree *T)
 static int most_feas(glp_tree *T)
 {     /* select subproblem whose parent has minimal sum of integer
          infeasibilities */
+#if 1 /* 17/X-2026 */
+      IOSNPD *node;
+      node = ios_pq_estim(T);
+      xassert(node != NULL && node->up != NULL);
+      return node->p;
+#else
       IOSNPD *node;
       int p;
       double best;
@@ -94,10 +100,19 @@ static int most_feas(glp_tree *T)
             p = node->p, best = node->up->ii_sum;
       }
       return p;
+#endif
 }
 
 static int best_proj(glp_tree *T)
 {     /* select subproblem using the best projection heuristic */
+#if 1 /* 17/X-2026 */
+      IOSNPD *node;
+      /* the global bound must exist */
+      xassert(T->mip->mip_stat == GLP_FEAS);
+      node = ios_pq_estim(T);
+      xassert(node != NULL && node->up != NULL);
+      return node->p;
+#else
       IOSNPD *root, *node;
       int p;
       double best, deg, obj;
@@ -124,10 +139,54 @@ static int best_proj(glp_tree *T)
          if (best > obj) p = node->p, best = obj;
       }
       return p;
+#endif
 }
 
 static int best_node(glp_tree *T)
 {     /* select subproblem with best local bound */
+#if 1 /* 17/X-2026 */
+      /* among subproblems whose local bounds are within a small
+         tolerance from the best one choose the subproblem, whose
+         parent has minimal sum of integer infeasibilities, and if
+         there are several such subproblems, the oldest one; since keys
+         in the heap bnd_pq are never better than local bounds, and
+         keys of descendants of a subproblem in the heap are not better
+         than its key, only a few top subproblems have to be visited */
+      IOSNPD **pq = T->bnd_pq, *node, *best = NULL;
+      int *stack, top, pos;
+      double bound, eps;
+      node = ios_pq_bound(T);
+      xassert(node != NULL);
+      /* now the subproblem at the top of the heap has the best local
+         bound over all active subproblems */
+      bound = node->bound;
+      eps = 1e-10 * (1.0 + fabs(bound));
+      stack = talloc(1+T->pq_cnt, int);
+      top = 0;
+      stack[++top] = 1;
+      while (top > 0)
+      {  pos = stack[top--];
+         node = pq[pos];
+         /* skip the subproblem along with its descendants in the heap,
+            if its key is out of tolerance */
+         if (T->mip->dir == GLP_MIN ? node->bnd_key > bound + eps :
+            node->bnd_key < bound - eps) continue;
+         if (T->mip->dir == GLP_MIN ? node->bound <= bound + eps :
+            node->bound >= bound - eps)
+         {  xassert(node->up != NULL);
+            if (best == NULL || best->up->ii_sum > node->up->ii_sum ||
+               (best->up->ii_sum == node->up->ii_sum &&
+                best->seq > node->seq)) best = node;
+         }
+         if (2 * pos <= T->pq_cnt)
+            stack[++top] = 2 * pos;
+         if (2 * pos + 1 <= T->pq_cnt)
+            stack[++top] = 2 * pos + 1;
+      }
+      tfree(stack);
+      xassert(best != NULL);
+      return best->p;
+#else
       IOSNPD *node, *best = NULL;
       double bound, eps;
       switch (T->mip->dir)
@@ -172,6 +231,310 @@ static int best_node(glp_tree *T)
       }
       xassert(best != NULL);
       return best->p;
+#endif
+}
+
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  Active subproblems are kept in two binary heaps (priority queues).
+*
+*  The heap bnd_pq is ordered by local bounds of subproblems. Among
+*  subproblems having the same local bound a subproblem, whose parent
+*  has smaller sum of integer infeasibilities, precedes others, and
+*  if the sums are also the same, the subproblems are ordered by their
+*  creation. Since the local bound of a subproblem may be made stronger
+*  after the subproblem has been added to the heap (in particular, on
+*  solving its LP relaxation), the heap is ordered by keys bnd_key,
+*  which may be weaker than actual bounds. Such keys are corrected only
+*  when the subproblem appears at the top of the heap, because this
+*  cannot break the heap order.
+*
+*  The heap est_pq is ordered by estimates used by the best projection
+*  heuristic. Estimates of all subproblems depend on the best known
+*  integer feasible solution, so the heap is rebuilt every time this
+*  solution is improved. */
+
+static int bnd_less(glp_tree *T, IOSNPD *a, IOSNPD *b)
+{     /* check if subproblem a precedes subproblem b in bnd_pq */
+      double sa, sb;
+      if (a->bnd_key != b->bnd_key)
+      {  if (T->mip->dir == GLP_MIN)
+            return a->bnd_key < b->bnd_key;
+         else
+            return a->bnd_key > b->bnd_key;
+      }
+      sa = (a->up == NULL ? 0.0 : a->up->ii_sum);
+      sb = (b->up == NULL ? 0.0 : b->up->ii_sum);
+      if (sa != sb)
+         return sa < sb;
+      return a->seq < b->seq;
+}
+
+static int est_less(IOSNPD *a, IOSNPD *b)
+{     /* check if subproblem a precedes subproblem b in est_pq */
+      if (a->est_key != b->est_key)
+         return a->est_key < b->est_key;
+      return a->seq < b->seq;
+}
+
+static void bnd_move(glp_tree *T, int pos)
+{     /* restore heap order of bnd_pq after changing key of subproblem
+         placed at position pos */
+      IOSNPD **pq = T->bnd_pq, *node = pq[pos];
+      int cnt = T->pq_cnt, k;
+      /* sift the subproblem up */
+      while (pos > 1 && bnd_less(T, node, pq[pos / 2]))
+      {  pq[pos] = pq[pos / 2];
+         pq[pos]->bnd_pos = pos;
+         pos /= 2;
+      }
+      /* sift the subproblem down */
+      for (;;)
+      {  k = 2 * pos;
+         if (k > cnt) break;
+         if (k < cnt && bnd_less(T, pq[k+1], pq[k])) k++;
+         if (!bnd_less(T, pq[k], node)) break;
+         pq[pos] = pq[k];
+         pq[pos]->bnd_pos = pos;
+         pos = k;
+      }
+      pq[pos] = node;
+      node->bnd_pos = pos;
+      return;
+}
+
+static void est_move(glp_tree *T, int pos)
+{     /* restore heap order of est_pq after changing key of subproblem
+         placed at position pos */
+      IOSNPD **pq = T->est_pq, *node = pq[pos];
+      int cnt = T->pq_cnt, k;
+      while (pos > 1 && est_less(node, pq[pos / 2]))
+      {  pq[pos] = pq[pos / 2];
+         pq[pos]->est_pos = pos;
+         pos /= 2;
+      }
+      for (;;)
+      {  k = 2 * pos;
+         if (k > cnt) break;
+         if (k < cnt && est_less(pq[k+1], pq[k])) k++;
+         if (!est_less(pq[k], node)) break;
+         pq[pos] = pq[k];
+         pq[pos]->est_pos = pos;
+         pos = k;
+      }
+      pq[pos] = node;
+      node->est_pos = pos;
+      return;
+}
+
+static double est_key(glp_tree *T, IOSNPD *node)
+{     /* compute estimate of active subproblem */
+      double obj;
+      if (node->up == NULL)
+      {  /* the root subproblem is never selected by the heuristic */
+         return 0.0;
+      }
+      if (T->est_type == 0)
+      {  /* sum of integer infeasibilities of the parent */
+         return node->up->ii_sum;
+      }
+      /* obj estimates optimal objective value if the sum of integer
+         infeasibilities were zero */
+      obj = node->up->bound + T->est_deg * node->up->ii_sum;
+      if (T->mip->dir == GLP_MAX) obj = - obj;
+      return obj;
+}
+
+/***********************************************************************
+*  ios_pq_add - add active subproblem to priority queues
+*
+*  This routine adds a new active subproblem to the priority queues.
+*  It is called on creating the subproblem. */
+
+void ios_pq_add(glp_tree *T, IOSNPD *node)
+{     if (T->pq_cnt == T->pq_max)
+      {  /* enlarge the heaps */
+         int pq_max = T->pq_max;
+         IOSNPD **bnd_pq = T->bnd_pq, **est_pq = T->est_pq;
+         T->pq_max = (pq_max == 0 ? 64 : pq_max + pq_max);
+         T->bnd_pq = xcalloc(1+T->pq_max, sizeof(IOSNPD *));
+         T->est_pq = xcalloc(1+T->pq_max, sizeof(IOSNPD *));
+         if (pq_max != 0)
+         {  memcpy(&T->bnd_pq[1], &bnd_pq[1], pq_max *
+               sizeof(IOSNPD *));
+            memcpy(&T->est_pq[1], &est_pq[1], pq_max *
+               sizeof(IOSNPD *));
+            xfree(bnd_pq);
+            xfree(est_pq);
+         }
+      }
+      T->pq_cnt++;
+      node->bnd_key = node->bound;
+      T->bnd_pq[T->pq_cnt] = node;
+      bnd_move(T, T->pq_cnt);
+      if (T->parm->bt_tech == GLP_BT_BPH)
+      {  node->est_key = est_key(T, node);
+         T->est_pq[T->pq_cnt] = node;
+         est_move(T, T->pq_cnt);
+      }
+      else
+         node->est_pos = 0;
+      return;
+}
+
+/***********************************************************************
+*  ios_pq_del - remove active subproblem from priority queues
+*
+*  This routine removes an active subproblem from the priority queues.
+*  It is called when the subproblem becomes inactive or is deleted. */
+
+void ios_pq_del(glp_tree *T, IOSNPD *node)
+{     int pos, cnt = T->pq_cnt;
+      xassert(cnt > 0);
+      pos = node->bnd_pos;
+      xassert(1 <= pos && pos <= cnt && T->bnd_pq[pos] == node);
+      T->pq_cnt--;
+      if (pos < cnt)
+      {  T->bnd_pq[pos] = T->bnd_pq[cnt];
+         bnd_move(T, pos);
+      }
+      if (T->parm->bt_tech == GLP_BT_BPH)
+      {  pos = node->est_pos;
+         xassert(1 <= pos && pos <= cnt && T->est_pq[pos] == node);
+         if (pos < cnt)
+         {  T->est_pq[pos] = T->est_pq[cnt];
+            est_move(T, pos);
+         }
+      }
+      node->bnd_pos = node->est_pos = 0;
+      return;
+}
+
+/***********************************************************************
+*  ios_pq_bound - find active subproblem with best local bound
+*
+*  This routine returns a pointer to an active subproblem, which has
+*  the best local bound, or NULL, if the tree is empty. If there are
+*  several such subproblems, the routine chooses the subproblem, whose
+*  parent has minimal sum of integer infeasibilities. */
+
+IOSNPD *ios_pq_bound(glp_tree *T)
+{     IOSNPD *node;
+      if (T->pq_cnt == 0)
+         return NULL;
+      for (;;)
+      {  node = T->bnd_pq[1];
+         if (node->bnd_key == node->bound)
+            break;
+         /* the local bound has been made stronger, so the subproblem
+            should be moved down */
+         if (T->mip->dir == GLP_MIN)
+            xassert(node->bnd_key < node->bound);
+         else
+            xassert(node->bnd_key > node->bound);
+         node->bnd_key = node->bound;
+         bnd_move(T, 1);
+      }
+      return node;
 }
 
+/***********************************************************************
+*  ios_pq_estim - find active subproblem with best estimate
+*
+*  This routine returns a pointer to an active subproblem, which has
+*  the best estimate used by the best projection heuristic, or NULL, if
+*  the tree is empty. If an integer feasible solution has not been
+*  found yet, the estimate is the sum of integer infeasibilities of the
+*  parent subproblem. */
+
+IOSNPD *ios_pq_estim(glp_tree *T)
+{     IOSNPD *root;
+      int type, k;
+      double deg;
+      xassert(T->parm->bt_tech == GLP_BT_BPH);
+      if (T->pq_cnt == 0)
+         return NULL;
+      /* determine parameters of estimates */
+      if (T->mip->mip_stat != GLP_FEAS)
+         type = 0, deg = 0.0;
+      else
+      {  /* obtain pointer to the root node, which must exist */
+         root = T->slot[1].node;
+         xassert(root != NULL);
+         /* deg estimates degradation of the objective function per
+            unit of the sum of integer infeasibilities */
+         xassert(root->ii_sum > 0.0);
+         type = 1;
+         deg = (T->mip->mip_obj - root->bound) / root->ii_sum;
+      }
+      if (!(T->est_type == type && T->est_deg == deg))
+      {  /* estimates have been changed; rebuild the heap */
+         T->est_type = type;
+         T->est_deg = deg;
+         for (k = 1; k <= T->pq_cnt; k++)
+            T->est_pq[k]->est_key = est_key(T, T->est_pq[k]);
+         for (k = T->pq_cnt / 2; k >= 1; k--)
+            est_move(T, k);
+      }
+      return T->est_pq[1];
+}
+
+/***********************************************************************
+*  ios_pq_top - list active subproblems having best local bounds
+*
+*  This routine stores to locations list[1], ..., list[cnt] pointers to
+*  cnt <= max_cnt active subproblems having best local bounds in order
+*  of the heap bnd_pq. Subproblems, whose LP relaxations have been
+*  solved in advance, and the subproblem T->child are skipped.
+*
+*  The routine walks through the heap in best-first order with a small
+*  working heap of candidates, so its time does not depend on the total
+*  number of active subproblems. (Since keys of some subproblems may be
+*  weaker than their local bounds, the order is approximate.)
+*
+*  The routine returns cnt. */
+
+int ios_pq_top(glp_tree *T, int max_cnt, IOSNPD *list[])
+{     IOSNPD **pq = T->bnd_pq, *node;
+      int *cand, ncand, cnt = 0, pos, k, kk;
+      if (T->pq_cnt == 0 || max_cnt <= 0)
+         return 0;
+      /* correct the key of the subproblem at the top of the heap */
+      ios_pq_bound(T);
+      /* cand[1], ..., cand[ncand] are positions of candidates in the
+         heap bnd_pq organized as a heap; the number of candidates never
+         exceeds the number of subproblems visited plus one */
+      cand = talloc(1+T->pq_cnt, int);
+      ncand = 0;
+      cand[++ncand] = 1;
+      while (ncand > 0 && cnt < max_cnt)
+      {  /* pull the best candidate */
+         pos = cand[1];
+         kk = cand[ncand--];
+         for (k = 1;;)
+         {  int j = 2 * k;
+            if (j > ncand) break;
+            if (j < ncand && bnd_less(T, pq[cand[j+1]], pq[cand[j]]))
+               j++;
+            if (!bnd_less(T, pq[cand[j]], pq[kk])) break;
+            cand[k] = cand[j], k = j;
+         }
+         if (ncand > 0) cand[k] = kk;
+         node = pq[pos];
+         if (!(node->ahead || node->p == T->child))
+            list[++cnt] = node;
+         /* its children in bnd_pq become candidates */
+         for (kk = 2 * pos; kk <= 2 * pos + 1 && kk <= T->pq_cnt; kk++)
+         {  for (k = ++ncand; k > 1; k /= 2)
+            {  if (!bnd_less(T, pq[kk], pq[cand[k / 2]])) break;
+               cand[k] = cand[k / 2];
+            }
+            cand[k] = kk;
+         }
+      }
+      tfree(cand);
+      return cnt;
+}
+#endif
+
 /* eof */
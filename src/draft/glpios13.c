@@ -0,0 +1,548 @@
+/* glpios13.c (parallel node evaluation) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "env.h"
+#include "ios.h"
+
+/***********************************************************************
+*  The branch-and-bound tree, the incumbent solution, the cut pools and
+*  all calls to the callback routine are owned by the main thread, so
+*  the search remains strictly sequential. Parallelism is used only to
+*  solve, in advance, LP relaxations of active subproblems which are
+*  likely to be selected next. Each worker thread has its own copy of
+*  LP relaxation of the root subproblem, restores a subproblem on that
+*  copy using the change lists stored in the tree (which are read but
+*  never modified by the workers), and solves it with the dual simplex
+*  method. Results are then applied by the main thread in a fixed order
+*  that does not depend on thread scheduling:
+*
+*  a subproblem, whose LP relaxation has no primal feasible solution
+*  or has no solution better than the incumbent, is pruned;
+*
+*  otherwise, the optimal objective value improves the local bound of
+*  the subproblem, and the optimal basis replaces its status change
+*  list, so later the main thread re-optimizes it (usually in a few or
+*  no iterations) starting from that basis.
+*
+*  Since subproblems are pruned only on the same conditions as in the
+*  sequential search, the optimal objective value found does not depend
+*  on the number of threads used. */
+
+struct csa
+{     /* working area used on parallel node evaluation */
+      int nt;
+      /* number of threads */
+      glp_prob **lp; /* glp_prob *lp[nt]; */
+      /* lp[t], 0 <= t <= nt-1, is a private copy of LP relaxation of
+         the root subproblem used by t-th thread */
+      int root_m;
+      /* number of rows in the root subproblem */
+      int e_cnt;
+      /* number of subproblems evaluated */
+      int f_cnt;
+      /* number of subproblems pruned after evaluation */
+      int w_cnt;
+      /* number of subproblems provided with an optimal basis */
+      int it_cnt;
+      /* total number of simplex iterations made by all threads */
+};
+
+struct task
+{     /* subproblem evaluation task */
+      IOSNPD *node;
+      /* pointer to active subproblem to be evaluated */
+      int ret;
+      /* code returned by glp_simplex */
+      int p_stat, d_stat;
+      /* primal and dual statuses of basic solution */
+      double obj;
+      /* objective value of basic solution */
+      int len;
+      /* number of entries in the status change list; len < 0 means
+         the list is not built */
+      int *ind; /* int ind[1+len]; */
+      unsigned char *stat; /* uchar stat[1+len]; */
+      /* status change list for rows and columns of the parent
+         subproblem, which corresponds to the final basis */
+      int it_cnt;
+      /* number of simplex iterations made */
+};
+
+struct batch
+{     /* batch of tasks to be run in parallel */
+      glp_tree *T;
+      /* branch-and-bound tree */
+      struct csa *csa;
+      /* working area */
+      glp_smcp parm;
+      /* control parameters passed to glp_simplex */
+      int cnt;
+      /* number of tasks in the batch */
+      struct task *task; /* struct task task[cnt]; */
+      /* tasks */
+      void *lock;
+      /* mutex to protect the following field */
+      int next;
+      /* index of the next task to be run */
+};
+
+/***********************************************************************
+*  apply_changes - apply change lists of subproblem to LP copy
+*
+*  This routine changes types, bounds and statuses of rows and columns
+*  and adds new rows to LP relaxation of the parent subproblem lp in
+*  the same way as the routine ios_revive_node does. */
+
+static void apply_changes(glp_prob *lp, IOSNPD *node, int ind[],
+      double val[])
+{     int m = lp->m;
+      IOSBND *b;
+      IOSTAT *s;
+      IOSROW *r;
+      IOSAIJ *a;
+      int i, k, len;
+      for (k = 0; k < node->b_len; k++)
+      {  b = &node->b_ptr[k];
+         if (b->k <= m)
+            glp_set_row_bnds(lp, b->k, b->type, b->lb, b->ub);
+         else
+            glp_set_col_bnds(lp, b->k-m, b->type, b->lb, b->ub);
+      }
+      for (k = 0; k < node->s_len; k++)
+      {  s = &node->s_ptr[k];
+         if (s->k <= m)
+            glp_set_row_stat(lp, s->k, s->stat);
+         else
+            glp_set_col_stat(lp, s->k-m, s->stat);
+      }
+      for (r = node->r_ptr; r != NULL; r = r->next)
+      {  i = glp_add_rows(lp, 1);
+         glp_set_row_bnds(lp, i, r->type, r->lb, r->ub);
+         len = 0;
+         for (a = r->ptr; a != NULL; a = a->next)
+            len++, ind[len] = a->j, val[len] = a->val;
+         glp_set_mat_row(lp, i, len, ind, val);
+         glp_set_rii(lp, i, r->rii);
+         glp_set_row_stat(lp, i, r->stat);
+      }
+      return;
+}
+
+/***********************************************************************
+*  eval_node - solve LP relaxation of active subproblem
+*
+*  This routine restores LP relaxation of the subproblem specified in
+*  the task on the private copy lp of the root LP relaxation, solves it
+*  and stores results in the task. */
+
+static void eval_node(struct batch *bat, glp_prob *lp,
+      struct task *task)
+{     glp_tree *T = bat->T;
+      IOSNPD *node, **path;
+      int m = bat->csa->root_m, n = T->n;
+      int i, j, k, pred_m, cnt, *ind;
+      unsigned char *pred_stat;
+      double *val;
+      /* restore LP relaxation of the root subproblem */
+      if (lp->m > m)
+      {  int nrs = lp->m - m, *num;
+         num = talloc(1+nrs, int);
+         for (i = 1; i <= nrs; i++)
+            num[i] = m + i;
+         glp_del_rows(lp, nrs, num);
+         tfree(num);
+      }
+      xassert(lp->m == m);
+      for (i = 1; i <= m; i++)
+      {  glp_set_row_bnds(lp, i, T->root_type[i], T->root_lb[i],
+            T->root_ub[i]);
+         glp_set_row_stat(lp, i, T->root_stat[i]);
+      }
+      for (j = 1; j <= n; j++)
+      {  glp_set_col_bnds(lp, j, T->root_type[m+j], T->root_lb[m+j],
+            T->root_ub[m+j]);
+         glp_set_col_stat(lp, j, T->root_stat[m+j]);
+      }
+      /* build path from the specified subproblem to the root; note
+         that the field temp cannot be used here, since the tree is
+         shared by all threads */
+      node = task->node;
+      xassert(node->up != NULL);
+      path = talloc(1+node->level, IOSNPD *);
+      cnt = 0;
+      for (node = task->node; node->up != NULL; node = node->up)
+         path[++cnt] = node;
+      xassert(cnt == task->node->level);
+      /* go down from the root to the specified subproblem */
+      ind = talloc(1+n, int);
+      val = talloc(1+n, double);
+      pred_m = 0, pred_stat = NULL;
+      for (k = cnt; k >= 1; k--)
+      {  if (k == 1)
+         {  /* save statuses of rows and columns of the parent */
+            pred_m = lp->m;
+            pred_stat = talloc(1+pred_m+n, unsigned char);
+            for (i = 1; i <= pred_m; i++)
+               pred_stat[i] = (unsigned char)lp->row[i]->stat;
+            for (j = 1; j <= n; j++)
+               pred_stat[pred_m+j] = (unsigned char)lp->col[j]->stat;
+         }
+         apply_changes(lp, path[k], ind, val);
+      }
+      tfree(path);
+      tfree(ind);
+      tfree(val);
+      /* solve LP relaxation */
+      task->it_cnt = lp->it_cnt;
+      task->ret = glp_simplex(lp, &bat->parm);
+      if (task->ret == GLP_EFAIL)
+      {  /* retry with a new basis */
+         glp_adv_basis(lp, 0);
+         task->ret = glp_simplex(lp, &bat->parm);
+      }
+      task->it_cnt = lp->it_cnt - task->it_cnt;
+      task->p_stat = lp->pbs_stat;
+      task->d_stat = lp->dbs_stat;
+      task->obj = lp->obj_val;
+      /* build status change list for the final basis, if it is optimal
+         (if the subproblem has its own rows, their statuses are stored
+         in the row addition list, so the basis cannot be changed) */
+      task->len = -1;
+      if (task->ret == 0 && task->p_stat == GLP_FEAS &&
+          task->d_stat == GLP_FEAS && task->node->r_ptr == NULL)
+      {  xassert(lp->m == pred_m);
+         task->len = 0;
+         for (k = 1; k <= pred_m+n; k++)
+         {  if (k <= pred_m)
+               i = lp->row[k]->stat;
+            else
+               i = lp->col[k-pred_m]->stat;
+            if (pred_stat[k] != i)
+               task->len++;
+         }
+         task->ind = talloc(1+task->len, int);
+         task->stat = talloc(1+task->len, unsigned char);
+         task->len = 0;
+         for (k = 1; k <= pred_m+n; k++)
+         {  if (k <= pred_m)
+               i = lp->row[k]->stat;
+            else
+               i = lp->col[k-pred_m]->stat;
+            if (pred_stat[k] != i)
+            {  task->len++;
+               task->ind[task->len] = k;
+               task->stat[task->len] = (unsigned char)i;
+            }
+         }
+      }
+      tfree(pred_stat);
+      return;
+}
+
+/**********************************************************************/
+
+static void eval_func(void *info, int t)
+{     /* routine run by each thread */
+      struct batch *bat = info;
+      int k;
+      xassert(0 <= t && t < bat->csa->nt);
+      for (;;)
+      {  /* pull next task from the batch */
+         mutex_lock(bat->lock);
+         k = bat->next++;
+         mutex_unlock(bat->lock);
+         if (k >= bat->cnt)
+            break;
+         eval_node(bat, bat->csa->lp[t], &bat->task[k]);
+      }
+      return;
+}
+
+/***********************************************************************
+*  select_nodes - select active subproblems to be evaluated
+*
+*  This routine selects up to max_cnt active subproblems, which have
+*  not been evaluated yet and which are likely to be selected next by
+*  the search, and stores pointers to them in locations task[0], ...,
+*  task[cnt-1]. */
+
+static int select_nodes(glp_tree *T, int max_cnt, struct task task[])
+{     IOSNPD *node;
+      int k, cnt = 0;
+      /* the subproblem suggested by the branching heuristic goes
+         first */
+      if (T->child != 0)
+      {  node = T->slot[T->child].node;
+         xassert(node != NULL);
+         if (!node->ahead)
+            task[cnt++].node = node;
+      }
+      switch (T->parm->bt_tech)
+      {  case GLP_BT_DFS:
+            /* the most recently created subproblems */
+            for (node = T->tail; node != NULL && cnt < max_cnt;
+                  node = node->prev)
+            {  if (!node->ahead && node->p != T->child)
+                  task[cnt++].node = node;
+            }
+            break;
+         case GLP_BT_BFS:
+            /* the earliest created subproblems */
+            for (node = T->head; node != NULL && cnt < max_cnt;
+                  node = node->next)
+            {  if (!node->ahead && node->p != T->child)
+                  task[cnt++].node = node;
+            }
+            break;
+         case GLP_BT_BLB:
+         case GLP_BT_BPH:
+            /* subproblems with best local bounds taken from the
+               priority queue */
+            {  IOSNPD **list;
+               int len;
+               if (cnt < max_cnt)
+               {  list = talloc(1+max_cnt-cnt, IOSNPD *);
+                  len = ios_pq_top(T, max_cnt-cnt, list);
+                  for (k = 1; k <= len; k++)
+                     task[cnt++].node = list[k];
+                  tfree(list);
+               }
+            }
+            break;
+         default:
+            xassert(T != T);
+      }
+      return cnt;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_eval_nodes - solve LP relaxations of active subproblems in
+*  parallel
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_eval_nodes(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_eval_nodes selects a batch of active subproblems,
+*  which have not been evaluated yet and which are likely to be chosen
+*  next by the search, and solves their LP relaxations in parallel with
+*  T->parm->threads threads (see comments at the beginning of this
+*  file). Subproblems which are found to be infeasible or hopeless are
+*  removed from the tree.
+*
+*  The routine may be called only if the current subproblem does not
+*  exist and the root subproblem has been frozen. It does not call the
+*  callback routine. */
+
+void ios_eval_nodes(glp_tree *T)
+{     struct csa *csa = T->eval;
+      struct batch _bat, *bat = &_bat;
+      IOSNPD *node;
+      int k, t, tm_lim;
+      xassert(T->curr == NULL);
+      xassert(T->parm->threads > 1);
+      /* LP relaxation of the root subproblem must be known */
+      if (T->root_type == NULL)
+         goto done;
+      /* it makes no sense to evaluate the only active subproblem */
+      if (T->a_cnt < 2)
+         goto done;
+      /* determine the time left */
+      tm_lim = INT_MAX;
+      if (T->parm->tm_lim < INT_MAX)
+      {  tm_lim = T->parm->tm_lim - (glp_time() - T->tm_beg);
+         if (tm_lim <= 0)
+            goto done;
+      }
+      /* create working area on the first call */
+      if (csa == NULL)
+      {  T->eval = csa = talloc(1, struct csa);
+         csa->nt = T->parm->threads;
+         csa->lp = talloc(csa->nt, glp_prob *);
+         for (t = 0; t < csa->nt; t++)
+            csa->lp[t] = NULL;
+         csa->root_m = T->root_m;
+         csa->e_cnt = csa->f_cnt = csa->w_cnt = csa->it_cnt = 0;
+      }
+      xassert(csa->root_m == T->root_m);
+      /* select subproblems to be evaluated */
+      bat->task = talloc(2 * csa->nt, struct task);
+      bat->cnt = select_nodes(T, 2 * csa->nt, bat->task);
+      if (bat->cnt < 2)
+      {  tfree(bat->task);
+         goto done;
+      }
+      /* change lists of subproblems on the paths from the root to the
+         selected subproblems are read by the worker threads, so they
+         must be kept in memory */
+      for (k = 0; k < bat->cnt; k++)
+      {  for (node = bat->task[k].node; node != NULL; node = node->up)
+            ios_nf_fetch(T, node);
+      }
+      /* create private copies of the problem object (at this point it
+         may correspond to any frozen subproblem, so rows missing in the
+         root subproblem are removed from the copies by the routine
+         eval_node) */
+      xassert(T->mip->m >= T->root_m);
+      for (t = 0; t < csa->nt; t++)
+      {  if (csa->lp[t] == NULL)
+         {  csa->lp[t] = glp_create_prob();
+            glp_copy_prob(csa->lp[t], T->mip, GLP_OFF);
+         }
+      }
+      /* set control parameters for the dual simplex */
+      bat->T = T;
+      bat->csa = csa;
+      glp_init_smcp(&bat->parm);
+      bat->parm.msg_lev = GLP_MSG_OFF;
+      bat->parm.meth = GLP_DUALP;
+      if (T->parm->flip)
+         bat->parm.r_test = GLP_RT_FLIP;
+      bat->parm.tm_lim = tm_lim;
+      /* if the incumbent objective value is already known, use it to
+         prematurely terminate the dual simplex search */
+      if (T->mip->mip_stat == GLP_FEAS)
+      {  switch (T->mip->dir)
+         {  case GLP_MIN:
+               bat->parm.obj_ul = T->mip->mip_obj;
+               break;
+            case GLP_MAX:
+               bat->parm.obj_ll = T->mip->mip_obj;
+               break;
+            default:
+               xassert(T != T);
+         }
+      }
+      /* solve LP relaxations in parallel */
+      bat->lock = mutex_create();
+      bat->next = 0;
+      thread_run(csa->nt, eval_func, bat);
+      mutex_delete(bat->lock);
+      /* apply results in the order of tasks */
+      for (k = 0; k < bat->cnt; k++)
+      {  struct task *task = &bat->task[k];
+         node = task->node;
+         node->ahead = 1;
+         csa->e_cnt++;
+         csa->it_cnt += task->it_cnt;
+         if (!(task->ret == 0 || task->ret == GLP_EOBJLL ||
+               task->ret == GLP_EOBJUL))
+         {  /* evaluation failed; the subproblem will be solved by the
+               main thread as usual */
+            goto skip;
+         }
+         if (task->p_stat == GLP_NOFEAS)
+         {  /* LP relaxation has no primal feasible solution */
+            ios_delete_node(T, node->p);
+            csa->f_cnt++;
+            goto skip;
+         }
+         if (task->d_stat != GLP_FEAS)
+         {  /* should never happen */
+            goto skip;
+         }
+         /* objective value of dual feasible basic solution is a valid
+            local bound for the subproblem */
+         if (task->p_stat == GLP_FEAS)
+            node->lp_obj = task->obj;
+         if (T->mip->dir == GLP_MIN)
+         {  if (node->bound < task->obj)
+               node->bound = task->obj;
+         }
+         else
+         {  if (node->bound > task->obj)
+               node->bound = task->obj;
+         }
+         if (!ios_is_hopeful(T, node->bound))
+         {  /* the subproblem cannot have a better integer feasible
+               solution */
+            ios_delete_node(T, node->p);
+            csa->f_cnt++;
+            goto skip;
+         }
+         /* replace the status change list with the optimal basis */
+         if (task->len >= 0)
+         {  IOSTAT *s;
+            int i;
+            /* the subproblem has never been current, so the problem
+               object cannot correspond to it */
+            xassert(T->loaded != node);
+            s = ios_stat_list(T, node, task->len);
+            for (i = 1; i <= task->len; i++)
+            {  s[i-1].k = task->ind[i];
+               s[i-1].stat = task->stat[i];
+            }
+            csa->w_cnt++;
+         }
+skip:    if (task->len >= 0)
+         {  tfree(task->ind);
+            tfree(task->stat);
+         }
+      }
+      tfree(bat->task);
+      /* the subproblem suggested by the branching heuristic might be
+         pruned */
+      if (T->child != 0 && T->slot[T->child].node == NULL)
+         T->child = 0;
+done: return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_eval_free - free working area used on parallel node evaluation
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_eval_free(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_eval_free frees the working area used on parallel
+*  node evaluation. If the message level allows, it also displays some
+*  statistics. */
+
+void ios_eval_free(glp_tree *T)
+{     struct csa *csa = T->eval;
+      int t;
+      xassert(csa != NULL);
+      if (T->parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("Parallel node evaluation: %d threads, %d nodes evaluat"
+            "ed, %d pruned, %d warm-started, %d iterations\n", csa->nt,
+            csa->e_cnt, csa->f_cnt, csa->w_cnt, csa->it_cnt);
+      for (t = 0; t < csa->nt; t++)
+      {  if (csa->lp[t] != NULL)
+            glp_delete_prob(csa->lp[t]);
+      }
+      tfree(csa->lp);
+      tfree(csa);
+      T->eval = NULL;
+      return;
+}
+
+/* eof */
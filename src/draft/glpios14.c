@@ -0,0 +1,325 @@
+/* glpios14.c (probing LP relaxation in place) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "env.h"
+#include "ios.h"
+#include "spxlp.h"
+
+/***********************************************************************
+*  An LP probe is a tentative change of bounds of some columns of LP
+*  followed by a limited reoptimization with the dual simplex method.
+*  It is used by strong branching to estimate degradation of the
+*  objective, and may be used by other components of the solver (for
+*  example, probing and heuristics) to look at LP relaxation of a
+*  subproblem, which differs from the current one only in bounds.
+*
+*  The probe works on the problem object in place rather than on its
+*  copy. On creating the probe the current basis and basic solution of
+*  LP are saved along with pricing data kept in the simplex workspace.
+*  Each probe starts from the saved basis, so the dual simplex is warm
+*  started using the factorization of the basis matrix and the dual
+*  steepest edge weights computed on solving LP. On restoring the
+*  problem object original bounds, basis, and basic solution are
+*  reinstalled.
+*
+*  Every probe starts from a fresh factorization of the saved basis,
+*  which is computed on creating the probe, if the factorization is
+*  invalid or has been updated by the simplex solver, and recomputed on
+*  restoring the problem object, if the probe performed any simplex
+*  iterations. Therefore, the result of a probe depends neither on how
+*  the saved basis was reached nor on the order, in which the probes
+*  are made, and probing a copy of the problem object gives the same
+*  results as probing the original. */
+
+struct IOSPRB
+{     /* LP probe */
+      glp_prob *P;
+      /* problem object being probed */
+      int m, n;
+      /* number of rows and columns in the problem object */
+      int pbs_stat, dbs_stat;
+      /* saved statuses of primal and dual basic solution */
+      double obj_val;
+      /* saved objective value */
+      int it_cnt;
+      /* saved simplex iteration count */
+      int some;
+      /* saved ordinal number of variable having certain property */
+      int *stat; /* int stat[1+m+n]; */
+      /* stat[k], 1 <= k <= m+n, is saved status of k-th variable */
+      double *prim; /* double prim[1+m+n]; */
+      /* prim[k], 1 <= k <= m+n, is saved primal value of k-th
+         variable */
+      double *dual; /* double dual[1+m+n]; */
+      /* dual[k], 1 <= k <= m+n, is saved dual value of k-th
+         variable */
+      int nchg;
+      /* number of columns, whose bounds have been changed */
+      int *chg; /* int chg[1+n]; */
+      /* chg[1], ..., chg[nchg] are ordinal numbers of columns, whose
+         bounds have been changed */
+      int *type; /* int type[1+n]; */
+      /* type[j], 1 <= j <= n, is original type of j-th column, whose
+         bounds have been changed, or 0 if the bounds are original */
+      double *lb; /* double lb[1+n]; */
+      double *ub; /* double ub[1+n]; */
+      /* lb[j] and ub[j], 1 <= j <= n, are original bounds of j-th
+         column, whose bounds have been changed */
+      SPXWS *ws;
+      /* simplex workspace to keep a copy of pricing data; NULL means
+         that no pricing data were available on creating the probe */
+};
+
+/***********************************************************************
+*  ios_probe_init - create LP probe
+*
+*  This routine creates a probe for the problem object P and saves the
+*  current basis and basic solution of P. The basic solution must be
+*  optimal. If the factorization of the basis is invalid or has been
+*  updated, it is recomputed. */
+
+IOSPRB *ios_probe_init(glp_prob *P)
+{     IOSPRB *prb;
+      int m = P->m, n = P->n, i, j, ret;
+      xassert(glp_get_status(P) == GLP_OPT);
+      /* compute fresh factorization of the basis, if necessary */
+      if (!(P->valid && bfd_get_count(P->bfd) == 0))
+      {  ret = glp_factorize(P);
+         xassert(ret == 0);
+      }
+      prb = talloc(1, IOSPRB);
+      prb->P = P;
+      prb->m = m;
+      prb->n = n;
+      prb->stat = talloc(1+m+n, int);
+      prb->prim = talloc(1+m+n, double);
+      prb->dual = talloc(1+m+n, double);
+      prb->nchg = 0;
+      prb->chg = talloc(1+n, int);
+      prb->type = talloc(1+n, int);
+      prb->lb = talloc(1+n, double);
+      prb->ub = talloc(1+n, double);
+      for (j = 1; j <= n; j++)
+         prb->type[j] = 0;
+      prb->pbs_stat = P->pbs_stat;
+      prb->dbs_stat = P->dbs_stat;
+      prb->obj_val = P->obj_val;
+      prb->it_cnt = P->it_cnt;
+      prb->some = P->some;
+      for (i = 1; i <= m; i++)
+      {  GLPROW *row = P->row[i];
+         prb->stat[i] = row->stat;
+         prb->prim[i] = row->prim;
+         prb->dual[i] = row->dual;
+      }
+      for (j = 1; j <= n; j++)
+      {  GLPCOL *col = P->col[j];
+         prb->stat[m+j] = col->stat;
+         prb->prim[m+j] = col->prim;
+         prb->dual[m+j] = col->dual;
+      }
+      /* save pricing data computed on solving LP */
+      if (P->spx_ws != NULL && ((SPXWS *)P->spx_ws)->se_type != 0)
+      {  prb->ws = spx_create_ws();
+         spx_ws_copy_se(prb->ws, P->spx_ws);
+      }
+      else
+         prb->ws = NULL;
+      return prb;
+}
+
+/***********************************************************************
+*  ios_probe_bnds - change bounds of column for probing
+*
+*  This routine changes type and bounds of j-th column of the problem
+*  object being probed. The parameters type, lb, and ub have the same
+*  meaning as for the routine glp_set_col_bnds. Original bounds of the
+*  column are restored by the routine ios_probe_restore. */
+
+void ios_probe_bnds(IOSPRB *prb, int j, int type, double lb,
+      double ub)
+{     glp_prob *P = prb->P;
+      GLPCOL *col;
+      xassert(P->m == prb->m && P->n == prb->n);
+      xassert(1 <= j && j <= prb->n);
+      col = P->col[j];
+      if (prb->type[j] == 0)
+      {  /* save original bounds of x[j] */
+         prb->chg[++(prb->nchg)] = j;
+         prb->type[j] = col->type;
+         prb->lb[j] = col->lb;
+         prb->ub[j] = col->ub;
+      }
+      glp_set_col_bnds(P, j, type, lb, ub);
+      return;
+}
+
+/***********************************************************************
+*  ios_probe_solve - reoptimize LP with dual simplex
+*
+*  This routine reoptimizes LP with changed bounds starting from the
+*  saved basis with the dual simplex method, performing at most it_lim
+*  simplex iterations (it_lim = INT_MAX means no limit).
+*
+*  The routine returns the code reported by the routine glp_simplex.
+*  The resulting basic solution remains in the problem object until it
+*  is restored with the routine ios_probe_restore. */
+
+int ios_probe_solve(IOSPRB *prb, int it_lim)
+{     glp_prob *P = prb->P;
+      glp_smcp parm;
+      xassert(P->m == prb->m && P->n == prb->n);
+      /* reinstall pricing data saved for the original basis */
+      if (P->spx_ws != NULL)
+      {  if (prb->ws != NULL)
+            spx_ws_copy_se(P->spx_ws, prb->ws);
+         else
+            spx_ws_drop_se(P->spx_ws);
+      }
+      glp_init_smcp(&parm);
+      parm.msg_lev = GLP_MSG_OFF;
+      parm.meth = GLP_DUAL;
+      parm.it_lim = it_lim;
+      parm.out_dly = 1000;
+      return glp_simplex(P, &parm);
+}
+
+/***********************************************************************
+*  ios_probe_restore - restore LP to its saved state
+*
+*  This routine restores original bounds of all columns changed with
+*  the routine ios_probe_bnds as well as the basis, its factorization,
+*  and basic solution saved on creating the probe. The probe can then
+*  be used again. */
+
+void ios_probe_restore(IOSPRB *prb)
+{     glp_prob *P = prb->P;
+      int m = prb->m, n = prb->n, i, j, k, ret;
+      xassert(P->m == m && P->n == n);
+      /* restore original bounds */
+      for (k = 1; k <= prb->nchg; k++)
+      {  j = prb->chg[k];
+         glp_set_col_bnds(P, j, prb->type[j], prb->lb[j], prb->ub[j]);
+         prb->type[j] = 0;
+      }
+      prb->nchg = 0;
+      /* restore original basis; note that the factorization becomes
+         invalid only if the set of basic variables has changed */
+      for (i = 1; i <= m; i++)
+         glp_set_row_stat(P, i, prb->stat[i]);
+      for (j = 1; j <= n; j++)
+         glp_set_col_stat(P, j, prb->stat[m+j]);
+      if (!(P->valid && bfd_get_count(P->bfd) == 0))
+      {  /* the factorization is invalid or has been updated; the saved
+            basis was factorized, so it is non-singular */
+         ret = glp_factorize(P);
+         xassert(ret == 0);
+      }
+      /* restore original basic solution */
+      P->pbs_stat = prb->pbs_stat;
+      P->dbs_stat = prb->dbs_stat;
+      P->obj_val = prb->obj_val;
+      P->it_cnt = prb->it_cnt;
+      P->some = prb->some;
+      for (i = 1; i <= m; i++)
+      {  GLPROW *row = P->row[i];
+         row->prim = prb->prim[i];
+         row->dual = prb->dual[i];
+      }
+      for (j = 1; j <= n; j++)
+      {  GLPCOL *col = P->col[j];
+         col->prim = prb->prim[m+j];
+         col->dual = prb->dual[m+j];
+      }
+      /* restore pricing data */
+      if (P->spx_ws != NULL)
+      {  if (prb->ws != NULL)
+            spx_ws_copy_se(P->spx_ws, prb->ws);
+         else
+            spx_ws_drop_se(P->spx_ws);
+      }
+      return;
+}
+
+/***********************************************************************
+*  ios_probe_free - delete LP probe
+*
+*  This routine restores the problem object being probed (see the
+*  routine ios_probe_restore) and deletes the probe. */
+
+void ios_probe_free(IOSPRB *prb)
+{     ios_probe_restore(prb);
+      tfree(prb->stat);
+      tfree(prb->prim);
+      tfree(prb->dual);
+      tfree(prb->chg);
+      tfree(prb->type);
+      tfree(prb->lb);
+      tfree(prb->ub);
+      if (prb->ws != NULL)
+         spx_delete_ws(prb->ws);
+      tfree(prb);
+      return;
+}
+
+/***********************************************************************
+*  ios_probe_copy - copy problem object to be probed
+*
+*  This routine copies the problem object P (except symbolic names) to
+*  the problem object dest, so the copy can be probed instead of P, for
+*  example, in another thread.
+*
+*  The routine glp_copy_prob, which is used to make the copy, does not
+*  preserve the order of elements in the column lists of the constraint
+*  matrix. Since the simplex solver processes elements in that order,
+*  the results obtained for the copy may differ from ones for P due to
+*  round-off errors. Therefore, the column lists of the copy are then
+*  relinked to follow the same order as in P. */
+
+void ios_probe_copy(glp_prob *dest, glp_prob *P)
+{     GLPAIJ **ptr, *aij, *elem, *prev;
+      int j;
+      glp_copy_prob(dest, P, GLP_OFF);
+      ptr = talloc(1+P->m, GLPAIJ *);
+      for (j = 1; j <= P->n; j++)
+      {  for (aij = dest->col[j]->ptr; aij != NULL; aij = aij->c_next)
+            ptr[aij->row->i] = aij;
+         prev = NULL;
+         for (aij = P->col[j]->ptr; aij != NULL; aij = aij->c_next)
+         {  /* append element of the copy in the same row */
+            elem = ptr[aij->row->i];
+            xassert(elem->col == dest->col[j]);
+            elem->c_prev = prev;
+            if (prev == NULL)
+               dest->col[j]->ptr = elem;
+            else
+               prev->c_next = elem;
+            prev = elem;
+         }
+         if (prev != NULL)
+            prev->c_next = NULL;
+      }
+      tfree(ptr);
+      return;
+}
+
+/* eof */
@@ -0,0 +1,727 @@
+/* glpios15.c (node files) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "env.h"
+#include "ios.h"
+
+/***********************************************************************
+*  Most of memory used by a large branch-and-bound tree is occupied by
+*  change lists of subproblems. If their total size exceeds the limit
+*  specified by the control parameter nf_mem, change lists of some
+*  subproblems are written to node files and removed from memory until
+*  the total size is reduced to a half of the limit. Descriptors of the
+*  subproblems remain in the tree, so the search is not affected; once
+*  change lists written to a node file are needed (on reviving the
+*  subproblem or any of its descendants), they are read back.
+*
+*  Change lists, which were not used for the longest time, are written
+*  first. Change lists of subproblems on the path from the root to the
+*  subproblem, whose LP relaxation is kept in the problem object, are
+*  never written, because they are needed to go up the tree.
+*
+*  Change lists are written in batches, each batch to a separate node
+*  file compressed by the stream input/output routines (since its name
+*  ends with ".gz"). Because such file can only be read sequentially,
+*  all change lists stored in a node file are read back at once, after
+*  which the file is removed. To keep this cheap, the size of a batch
+*  is limited to a small fraction of nf_mem.
+*
+*  Names of node files include the current time, the identifier of the
+*  current process, and the number of the tree within the process, so
+*  different runs, which use the same directory, normally choose
+*  different names. Besides, each node file is created exclusively, so
+*  an existing file is never overwritten; if a node file with the same
+*  name already exists, no more node files are created. */
+
+struct nfile
+{     /* working area used on writing change lists to node files */
+      char *prefix;
+      /* prefix of node file names, including the directory */
+      char *fname;
+      /* buffer to build name of a node file */
+      int f_cnt;
+      /* number of node files created so far */
+      int f_max;
+      /* length of the array live (enlarged automatically) */
+      int *live; /* int live[1+f_max]; */
+      /* live[k], 1 <= k <= f_cnt, is the number of subproblems whose
+         change lists are stored in k-th node file; 0 means that the
+         file has been removed */
+      int fail;
+      /* flag set if writing a node file failed, in which case no more
+         node files are created */
+      int w_cnt;
+      /* number of change lists written to node files */
+      int r_cnt;
+      /* number of change lists read back from node files */
+      double w_size;
+      /* total size of change lists written, in bytes */
+};
+
+/***********************************************************************
+*  proc_id - determine identifier of the current process
+*
+*  create_file - create new empty file exclusively
+*
+*  The routine create_file creates a new empty file with specified name
+*  and returns zero. If the file already exists or cannot be created,
+*  the routine stores an error message and returns non-zero. */
+
+#if defined(HAVE_UNISTD_H)
+
+/* POSIX version ******************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+static int proc_id(void)
+{     return (int)getpid();
+}
+
+static int create_file(const char *fname)
+{     int fd;
+      fd = open(fname, O_WRONLY | O_CREAT | O_EXCL, 0600);
+      if (fd < 0)
+      {  put_err_msg(xstrerr(errno));
+         return 1;
+      }
+      close(fd);
+      return 0;
+}
+
+#elif defined(__WOE__)
+
+/* MS Windows version *************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#include <sys/stat.h>
+
+static int proc_id(void)
+{     return _getpid();
+}
+
+static int create_file(const char *fname)
+{     int fd;
+      fd = _open(fname, _O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY,
+         _S_IREAD | _S_IWRITE);
+      if (fd < 0)
+      {  put_err_msg(xstrerr(errno));
+         return 1;
+      }
+      _close(fd);
+      return 0;
+}
+
+#else
+
+/* ANSI version *******************************************************/
+
+#include <errno.h>
+
+static int proc_id(void)
+{     /* not available */
+      return 0;
+}
+
+static int create_file(const char *fname)
+{     /* exclusive creation is not available, so only check that the
+         file does not exist yet */
+      FILE *fp;
+      fp = fopen(fname, "rb");
+      if (fp != NULL)
+      {  fclose(fp);
+         put_err_msg("File exists");
+         return 1;
+      }
+      fp = fopen(fname, "wb");
+      if (fp == NULL)
+      {  put_err_msg(xstrerr(errno));
+         return 1;
+      }
+      fclose(fp);
+      return 0;
+}
+
+#endif
+
+static const char *file_name(struct nfile *nf, int k)
+{     /* build name of k-th node file */
+      sprintf(nf->fname, "%s%d.gz", nf->prefix, k);
+      return nf->fname;
+}
+
+static size_t node_size(IOSNPD *node)
+{     /* determine size of change lists of subproblem, in bytes */
+      IOSROW *r;
+      IOSAIJ *a;
+      size_t size;
+      size = node->b_len * sizeof(IOSBND) +
+             node->s_len * sizeof(IOSTAT);
+      for (r = node->r_ptr; r != NULL; r = r->next)
+      {  size += sizeof(IOSROW);
+         if (r->name != NULL)
+            size += strlen(r->name)+1;
+         for (a = r->ptr; a != NULL; a = a->next)
+            size += sizeof(IOSAIJ);
+      }
+      return size;
+}
+
+/***********************************************************************
+*  Each subproblem is stored in a node file as the following record:
+*
+*  p, b_len, s_len, r_cnt        (int)
+*  b_len times:
+*     k (int), type (uchar), lb, ub (double)
+*  s_len times:
+*     k (int), stat (uchar)
+*  r_cnt times:
+*     name length (int; 0 means no name), name characters,
+*     origin, klass, type, stat (uchar), lb, ub, rii (double),
+*     len (int), len times: j (int), val (double)
+*
+*  where p is the reference number of the subproblem. Since node files
+*  are only used by the same program that created them, values are
+*  written in internal (binary) representation. */
+
+static void put_int(glp_file *fp, int val)
+{     glp_write(fp, &val, sizeof(int));
+      return;
+}
+
+static void put_chr(glp_file *fp, int val)
+{     unsigned char chr = (unsigned char)val;
+      glp_write(fp, &chr, 1);
+      return;
+}
+
+static void put_dbl(glp_file *fp, double val)
+{     glp_write(fp, &val, sizeof(double));
+      return;
+}
+
+static int write_file(glp_tree *T, int k, int cnt, IOSNPD *list[])
+{     /* write change lists of subproblems list[1], ..., list[cnt] to
+         k-th node file; returns non-zero, if writing failed */
+      struct nfile *nf = T->nfile;
+      glp_file *fp;
+      IOSNPD *node;
+      IOSROW *r;
+      IOSAIJ *a;
+      int i, t, len, ret = 0;
+      /* create the node file exclusively to never overwrite a file,
+         which belongs to another run */
+      if (create_file(file_name(nf, k)) != 0)
+      {  xprintf("Unable to create node file '%s' - %s\n",
+            file_name(nf, k), get_err_msg());
+         ret = 1;
+         goto done;
+      }
+      fp = glp_open(file_name(nf, k), "w");
+      if (fp == NULL)
+      {  xprintf("Unable to create node file '%s' - %s\n",
+            file_name(nf, k), get_err_msg());
+         remove(file_name(nf, k));
+         ret = 1;
+         goto done;
+      }
+      for (i = 1; i <= cnt; i++)
+      {  node = list[i];
+         len = 0;
+         for (r = node->r_ptr; r != NULL; r = r->next)
+            len++;
+         put_int(fp, node->p);
+         put_int(fp, node->b_len);
+         put_int(fp, node->s_len);
+         put_int(fp, len);
+         for (t = 0; t < node->b_len; t++)
+         {  put_int(fp, node->b_ptr[t].k);
+            put_chr(fp, node->b_ptr[t].type);
+            put_dbl(fp, node->b_ptr[t].lb);
+            put_dbl(fp, node->b_ptr[t].ub);
+         }
+         for (t = 0; t < node->s_len; t++)
+         {  put_int(fp, node->s_ptr[t].k);
+            put_chr(fp, node->s_ptr[t].stat);
+         }
+         for (r = node->r_ptr; r != NULL; r = r->next)
+         {  if (r->name == NULL)
+               put_int(fp, 0);
+            else
+            {  put_int(fp, strlen(r->name));
+               glp_write(fp, r->name, strlen(r->name));
+            }
+            put_chr(fp, r->origin);
+            put_chr(fp, r->klass);
+            put_chr(fp, r->type);
+            put_chr(fp, r->stat);
+            put_dbl(fp, r->lb);
+            put_dbl(fp, r->ub);
+            put_dbl(fp, r->rii);
+            len = 0;
+            for (a = r->ptr; a != NULL; a = a->next)
+               len++;
+            put_int(fp, len);
+            for (a = r->ptr; a != NULL; a = a->next)
+            {  put_int(fp, a->j);
+               put_dbl(fp, a->val);
+            }
+         }
+      }
+      if (glp_ioerr(fp))
+      {  xprintf("Write error on node file '%s' - %s\n",
+            file_name(nf, k), get_err_msg());
+         glp_close(fp);
+         ret = 1;
+      }
+      else if (glp_close(fp) != 0)
+      {  xprintf("Write error on node file '%s' - %s\n",
+            file_name(nf, k), get_err_msg());
+         ret = 1;
+      }
+      if (ret)
+         remove(file_name(nf, k));
+done: return ret;
+}
+
+static void get(glp_tree *T, int k, glp_file *fp, void *buf, int len)
+{     /* read len bytes from k-th node file */
+      struct nfile *nf = T->nfile;
+      if (glp_read(fp, buf, len) != len)
+      {  if (glp_ioerr(fp))
+            xerror("Read error on node file '%s' - %s\n",
+               file_name(nf, k), get_err_msg());
+         else
+            xerror("Unexpected end of node file '%s'\n",
+               file_name(nf, k));
+      }
+      return;
+}
+
+static int get_int(glp_tree *T, int k, glp_file *fp)
+{     int val;
+      get(T, k, fp, &val, sizeof(int));
+      return val;
+}
+
+static int get_chr(glp_tree *T, int k, glp_file *fp)
+{     unsigned char chr;
+      get(T, k, fp, &chr, 1);
+      return chr;
+}
+
+static double get_dbl(glp_tree *T, int k, glp_file *fp)
+{     double val;
+      get(T, k, fp, &val, sizeof(double));
+      return val;
+}
+
+static void read_file(glp_tree *T, int k)
+{     /* read change lists stored in k-th node file back to memory and
+         remove the file; records for subproblems which have been
+         deleted from the tree are skipped */
+      struct nfile *nf = T->nfile;
+      glp_file *fp;
+      IOSNPD *node;
+      IOSBND *b;
+      IOSTAT *s;
+      IOSROW *r, *r_tail;
+      IOSAIJ *a, *a_tail;
+      char name[255+1];
+      int p, b_len, s_len, r_cnt, i, j, t, len, type, stat;
+      double lb, ub, val;
+      fp = glp_open(file_name(nf, k), "r");
+      if (fp == NULL)
+         xerror("Unable to open node file '%s' - %s\n",
+            file_name(nf, k), get_err_msg());
+      for (;;)
+      {  if (glp_read(fp, &p, sizeof(int)) != sizeof(int))
+         {  if (glp_ioerr(fp))
+               xerror("Read error on node file '%s' - %s\n",
+                  file_name(nf, k), get_err_msg());
+            break;
+         }
+         b_len = get_int(T, k, fp);
+         s_len = get_int(T, k, fp);
+         r_cnt = get_int(T, k, fp);
+         /* determine if the subproblem is still in the tree */
+         xassert(1 <= p && p <= T->nslots);
+         node = T->slot[p].node;
+         if (node != NULL && node->nf_ref == k)
+         {  node->nf_ref = 0;
+            xassert(nf->live[k] > 0);
+            nf->live[k]--;
+            nf->r_cnt++;
+         }
+         else
+            node = NULL;
+         /* bound change list */
+         b = (node == NULL ? NULL : ios_bnd_list(T, node, b_len));
+         for (t = 0; t < b_len; t++)
+         {  i = get_int(T, k, fp);
+            type = get_chr(T, k, fp);
+            lb = get_dbl(T, k, fp);
+            ub = get_dbl(T, k, fp);
+            if (b != NULL)
+            {  b[t].k = i;
+               b[t].type = (unsigned char)type;
+               b[t].lb = lb;
+               b[t].ub = ub;
+            }
+         }
+         /* status change list */
+         s = (node == NULL ? NULL : ios_stat_list(T, node, s_len));
+         for (t = 0; t < s_len; t++)
+         {  i = get_int(T, k, fp);
+            stat = get_chr(T, k, fp);
+            if (s != NULL)
+            {  s[t].k = i;
+               s[t].stat = (unsigned char)stat;
+            }
+         }
+         /* row addition list (the order of rows and their coefficients
+            is retained) */
+         r_tail = NULL;
+         for (i = 1; i <= r_cnt; i++)
+         {  len = get_int(T, k, fp);
+            xassert(0 <= len && len <= 255);
+            if (len > 0)
+               get(T, k, fp, name, len);
+            name[len] = '\0';
+            if (node == NULL)
+               r = NULL;
+            else
+            {  r = dmp_get_atom(T->pool, sizeof(IOSROW));
+               T->lst_size += sizeof(IOSROW);
+               if (len == 0)
+                  r->name = NULL;
+               else
+               {  r->name = dmp_get_atom(T->pool, len+1);
+                  strcpy(r->name, name);
+                  T->lst_size += len+1;
+               }
+               r->origin = (unsigned char)get_chr(T, k, fp);
+               r->klass = (unsigned char)get_chr(T, k, fp);
+               r->type = (unsigned char)get_chr(T, k, fp);
+               r->stat = (unsigned char)get_chr(T, k, fp);
+               r->lb = get_dbl(T, k, fp);
+               r->ub = get_dbl(T, k, fp);
+               r->rii = get_dbl(T, k, fp);
+               r->ptr = NULL;
+               r->next = NULL;
+               if (r_tail == NULL)
+               {  xassert(node->r_ptr == NULL);
+                  node->r_ptr = r;
+               }
+               else
+                  r_tail->next = r;
+               r_tail = r;
+            }
+            if (r == NULL)
+            {  /* skip row attributes */
+               for (t = 1; t <= 4; t++)
+                  get_chr(T, k, fp);
+               for (t = 1; t <= 3; t++)
+                  get_dbl(T, k, fp);
+            }
+            len = get_int(T, k, fp);
+            a_tail = NULL;
+            for (t = 1; t <= len; t++)
+            {  j = get_int(T, k, fp);
+               val = get_dbl(T, k, fp);
+               if (r != NULL)
+               {  a = dmp_get_atom(T->pool, sizeof(IOSAIJ));
+                  a->j = j;
+                  a->val = val;
+                  a->next = NULL;
+                  if (a_tail == NULL)
+                     r->ptr = a;
+                  else
+                     a_tail->next = a;
+                  a_tail = a;
+               }
+            }
+            if (r != NULL)
+               T->lst_size += len * sizeof(IOSAIJ);
+         }
+      }
+      glp_close(fp);
+      /* change lists of all subproblems remaining in the tree have been
+         read, so the node file is no longer needed */
+      xassert(nf->live[k] == 0);
+      remove(file_name(nf, k));
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_nf_spill - write change lists of subproblems to node files, if
+*  necessary
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_nf_spill(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_nf_spill checks if the total size of change lists of
+*  subproblems kept in memory exceeds the limit specified by the control
+*  parameter nf_mem, and if so, writes change lists of least recently
+*  used subproblems to node files and removes them from memory (see
+*  comments at the beginning of this file).
+*
+*  The routine may be called only if the current subproblem does not
+*  exist. */
+
+static int fcmp(const void *x1, const void *x2)
+{     /* compare subproblems by time of the last use */
+      const IOSNPD *n1 = *(IOSNPD * const *)x1;
+      const IOSNPD *n2 = *(IOSNPD * const *)x2;
+      if (n1->nf_use < n2->nf_use) return -1;
+      if (n1->nf_use > n2->nf_use) return +1;
+      if (n1->p < n2->p) return -1;
+      if (n1->p > n2->p) return +1;
+      return 0;
+}
+
+static int tree_cnt = 0;
+/* number of trees, which started writing node files in this process;
+   it is not protected by a lock, since node files are created
+   exclusively anyway */
+
+void ios_nf_spill(glp_tree *T)
+{     struct nfile *nf = T->nfile;
+      IOSNPD *node, **list;
+      char *mark;
+      double lim, cap, size;
+      int p, k, cnt, beg, end, t;
+      xassert(T->curr == NULL);
+      xassert(T->parm->nf_mem > 0);
+      lim = 1048576.0 * (double)T->parm->nf_mem;
+      if ((double)T->lst_size <= lim)
+         goto done;
+      /* create working area on the first call */
+      if (nf == NULL)
+      {  const char *dir = T->parm->nf_dir;
+         int len = (dir == NULL ? 0 : strlen(dir));
+         T->nfile = nf = talloc(1, struct nfile);
+         /* the current time, the process identifier, and the tree
+            number are used to make names of node files of different
+            runs distinct */
+         nf->prefix = talloc(len+60, char);
+         sprintf(nf->prefix, "%s%sglpnf%.0f_%d_%d_",
+            len == 0 ? "" : dir,
+            len == 0 || dir[len-1] == '/' || dir[len-1] == '\\' ?
+            "" : "/", fmod(xtime(), 1e9), proc_id(), ++tree_cnt);
+         nf->fname = talloc(strlen(nf->prefix)+20, char);
+         nf->f_cnt = nf->f_max = 0;
+         nf->live = NULL;
+         nf->fail = 0;
+         nf->w_cnt = nf->r_cnt = 0;
+         nf->w_size = 0.0;
+         if (T->parm->msg_lev >= GLP_MSG_ALL)
+            xprintf("Writing change lists of subproblems to node files"
+               " %s*.gz\n", nf->prefix);
+      }
+      if (nf->fail)
+         goto done;
+      /* mark subproblems on the path from the root to the subproblem
+         loaded */
+      mark = talloc(1+T->nslots, char);
+      memset(&mark[1], 0, T->nslots);
+      for (node = T->loaded; node != NULL; node = node->up)
+         mark[node->p] = 1;
+      /* build the list of subproblems whose change lists can be
+         written, in the order of their last use */
+      list = talloc(1+T->n_cnt, IOSNPD *);
+      cnt = 0;
+      for (p = 1; p <= T->nslots; p++)
+      {  node = T->slot[p].node;
+         if (node == NULL || mark[p] || node->nf_ref != 0)
+            continue;
+         if (node->b_len == 0 && node->s_len == 0 &&
+             node->r_ptr == NULL)
+            continue;
+         xassert(cnt < T->n_cnt);
+         list[++cnt] = node;
+      }
+      tfree(mark);
+      qsort(&list[1], cnt, sizeof(IOSNPD *), fcmp);
+      /* write change lists in batches until their total size kept in
+         memory is reduced to a half of the limit */
+      cap = lim / 16.0;
+      if (cap < 65536.0)
+         cap = 65536.0;
+      for (beg = 1; beg <= cnt; beg = end)
+      {  if ((double)T->lst_size <= 0.5 * lim)
+            break;
+         /* determine the next batch list[beg], ..., list[end-1] */
+         size = 0.0;
+         for (end = beg; end <= cnt; end++)
+         {  if (size >= cap ||
+                (double)T->lst_size - size <= 0.5 * lim)
+               break;
+            size += (double)node_size(list[end]);
+         }
+         /* obtain the number of node file for the batch */
+         k = nf->f_cnt + 1;
+         if (nf->f_max < k)
+         {  int f_max = nf->f_max, *live = nf->live;
+            nf->f_max = (f_max == 0 ? 100 : f_max + f_max);
+            nf->live = talloc(1+nf->f_max, int);
+            if (f_max != 0)
+            {  memcpy(&nf->live[1], &live[1], f_max * sizeof(int));
+               tfree(live);
+            }
+         }
+         /* write change lists to the node file */
+         if (write_file(T, k, end - beg, &list[beg-1]))
+         {  /* change lists remain in memory */
+            nf->fail = 1;
+            break;
+         }
+         nf->f_cnt = k;
+         nf->live[k] = end - beg;
+         /* and remove them from memory */
+         for (t = beg; t < end; t++)
+         {  node = list[t];
+            ios_bnd_list(T, node, 0);
+            ios_stat_list(T, node, 0);
+            ios_free_rows(T, node);
+            node->nf_ref = k;
+         }
+         nf->w_cnt += end - beg;
+         nf->w_size += size;
+         if (T->parm->msg_lev >= GLP_MSG_DBG)
+            xprintf("Change lists of %d subproblems (%.1f Mb) written t"
+               "o node file %d\n", end - beg, size / 1048576.0, k);
+      }
+      tfree(list);
+done: return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_nf_fetch - read change lists of subproblem from node file, if
+*  necessary
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_nf_fetch(glp_tree *T, IOSNPD *node);
+*
+*  DESCRIPTION
+*
+*  The routine ios_nf_fetch should be called before using change lists
+*  of the specified subproblem. If the change lists have been written to
+*  a node file, the routine reads them back along with change lists of
+*  all other subproblems stored in the same file. The routine also
+*  notes the time of the last use of the change lists. */
+
+void ios_nf_fetch(glp_tree *T, IOSNPD *node)
+{     node->nf_use = T->t_cnt;
+      if (node->nf_ref != 0)
+      {  read_file(T, node->nf_ref);
+         xassert(node->nf_ref == 0);
+      }
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_nf_drop - discard change lists of subproblem stored in node file
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_nf_drop(glp_tree *T, IOSNPD *node);
+*
+*  DESCRIPTION
+*
+*  The routine ios_nf_drop is called on deleting the specified
+*  subproblem, whose change lists have been written to a node file. If
+*  the node file does not contain other change lists, it is removed. */
+
+void ios_nf_drop(glp_tree *T, IOSNPD *node)
+{     struct nfile *nf = T->nfile;
+      int k = node->nf_ref;
+      xassert(nf != NULL);
+      xassert(1 <= k && k <= nf->f_cnt && nf->live[k] > 0);
+      node->nf_ref = 0;
+      nf->live[k]--;
+      if (nf->live[k] == 0)
+         remove(file_name(nf, k));
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_nf_free - delete all node files and free working area
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_nf_free(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_nf_free removes all node files, which still exist,
+*  and frees the working area used on writing change lists to node
+*  files. If the message level allows, it also displays some
+*  statistics. Note that change lists stored in node files are lost,
+*  so the routine may be called only on deleting the tree. */
+
+void ios_nf_free(glp_tree *T)
+{     struct nfile *nf = T->nfile;
+      int k;
+      xassert(nf != NULL);
+      if (T->parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("Node files: %d created, %d change lists written (%.1f"
+            " Mb), %d read back\n", nf->f_cnt, nf->w_cnt,
+            nf->w_size / 1048576.0, nf->r_cnt);
+      for (k = 1; k <= nf->f_cnt; k++)
+      {  if (nf->live[k] != 0)
+            remove(file_name(nf, k));
+      }
+      tfree(nf->prefix);
+      tfree(nf->fname);
+      if (nf->live != NULL)
+         tfree(nf->live);
+      tfree(nf);
+      T->nfile = NULL;
+      return;
+}
+
+/* eof */
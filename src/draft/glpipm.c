@@ -25,10 +25,33 @@
 #include "env.h"
 #include "glpipm.h"
 #include "glpmat.h"
+#if 1 /* 17/X-2026 */
+#include "spadat.h"
+#include "spchol.h"
+#endif
 
 #define ITER_MAX 100
 /* maximal number of iterations */
 
+#if 1 /* 17/X-2026 */
+#define DENSE_MIN 100
+/* column of A is considered as dense if it has more than DENSE_MIN
+   non-zeros and more than DENSE_AVG times average column count */
+
+#define DENSE_AVG 10.0
+
+#define DENSE_MAX 100
+/* maximal number of dense columns handled separately */
+
+#define DENSE_REG 1e-8
+/* relative regularization of sparse part of normal equation matrix
+   used when dense columns are handled separately */
+
+#define REFINE_MAX 20
+/* maximal number of conjugate gradient iterations on solving normal
+   equation system with dense columns */
+#endif
+
 struct csa
 {     /* common storage area */
       /*--------------------------------------------------------------*/
@@ -41,20 +64,58 @@ struct csa
       int *A_ind; /* int A_ind[A_ptr[m+1]]; */
       double *A_val; /* double A_val[A_ptr[m+1]]; */
       /* mxn-matrix A in storage-by-rows format */
+#if 1 /* 17/X-2026 */
+      int nd;
+      /* number of dense columns of A (0 <= nd <= DENSE_MAX) */
+      int *N_ptr; /* int N_ptr[1+m+1]; */
+      int *N_ind; /* int N_ind[N_ptr[m+1]]; */
+      double *N_val; /* double N_val[N_ptr[m+1]]; */
+      /* mxn-matrix N which is A without dense columns in storage-by-
+         rows format; if nd = 0, N and A share the same arrays */
+      int *V_col; /* int V_col[1+nd]; */
+      int *V_ptr; /* int V_ptr[1+nd+1]; */
+      int *V_ind; /* int V_ind[V_ptr[nd+1]]; */
+      double *V_val; /* double V_val[V_ptr[nd+1]]; */
+      /* k-th dense column of A is column V_col[k], whose elements are
+         stored in V_ptr, V_ind, V_val in storage-by-columns format */
+      double *W; /* double W[1+m*nd]; */
+      /* mxnd-matrix W = inv(N*D*N')*V*sqrt(D[V_col]) stored by columns,
+         (i,k)-th element of W is W[(k-1)*m+i] */
+      double *C; /* double C[nd*nd]; */
+      /* Cholesky factor of ndxnd-matrix C = I + sqrt(D)*V'*W */
+#endif
       double *b; /* double b[1+m]; */
       /* m-vector b of right-hand sides */
       double *c; /* double c[1+n]; */
       /* n-vector c of objective coefficients; c[0] is constant term of
          the objective function */
+#if 1 /* 17/X-2026 */
+      double *u; /* double u[1+n]; */
+      /* n-vector u of upper bounds of columns; u[j] = +DBL_MAX means
+         that column j has no upper bound */
+      int nu;
+      /* number of columns having finite upper bounds */
+#endif
       /*--------------------------------------------------------------*/
       /* LP solution */
       double *x; /* double x[1+n]; */
       double *y; /* double y[1+m]; */
       double *z; /* double z[1+n]; */
       /* current point in primal-dual space; the best point on exit */
+#if 1 /* 17/X-2026 */
+      double *w; /* double w[1+n]; */
+      double *v; /* double v[1+n]; */
+      /* primal slacks w = u - x for upper bounds and dual variables v
+         for upper bounds, which are also parts of the current point;
+         w[j] = v[j] = 0, if column j has no upper bound */
+#endif
       /*--------------------------------------------------------------*/
       /* control parameters */
       const glp_iptcp *parm;
+#if 1 /* 17/X-2026 */
+      volatile int *stop;
+      /* pointer to cooperative stop flag; NULL means no flag */
+#endif
       /*--------------------------------------------------------------*/
       /* working arrays and variables */
       double *D; /* double D[1+n]; */
@@ -79,6 +140,14 @@ struct csa
          S = U'*U; its non-diagonal elements are stored in U_ptr, U_ind,
          U_val in storage-by-rows format, diagonal elements are stored
          in U_diag */
+#if 1 /* 17/X-2026 */
+      SPADAT *sa;
+      /* workspace used to compute S with precomputed scatter map */
+      SPCHOL *sc;
+      /* workspace used to compute U with supernodal algorithm; it
+         also keeps non-diagonal elements of U, so U_ind and U_val are
+         not used */
+#endif
       int iter;
       /* iteration number (0, 1, 2, ...); iter = 0 corresponds to the
          initial point */
@@ -110,6 +179,10 @@ struct csa
       double *best_x; /* double best_x[1+n]; */
       double *best_y; /* double best_y[1+m]; */
       double *best_z; /* double best_z[1+n]; */
+#if 1 /* 17/X-2026 */
+      double *best_w; /* double best_w[1+n]; */
+      double *best_v; /* double best_v[1+n]; */
+#endif
       /* best point (in the sense of the merit function phi) which has
          been reached on iteration iter_best */
       double best_obj;
@@ -117,6 +190,10 @@ struct csa
       double *dx_aff; /* double dx_aff[1+n]; */
       double *dy_aff; /* double dy_aff[1+m]; */
       double *dz_aff; /* double dz_aff[1+n]; */
+#if 1 /* 17/X-2026 */
+      double *dw_aff; /* double dw_aff[1+n]; */
+      double *dv_aff; /* double dv_aff[1+n]; */
+#endif
       /* affine scaling direction */
       double alfa_aff_p, alfa_aff_d;
       /* maximal primal and dual stepsizes in affine scaling direction,
@@ -129,18 +206,140 @@ struct csa
       double *dx_cc; /* double dx_cc[1+n]; */
       double *dy_cc; /* double dy_cc[1+m]; */
       double *dz_cc; /* double dz_cc[1+n]; */
+#if 1 /* 17/X-2026 */
+      double *dw_cc; /* double dw_cc[1+n]; */
+      double *dv_cc; /* double dv_cc[1+n]; */
+#endif
       /* centering corrector direction */
       double *dx; /* double dx[1+n]; */
       double *dy; /* double dy[1+m]; */
       double *dz; /* double dz[1+n]; */
+#if 1 /* 17/X-2026 */
+      double *dw; /* double dw[1+n]; */
+      double *dv; /* double dv[1+n]; */
+#endif
       /* final combined direction dx = dx_aff+dx_cc, dy = dy_aff+dy_cc,
          dz = dz_aff+dz_cc */
       double alfa_max_p;
       double alfa_max_d;
       /* maximal primal and dual stepsizes in combined direction, on
          which x and z are still non-negative */
+#if 1 /* 17/X-2026 */
+      int n_corr;
+      /* total number of Gondzio's centrality correctors accepted */
+#endif
 };
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  find_dense - determine dense columns of constraint matrix
+*
+*  A single dense column of the matrix A makes the matrix A*D*A' of the
+*  normal equation system (nearly) completely dense. To avoid this the
+*  routine looks for columns of A having more than DENSE_MIN non-zeros
+*  and more than DENSE_AVG times the average number of non-zeros per
+*  column, and chooses at most DENSE_MAX densest of them. These columns
+*  are removed from A to obtain the sparse matrix N, while the removed
+*  columns are stored in the matrix V, so A*D*A' = N*D*N' + V*D*V', and
+*  the rank-nd term V*D*V' is then handled with the Sherman-Morrison-
+*  Woodbury formula (see the routines decomp_NE and solve_NE below).
+*
+*  If there are no dense columns, the matrix N shares the same arrays
+*  with the matrix A. */
+
+static void find_dense(struct csa *csa)
+{     int m = csa->m;
+      int n = csa->n;
+      int *A_ptr = csa->A_ptr;
+      int *A_ind = csa->A_ind;
+      double *A_val = csa->A_val;
+      int i, j, k, p, t, nd, loc, *cnt, *list;
+      double avg;
+      /* count non-zeros in columns of A */
+      cnt = xcalloc(1+n, sizeof(int));
+      for (j = 1; j <= n; j++)
+         cnt[j] = 0;
+      for (t = 1; t < A_ptr[m+1]; t++)
+         cnt[A_ind[t]]++;
+      avg = (double)(A_ptr[m+1] - 1) / (double)n;
+      /* collect dense columns */
+      list = xcalloc(1+n, sizeof(int));
+      nd = 0;
+      for (j = 1; j <= n; j++)
+      {  if (cnt[j] > DENSE_MIN && cnt[j] > DENSE_AVG * avg)
+            list[++nd] = j;
+      }
+      /* order at most DENSE_MAX densest columns first */
+      for (k = 1; k <= nd && k <= DENSE_MAX; k++)
+      {  p = k;
+         for (t = k+1; t <= nd; t++)
+            if (cnt[list[p]] < cnt[list[t]]) p = t;
+         j = list[p], list[p] = list[k], list[k] = j;
+      }
+      if (nd > DENSE_MAX)
+         nd = DENSE_MAX;
+      /* keep matrix W reasonably small */
+      while (nd > 0 && (double)m * (double)nd > 1e8)
+         nd--;
+      csa->nd = nd;
+      if (nd == 0)
+      {  /* N = A */
+         csa->N_ptr = A_ptr;
+         csa->N_ind = A_ind;
+         csa->N_val = A_val;
+         csa->V_col = csa->V_ptr = csa->V_ind = NULL;
+         csa->V_val = csa->W = csa->C = NULL;
+         goto done;
+      }
+      /* allocate matrix V */
+      csa->V_col = xcalloc(1+nd, sizeof(int));
+      csa->V_ptr = xcalloc(1+nd+1, sizeof(int));
+      csa->V_ptr[1] = 1;
+      for (k = 1; k <= nd; k++)
+      {  j = csa->V_col[k] = list[k];
+         csa->V_ptr[k+1] = csa->V_ptr[k] + cnt[j];
+      }
+      csa->V_ind = xcalloc(csa->V_ptr[nd+1], sizeof(int));
+      csa->V_val = xcalloc(csa->V_ptr[nd+1], sizeof(double));
+      /* cnt[j] := k, if j is k-th dense column, or 0 otherwise */
+      for (j = 1; j <= n; j++)
+         cnt[j] = 0;
+      for (k = 1; k <= nd; k++)
+         cnt[list[k]] = k;
+      /* list[k] := location of next element in k-th column of V */
+      for (k = 1; k <= nd; k++)
+         list[k] = csa->V_ptr[k];
+      /* split A into N and V */
+      loc = A_ptr[m+1] - csa->V_ptr[nd+1] + 1;
+      csa->N_ptr = xcalloc(1+m+1, sizeof(int));
+      csa->N_ind = xcalloc(loc, sizeof(int));
+      csa->N_val = xcalloc(loc, sizeof(double));
+      loc = 1;
+      for (i = 1; i <= m; i++)
+      {  csa->N_ptr[i] = loc;
+         for (t = A_ptr[i]; t < A_ptr[i+1]; t++)
+         {  j = A_ind[t];
+            if ((k = cnt[j]) == 0)
+            {  csa->N_ind[loc] = j;
+               csa->N_val[loc] = A_val[t];
+               loc++;
+            }
+            else
+            {  csa->V_ind[list[k]] = i;
+               csa->V_val[list[k]] = A_val[t];
+               list[k]++;
+            }
+         }
+      }
+      csa->N_ptr[m+1] = loc;
+      csa->W = xcalloc(1+m*nd, sizeof(double));
+      csa->C = xcalloc(1+nd*nd, sizeof(double));
+done: xfree(cnt);
+      xfree(list);
+      return;
+}
+#endif
+
 /***********************************************************************
 *  initialize - allocate and initialize common storage area
 *
@@ -153,14 +352,30 @@ static void initialize(struct csa *csa)
       int i;
       if (csa->parm->msg_lev >= GLP_MSG_ALL)
          xprintf("Matrix A has %d non-zeros\n", csa->A_ptr[m+1]-1);
+#if 1 /* 17/X-2026 */
+      if (csa->parm->msg_lev >= GLP_MSG_ALL && csa->nu > 0)
+         xprintf("%d column(s) have upper bounds\n", csa->nu);
+#endif
       csa->D = xcalloc(1+n, sizeof(double));
       /* P := I */
       csa->P = xcalloc(1+m+m, sizeof(int));
       for (i = 1; i <= m; i++) csa->P[i] = csa->P[m+i] = i;
+#if 1 /* 17/X-2026 */
+      /* determine dense columns of A */
+      find_dense(csa);
+      if (csa->parm->msg_lev >= GLP_MSG_ALL && csa->nd > 0)
+         xprintf("%d dense column(s) excluded from matrix S\n",
+            csa->nd);
+#endif
       /* S := A*A', symbolically */
       csa->S_ptr = xcalloc(1+m+1, sizeof(int));
+#if 0 /* 17/X-2026 */
       csa->S_ind = adat_symbolic(m, n, csa->P, csa->A_ptr, csa->A_ind,
          csa->S_ptr);
+#else
+      csa->S_ind = adat_symbolic(m, n, csa->P, csa->N_ptr, csa->N_ind,
+         csa->S_ptr);
+#endif
       if (csa->parm->msg_lev >= GLP_MSG_ALL)
          xprintf("Matrix S = A*A' has %d non-zeros (upper triangle)\n",
             csa->S_ptr[m+1]-1 + m);
@@ -191,10 +406,22 @@ static void initialize(struct csa *csa)
          xassert(csa != csa);
       /* S := P*A*A'*P', symbolically */
       xfree(csa->S_ind);
+#if 0 /* 17/X-2026 */
       csa->S_ind = adat_symbolic(m, n, csa->P, csa->A_ptr, csa->A_ind,
          csa->S_ptr);
+#else
+      csa->S_ind = adat_symbolic(m, n, csa->P, csa->N_ptr, csa->N_ind,
+         csa->S_ptr);
+#endif
       csa->S_val = xcalloc(csa->S_ptr[m+1], sizeof(double));
       csa->S_diag = xcalloc(1+m, sizeof(double));
+#if 1 /* 17/X-2026 */
+      csa->sa = spadat_create(m, n, csa->P, csa->N_ptr, csa->N_ind,
+         csa->S_ptr, csa->S_ind, csa->parm->threads);
+      if (csa->parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("Scatter map for matrix S has %d element(s)\n",
+            spadat_size(csa->sa));
+#endif
       /* compute Cholesky factorization S = U'*U, symbolically */
       if (csa->parm->msg_lev >= GLP_MSG_ALL)
          xprintf("Computing Cholesky factorization S = L*L'...\n");
@@ -202,7 +429,19 @@ static void initialize(struct csa *csa)
       csa->U_ind = chol_symbolic(m, csa->S_ptr, csa->S_ind, csa->U_ptr);
       if (csa->parm->msg_lev >= GLP_MSG_ALL)
          xprintf("Matrix L has %d non-zeros\n", csa->U_ptr[m+1]-1 + m);
+#if 1 /* 17/X-2026 */
+      csa->sc = spchol_symbolic(m, csa->U_ptr, csa->U_ind,
+         csa->parm->threads);
+      if (csa->parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("Matrix L has %d supernode(s)\n",
+            spchol_nsup(csa->sc));
+      /* the pattern and non-zero elements of U are kept in the
+         supernodal workspace */
+      xfree(csa->U_ind), csa->U_ind = NULL;
+#endif
+#if 0 /* 17/X-2026 */
       csa->U_val = xcalloc(csa->U_ptr[m+1], sizeof(double));
+#endif
       csa->U_diag = xcalloc(1+m, sizeof(double));
       csa->iter = 0;
       csa->obj = 0.0;
@@ -218,10 +457,18 @@ static void initialize(struct csa *csa)
       csa->best_x = xcalloc(1+n, sizeof(double));
       csa->best_y = xcalloc(1+m, sizeof(double));
       csa->best_z = xcalloc(1+n, sizeof(double));
+#if 1 /* 17/X-2026 */
+      csa->best_w = xcalloc(1+n, sizeof(double));
+      csa->best_v = xcalloc(1+n, sizeof(double));
+#endif
       csa->best_obj = 0.0;
       csa->dx_aff = xcalloc(1+n, sizeof(double));
       csa->dy_aff = xcalloc(1+m, sizeof(double));
       csa->dz_aff = xcalloc(1+n, sizeof(double));
+#if 1 /* 17/X-2026 */
+      csa->dw_aff = xcalloc(1+n, sizeof(double));
+      csa->dv_aff = xcalloc(1+n, sizeof(double));
+#endif
       csa->alfa_aff_p = 0.0;
       csa->alfa_aff_d = 0.0;
       csa->mu_aff = 0.0;
@@ -229,11 +476,22 @@ static void initialize(struct csa *csa)
       csa->dx_cc = xcalloc(1+n, sizeof(double));
       csa->dy_cc = xcalloc(1+m, sizeof(double));
       csa->dz_cc = xcalloc(1+n, sizeof(double));
+#if 1 /* 17/X-2026 */
+      csa->dw_cc = xcalloc(1+n, sizeof(double));
+      csa->dv_cc = xcalloc(1+n, sizeof(double));
+#endif
       csa->dx = csa->dx_aff;
       csa->dy = csa->dy_aff;
       csa->dz = csa->dz_aff;
+#if 1 /* 17/X-2026 */
+      csa->dw = csa->dw_aff;
+      csa->dv = csa->dv_aff;
+#endif
       csa->alfa_max_p = 0.0;
       csa->alfa_max_d = 0.0;
+#if 1 /* 17/X-2026 */
+      csa->n_corr = 0;
+#endif
       return;
 }
 
@@ -285,22 +543,204 @@ static void AT_by_vec(struct csa *csa, double x[], double y[])
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  solve_S - solve system with factorized matrix S
+*
+*  This routine solves the system (P'*U'*U*P)*y = h, where S = U'*U is
+*  the Cholesky factorization computed by the routine decomp_NE. If A
+*  has no dense columns, P'*U'*U*P = A*D*A'.
+*
+*  On entry the array y contains the vector of right-hand sides h. On
+*  exit this array contains the computed vector of unknowns y. */
+
+static void solve_S(struct csa *csa, double y[])
+{     int m = csa->m;
+      int *P = csa->P;
+      int i;
+      double *w;
+      /* w := P*h */
+      w = xcalloc(1+m, sizeof(double));
+      for (i = 1; i <= m; i++) w[i] = y[P[i]];
+      /* w := inv(U')*w */
+      spchol_ut_solve(csa->sc, csa->U_diag, w);
+      /* w := inv(U)*w */
+      spchol_u_solve(csa->sc, csa->U_diag, w);
+      /* y := P'*w */
+      for (i = 1; i <= m; i++) y[i] = w[P[m+i]];
+      xfree(w);
+      return;
+}
+#endif
+
 /***********************************************************************
 *  decomp_NE - numeric factorization of matrix S = P*A*D*A'*P'
 *
 *  This routine implements numeric phase of Cholesky factorization of
 *  the matrix S = P*A*D*A'*P', which is a permuted matrix of the normal
-*  equation system. Matrix D is assumed to be already computed. */
+*  equation system. Matrix D is assumed to be already computed.
+*
+*  If A has dense columns (see the routine find_dense), the routine
+*  factorizes the matrix S = P*(N*D*N'+R)*P' instead, where R is a small
+*  diagonal regularization, which keeps S non-singular when some rows
+*  of A have non-zeros in dense columns only. Then it computes the
+*  matrix W = inv(N*D*N'+R)*V~, where V~ = V*sqrt(D[V_col]), and the
+*  Cholesky factorization of the matrix C = I + V~'*W used by the
+*  routine solve_NE to apply the Sherman-Morrison-Woodbury formula. */
 
 static void decomp_NE(struct csa *csa)
-{     adat_numeric(csa->m, csa->n, csa->P, csa->A_ptr, csa->A_ind,
+{
+#if 1 /* 17/X-2026 */
+      int m = csa->m;
+      int nd = csa->nd;
+      int *P = csa->P;
+      int *V_col = csa->V_col;
+      int *V_ptr = csa->V_ptr;
+      int *V_ind = csa->V_ind;
+      double *V_val = csa->V_val;
+      double *D = csa->D;
+      double *W = csa->W;
+      double *C = csa->C;
+      int i, j, k, l, t;
+      double s, temp, *g, *w;
+#endif
+#if 0 /* 17/X-2026 */
+      adat_numeric(csa->m, csa->n, csa->P, csa->A_ptr, csa->A_ind,
          csa->A_val, csa->D, csa->S_ptr, csa->S_ind, csa->S_val,
          csa->S_diag);
+#else
+      spadat_numeric(csa->sa, csa->N_val, csa->D, csa->S_val,
+         csa->S_diag);
+#endif
+#if 1 /* 17/X-2026 */
+      if (nd > 0)
+      {  /* g := diag(V*D*V') */
+         g = xcalloc(1+m, sizeof(double));
+         for (i = 1; i <= m; i++)
+            g[i] = 0.0;
+         for (k = 1; k <= nd; k++)
+         {  j = V_col[k];
+            for (t = V_ptr[k]; t < V_ptr[k+1]; t++)
+               g[V_ind[t]] += D[j] * V_val[t] * V_val[t];
+         }
+         /* add regularization R to diagonal of S */
+         for (i = 1; i <= m; i++)
+            csa->S_diag[i] += DENSE_REG * (csa->S_diag[i] + g[P[i]]);
+         xfree(g);
+      }
+#endif
+#if 0 /* 17/X-2026 */
       chol_numeric(csa->m, csa->S_ptr, csa->S_ind, csa->S_val,
          csa->S_diag, csa->U_ptr, csa->U_ind, csa->U_val, csa->U_diag);
+#else
+      spchol_numeric(csa->sc, csa->S_ptr, csa->S_ind, csa->S_val,
+         csa->S_diag, csa->U_diag);
+#endif
+#if 1 /* 17/X-2026 */
+      if (nd > 0)
+      {  /* compute W = inv(N*D*N'+R)*V~ column by column */
+         for (k = 1; k <= nd; k++)
+         {  w = &W[(k-1)*m];
+            for (i = 1; i <= m; i++)
+               w[i] = 0.0;
+            s = sqrt(D[V_col[k]]);
+            for (t = V_ptr[k]; t < V_ptr[k+1]; t++)
+               w[V_ind[t]] = s * V_val[t];
+            solve_S(csa, w);
+         }
+         /* compute lower triangle of C = I + V~'*W */
+         for (k = 1; k <= nd; k++)
+         {  s = sqrt(D[V_col[k]]);
+            for (l = 1; l <= k; l++)
+            {  w = &W[(l-1)*m];
+               temp = 0.0;
+               for (t = V_ptr[k]; t < V_ptr[k+1]; t++)
+                  temp += V_val[t] * w[V_ind[t]];
+               C[(k-1)*nd+l] = (k == l ? 1.0 : 0.0) + s * temp;
+            }
+         }
+         /* compute Cholesky factorization C = L*L', where L replaces
+            lower triangle of C */
+         for (k = 1; k <= nd; k++)
+         {  temp = C[(k-1)*nd+k];
+            for (l = 1; l < k; l++)
+               temp -= C[(k-1)*nd+l] * C[(k-1)*nd+l];
+            /* C is positive definite in exact arithmetic */
+            temp = (temp > 0.0 ? sqrt(temp) : DBL_MAX);
+            C[(k-1)*nd+k] = temp;
+            for (i = k+1; i <= nd; i++)
+            {  s = C[(i-1)*nd+k];
+               for (l = 1; l < k; l++)
+                  s -= C[(i-1)*nd+l] * C[(k-1)*nd+l];
+               C[(i-1)*nd+k] = s / temp;
+            }
+         }
+      }
+#endif
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  solve_M - solve system with factorized normal equation matrix
+*
+*  This routine solves the system M*y = h, where M = P'*U'*U*P + V~*V~'
+*  is the matrix A*D*A' with regularized sparse part (see the routine
+*  decomp_NE), using the Sherman-Morrison-Woodbury formula:
+*
+*     inv(M)*h = u - W*inv(C)*V~'*u,  where u = inv(P'*U'*U*P)*h.
+*
+*  On entry the array y contains the vector of right-hand sides h. On
+*  exit this array contains the computed vector of unknowns y. */
+
+static void solve_M(struct csa *csa, double y[])
+{     int m = csa->m;
+      int nd = csa->nd;
+      int *V_ptr = csa->V_ptr;
+      int *V_ind = csa->V_ind;
+      double *V_val = csa->V_val;
+      double *W = csa->W;
+      double *C = csa->C;
+      int i, k, l, t;
+      double temp, *v, *w;
+      /* y := u = inv(P'*U'*U*P)*h */
+      solve_S(csa, y);
+      if (nd == 0)
+         goto done;
+      /* v := V~'*u */
+      v = xcalloc(1+nd, sizeof(double));
+      for (k = 1; k <= nd; k++)
+      {  temp = 0.0;
+         for (t = V_ptr[k]; t < V_ptr[k+1]; t++)
+            temp += V_val[t] * y[V_ind[t]];
+         v[k] = sqrt(csa->D[csa->V_col[k]]) * temp;
+      }
+      /* v := inv(C)*v = inv(L')*inv(L)*v */
+      for (k = 1; k <= nd; k++)
+      {  temp = v[k];
+         for (l = 1; l < k; l++)
+            temp -= C[(k-1)*nd+l] * v[l];
+         v[k] = temp / C[(k-1)*nd+k];
+      }
+      for (k = nd; k >= 1; k--)
+      {  temp = v[k];
+         for (l = k+1; l <= nd; l++)
+            temp -= C[(l-1)*nd+k] * v[l];
+         v[k] = temp / C[(k-1)*nd+k];
+      }
+      /* y := u - W*v */
+      for (k = 1; k <= nd; k++)
+      {  if (v[k] == 0.0)
+            continue;
+         w = &W[(k-1)*m];
+         for (i = 1; i <= m; i++)
+            y[i] -= w[i] * v[k];
+      }
+      xfree(v);
+done: return;
+}
+#endif
+
 /***********************************************************************
 *  solve_NE - solve normal equation system
 *
@@ -314,6 +754,10 @@ static void decomp_NE(struct csa *csa)
 *  On entry the array y contains the vector of right-hand sides h. On
 *  exit this array contains the computed vector of unknowns y.
 *
+*  If A has dense columns, the system is solved with the routine solve_M
+*  and then the solution is refined with at most REFINE_MAX iterations
+*  of the conjugate gradient method preconditioned with the matrix M.
+*
 *  Once the vector y has been computed the routine checks for numeric
 *  stability. If the residual vector:
 *
@@ -325,12 +769,19 @@ static void decomp_NE(struct csa *csa)
 static int solve_NE(struct csa *csa, double y[])
 {     int m = csa->m;
       int n = csa->n;
+#if 0 /* 17/X-2026 */
       int *P = csa->P;
+#endif
       int i, j, ret = 0;
       double *h, *r, *w;
+#if 1 /* 17/X-2026 */
+      int k;
+      double alfa, beta, rg, temp, *g, *d, *q;
+#endif
       /* save vector of right-hand sides h */
       h = xcalloc(1+m, sizeof(double));
       for (i = 1; i <= m; i++) h[i] = y[i];
+#if 0 /* 17/X-2026 */
       /* solve normal equation system (A*D*A')*y = h */
       /* since S = P*A*D*A'*P' = U'*U, then A*D*A' = P'*U'*U*P, so we
          have inv(A*D*A') = P'*inv(U)*inv(U')*P */
@@ -344,6 +795,67 @@ static int solve_NE(struct csa *csa, double y[])
       /* y := P'*w */
       for (i = 1; i <= m; i++) y[i] = w[P[m+i]];
       xfree(w);
+#else
+      /* solve normal equation system (A*D*A')*y = h */
+      solve_M(csa, y);
+      /* since the sparse part of A*D*A' was regularized, the matrix M
+         is only an approximation of A*D*A', so improve the solution
+         with the conjugate gradient method preconditioned with M */
+      if (csa->nd > 0)
+      {  r = xcalloc(1+m, sizeof(double));
+         w = xcalloc(1+n, sizeof(double));
+         g = xcalloc(1+m, sizeof(double));
+         d = xcalloc(1+m, sizeof(double));
+         q = xcalloc(1+m, sizeof(double));
+         /* r := h - A*D*A'*y */
+         AT_by_vec(csa, y, w);
+         for (j = 1; j <= n; j++) w[j] *= csa->D[j];
+         A_by_vec(csa, w, r);
+         for (i = 1; i <= m; i++) r[i] = h[i] - r[i];
+         /* d := g := inv(M)*r */
+         for (i = 1; i <= m; i++) g[i] = r[i];
+         solve_M(csa, g);
+         for (i = 1; i <= m; i++) d[i] = g[i];
+         rg = 0.0;
+         for (i = 1; i <= m; i++) rg += r[i] * g[i];
+         for (k = 1; k <= REFINE_MAX; k++)
+         {  /* stop if the residual is small enough */
+            temp = 0.0;
+            for (i = 1; i <= m; i++)
+            {  if (temp < fabs(r[i]) / (1.0 + fabs(h[i])))
+                  temp = fabs(r[i]) / (1.0 + fabs(h[i]));
+            }
+            if (temp <= 1e-12)
+               break;
+            /* q := A*D*A'*d */
+            AT_by_vec(csa, d, w);
+            for (j = 1; j <= n; j++) w[j] *= csa->D[j];
+            A_by_vec(csa, w, q);
+            temp = 0.0;
+            for (i = 1; i <= m; i++) temp += d[i] * q[i];
+            if (temp <= 0.0)
+               break;
+            /* y := y + alfa*d, r := r - alfa*q */
+            alfa = rg / temp;
+            for (i = 1; i <= m; i++)
+            {  y[i] += alfa * d[i];
+               r[i] -= alfa * q[i];
+            }
+            /* g := inv(M)*r, d := g + beta*d */
+            for (i = 1; i <= m; i++) g[i] = r[i];
+            solve_M(csa, g);
+            temp = 0.0;
+            for (i = 1; i <= m; i++) temp += r[i] * g[i];
+            beta = temp / rg, rg = temp;
+            for (i = 1; i <= m; i++) d[i] = g[i] + beta * d[i];
+         }
+         xfree(r);
+         xfree(w);
+         xfree(g);
+         xfree(d);
+         xfree(q);
+      }
+#endif
       /* compute residual vector r = A*D*A'*y - h */
       r = xcalloc(1+m, sizeof(double));
       /* w := A'*y */
@@ -394,21 +906,66 @@ static int solve_NE(struct csa *csa, double y[])
 *
 *     dz = inv(X)*(r-Z*dx)
 *
+*  If some columns have upper bounds, the Newtonian system includes
+*  additional equations for such columns:
+*
+*     A*dx                       = p
+*
+*       dx        + dw           = s
+*
+*           A'*dy +   dz -   dv  = q
+*
+*     Z*dx        + X*dz         = r
+*
+*                   V*dw + W*dv  = t
+*
+*  where W = diag(w[j]), V = diag(v[j]). In this case the normal
+*  equation system has the same structure (A*D*A')*dy = A*D*g+p, where
+*  D = inv(inv(X)*Z+inv(W)*V) and g = q-inv(X)*r+inv(W)*(t-V*s) for
+*  columns having upper bounds (matrix D is computed by the routine
+*  ipm_main), and once vector dy has been computed, the routine computes
+*  dx = D*(A'*dy-g), dz = inv(X)*(r-Z*dx), dw = s-dx, dv = inv(W)*
+*  (t-V*dw). Components of s, t, dw, dv for columns having no upper
+*  bounds are ignored and set to zero, respectively.
+*
 *  The routine solve_NS returns the same code which was reported by the
 *  routine solve_NE (see above). */
 
+#if 0 /* 17/X-2026 */
 static int solve_NS(struct csa *csa, double p[], double q[], double r[],
       double dx[], double dy[], double dz[])
+#else
+static int solve_NS(struct csa *csa, double p[], double q[], double r[],
+      double s[], double t[], double dx[], double dy[], double dz[],
+      double dw[], double dv[])
+#endif
 {     int m = csa->m;
       int n = csa->n;
       double *x = csa->x;
       double *z = csa->z;
       int i, j, ret;
       double *w = dx;
+#if 1 /* 17/X-2026 */
+      double *u = csa->u;
+      double *D = csa->D;
+      double *g = dw;
+#endif
       /* compute the vector of right-hand sides A*inv(Z)*(X*q-r)+p for
          the normal equation system */
       for (j = 1; j <= n; j++)
+#if 0 /* 17/X-2026 */
          w[j] = (x[j] * q[j] - r[j]) / z[j];
+#else
+      {  if (u[j] == +DBL_MAX)
+            w[j] = (x[j] * q[j] - r[j]) / z[j];
+         else
+         {  /* column j has upper bound */
+            g[j] = q[j] - r[j] / x[j] +
+               (t[j] - csa->v[j] * s[j]) / csa->w[j];
+            w[j] = D[j] * g[j];
+         }
+      }
+#endif
       A_by_vec(csa, w, dy);
       for (i = 1; i <= m; i++) dy[i] += p[i];
       /* solve the normal equation system to compute vector dy */
@@ -416,9 +973,25 @@ static int solve_NS(struct csa *csa, double p[], double q[], double r[],
       /* compute vectors dx and dz */
       AT_by_vec(csa, dy, dx);
       for (j = 1; j <= n; j++)
+#if 0 /* 17/X-2026 */
       {  dx[j] = (x[j] * (dx[j] - q[j]) + r[j]) / z[j];
          dz[j] = (r[j] - z[j] * dx[j]) / x[j];
       }
+#else
+      {  if (u[j] == +DBL_MAX)
+         {  dx[j] = (x[j] * (dx[j] - q[j]) + r[j]) / z[j];
+            dz[j] = (r[j] - z[j] * dx[j]) / x[j];
+            dw[j] = dv[j] = 0.0;
+         }
+         else
+         {  /* column j has upper bound */
+            dx[j] = D[j] * (dx[j] - g[j]);
+            dz[j] = (r[j] - z[j] * dx[j]) / x[j];
+            dw[j] = s[j] - dx[j];
+            dv[j] = (t[j] - csa->v[j] * dw[j]) / csa->w[j];
+         }
+      }
+#endif
       return ret;
 }
 
@@ -468,6 +1041,11 @@ static void initial_point(struct csa *csa)
       double *y = csa->y;
       double *z = csa->z;
       double *D = csa->D;
+#if 1 /* 17/X-2026 */
+      double *u = csa->u;
+      double *w = csa->w;
+      double *v = csa->v;
+#endif
       int i, j;
       double dp, dd, ex, ez, xz;
       /* factorize A*A' */
@@ -483,12 +1061,29 @@ static void initial_point(struct csa *csa)
       /* z~ = c - A'*y~ */
       AT_by_vec(csa, y,z);
       for (j = 1; j <= n; j++) z[j] = c[j] - z[j];
+#if 1 /* 17/X-2026 */
+      /* for columns having upper bounds w~ = u - x~, and z~ is split
+         into z~ and v~ so that z~ - v~ remains the same */
+      for (j = 1; j <= n; j++)
+      {  if (u[j] != +DBL_MAX)
+         {  w[j] = u[j] - x[j];
+            v[j] = -0.5 * z[j];
+            z[j] = +0.5 * z[j];
+         }
+      }
+#endif
       /* use Mehrotra's heuristic in order to choose more appropriate
          starting point with positive components of vectors x and z */
       dp = dd = 0.0;
       for (j = 1; j <= n; j++)
       {  if (dp < -1.5 * x[j]) dp = -1.5 * x[j];
          if (dd < -1.5 * z[j]) dd = -1.5 * z[j];
+#if 1 /* 17/X-2026 */
+         if (u[j] != +DBL_MAX)
+         {  if (dp < -1.5 * w[j]) dp = -1.5 * w[j];
+            if (dd < -1.5 * v[j]) dd = -1.5 * v[j];
+         }
+#endif
       }
       /* note that b = 0 involves x = 0, and c = 0 involves y = 0 and
          z = 0, so we need to be careful */
@@ -499,6 +1094,13 @@ static void initial_point(struct csa *csa)
       {  ex += (x[j] + dp);
          ez += (z[j] + dd);
          xz += (x[j] + dp) * (z[j] + dd);
+#if 1 /* 17/X-2026 */
+         if (u[j] != +DBL_MAX)
+         {  ex += (w[j] + dp);
+            ez += (v[j] + dd);
+            xz += (w[j] + dp) * (v[j] + dd);
+         }
+#endif
       }
       dp += 0.5 * (xz / ez);
       dd += 0.5 * (xz / ex);
@@ -506,6 +1108,13 @@ static void initial_point(struct csa *csa)
       {  x[j] += dp;
          z[j] += dd;
          xassert(x[j] > 0.0 && z[j] > 0.0);
+#if 1 /* 17/X-2026 */
+         if (u[j] != +DBL_MAX)
+         {  w[j] += dp;
+            v[j] += dd;
+            xassert(w[j] > 0.0 && v[j] > 0.0);
+         }
+#endif
       }
       return;
 }
@@ -546,7 +1155,12 @@ static void initial_point(struct csa *csa)
 *
 *     rmu = max(||A*x-b||,||A'*y+z-c||) / mu
 *
-*  where ||*|| denotes euclidian norm, *' denotes transposition. */
+*  where ||*|| denotes euclidian norm, *' denotes transposition.
+*
+*  If some columns have upper bounds, the residuals x+w-u are included
+*  in the primal infeasibility, the dual residuals are A'*y+z-v-c, the
+*  dual objective is b'*y-u'*v, and the duality measure is computed as
+*  mu = (x'*z+w'*v) / (n+nu), where nu is the number of such columns. */
 
 static void basic_info(struct csa *csa)
 {     int m = csa->m;
@@ -556,6 +1170,11 @@ static void basic_info(struct csa *csa)
       double *x = csa->x;
       double *y = csa->y;
       double *z = csa->z;
+#if 1 /* 17/X-2026 */
+      double *u = csa->u;
+      double *w = csa->w;
+      double *v = csa->v;
+#endif
       int i, j;
       double norm1, bnorm, norm2, cnorm, cx, by, *work, temp;
       /* compute value of the objective function */
@@ -568,11 +1187,22 @@ static void basic_info(struct csa *csa)
       norm1 = 0.0;
       for (i = 1; i <= m; i++)
          norm1 += (work[i] - b[i]) * (work[i] - b[i]);
+#if 1 /* 17/X-2026 */
+      /* include ||x+w-u|| for columns having upper bounds */
+      for (j = 1; j <= n; j++)
+      {  if (u[j] != +DBL_MAX)
+            norm1 += (x[j] + w[j] - u[j]) * (x[j] + w[j] - u[j]);
+      }
+#endif
       norm1 = sqrt(norm1);
       xfree(work);
       /* bnorm = ||b|| */
       bnorm = 0.0;
       for (i = 1; i <= m; i++) bnorm += b[i] * b[i];
+#if 1 /* 17/X-2026 */
+      for (j = 1; j <= n; j++)
+         if (u[j] != +DBL_MAX) bnorm += u[j] * u[j];
+#endif
       bnorm = sqrt(bnorm);
       /* compute relative primal infeasibility */
       csa->rpi = norm1 / (1.0 + bnorm);
@@ -580,8 +1210,17 @@ static void basic_info(struct csa *csa)
       work = xcalloc(1+n, sizeof(double));
       AT_by_vec(csa, y, work);
       norm2 = 0.0;
+#if 0 /* 17/X-2026 */
       for (j = 1; j <= n; j++)
          norm2 += (work[j] + z[j] - c[j]) * (work[j] + z[j] - c[j]);
+#else
+      /* norm2 = ||A'*y+z-v-c||, where v[j] = 0 for columns having no
+         upper bounds */
+      for (j = 1; j <= n; j++)
+      {  temp = work[j] + z[j] - v[j] - c[j];
+         norm2 += temp * temp;
+      }
+#endif
       norm2 = sqrt(norm2);
       xfree(work);
       /* cnorm = ||c|| */
@@ -593,6 +1232,11 @@ static void basic_info(struct csa *csa)
       /* by = b'*y */
       by = 0.0;
       for (i = 1; i <= m; i++) by += b[i] * y[i];
+#if 1 /* 17/X-2026 */
+      /* by := b'*y - u'*v */
+      for (j = 1; j <= n; j++)
+         if (u[j] != +DBL_MAX) by -= u[j] * v[j];
+#endif
       /* cx = c'*x */
       cx = 0.0;
       for (j = 1; j <= n; j++) cx += c[j] * x[j];
@@ -609,12 +1253,192 @@ static void basic_info(struct csa *csa)
       /* compute duality measure */
       temp = 0.0;
       for (j = 1; j <= n; j++) temp += x[j] * z[j];
+#if 0 /* 17/X-2026 */
       csa->mu = temp / (double)n;
+#else
+      for (j = 1; j <= n; j++)
+         if (u[j] != +DBL_MAX) temp += w[j] * v[j];
+      csa->mu = temp / (double)(n + csa->nu);
+#endif
       /* compute the ratio of infeasibility to mu */
       csa->rmu = (norm1 > norm2 ? norm1 : norm2) / csa->mu;
       return;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  step_len - determine maximal stepsizes along given direction
+*
+*  This routine computes maximal primal and dual stepsizes
+*
+*     alfa_p = inf{0 <= alfa <= 1 | x + alfa*dx >= 0, w + alfa*dw >= 0},
+*
+*     alfa_d = inf{0 <= alfa <= 1 | z + alfa*dz >= 0, v + alfa*dv >= 0}
+*
+*  (components w, v, dw, dv are used only for columns having upper
+*  bounds) and stores them in locations alfa_p and alfa_d. */
+
+static void step_len(struct csa *csa, const double dx[],
+      const double dz[], const double dw[], const double dv[],
+      double *alfa_p, double *alfa_d)
+{     int n = csa->n;
+      double *u = csa->u;
+      double *x = csa->x;
+      double *z = csa->z;
+      double *w = csa->w;
+      double *v = csa->v;
+      int j;
+      double temp;
+      *alfa_p = *alfa_d = 1.0;
+      for (j = 1; j <= n; j++)
+      {  if (dx[j] < 0.0)
+         {  temp = - x[j] / dx[j];
+            if (*alfa_p > temp) *alfa_p = temp;
+         }
+         if (dz[j] < 0.0)
+         {  temp = - z[j] / dz[j];
+            if (*alfa_d > temp) *alfa_d = temp;
+         }
+         if (u[j] == +DBL_MAX)
+            continue;
+         /* column j has upper bound */
+         if (dw[j] < 0.0)
+         {  temp = - w[j] / dw[j];
+            if (*alfa_p > temp) *alfa_p = temp;
+         }
+         if (dv[j] < 0.0)
+         {  temp = - v[j] / dv[j];
+            if (*alfa_d > temp) *alfa_d = temp;
+         }
+      }
+      return;
+}
+
+/***********************************************************************
+*  correct_dir - apply Gondzio's multiple centrality correctors
+*
+*  Given the combined predictor-corrector direction (dx,dy,dz) and its
+*  maximal stepsizes alfa_max_p and alfa_max_d this routine tries to
+*  enlarge the stepsizes by adding up to parm->mcc centrality correctors
+*  to the direction (J.Gondzio, Multiple centrality corrections in a
+*  primal-dual method for linear programming, 1996).
+*
+*  To compute a corrector the routine takes a trial point
+*
+*     x~ = x + alfa~_p*dx,  z~ = z + alfa~_d*dz,
+*
+*  where alfa~ = min(alfa+DELTA, 1) are enlarged (aspiration) stepsizes,
+*  and determines complementarity products x~[j]*z~[j] (and w~[j]*v~[j]
+*  for columns having upper bounds). Products, which are outside the
+*  interval [BETA_MIN*mu_t, BETA_MAX*mu_t], where mu_t = sigma*mu is
+*  the target duality measure, are moved to the nearest interval bound,
+*  that gives the right-hand side vectors r and t of the Newtonian
+*  system with p = 0, q = 0, and s = 0. Its solution is computed
+*  with the same Cholesky factorization, and the corrector is accepted
+*  if it increases the minimal stepsize at least by GAMMA*DELTA.
+*
+*  Arrays p, q, r, s, and t are used as working storage. */
+
+#define DELTA     0.10
+#define GAMMA     0.10
+#define BETA_MIN  0.10
+#define BETA_MAX  10.0
+
+static double project(double prod, double mu_t)
+{     /* determine the difference between projection of product prod
+         onto [BETA_MIN*mu_t, BETA_MAX*mu_t] and the product itself */
+      double diff;
+      if (prod < BETA_MIN * mu_t)
+         diff = BETA_MIN * mu_t - prod;
+      else if (prod > BETA_MAX * mu_t)
+      {  diff = BETA_MAX * mu_t - prod;
+         if (diff < - BETA_MAX * mu_t)
+            diff = - BETA_MAX * mu_t;
+      }
+      else
+         diff = 0.0;
+      return diff;
+}
+
+static void correct_dir(struct csa *csa, double p[], double q[],
+      double r[], double s[], double t[])
+{     int m = csa->m;
+      int n = csa->n;
+      double *u = csa->u;
+      double *x = csa->x;
+      double *z = csa->z;
+      double *w = csa->w;
+      double *v = csa->v;
+      double *dx_cc = csa->dx_cc;
+      double *dy_cc = csa->dy_cc;
+      double *dz_cc = csa->dz_cc;
+      double *dw_cc = csa->dw_cc;
+      double *dv_cc = csa->dv_cc;
+      double *dx = csa->dx;
+      double *dy = csa->dy;
+      double *dz = csa->dz;
+      double *dw = csa->dw;
+      double *dv = csa->dv;
+      int i, j, k;
+      double mu_t, alfa_p, alfa_d, new_p, new_d, prod;
+      mu_t = csa->sigma * csa->mu;
+      for (k = 1; k <= csa->parm->mcc; k++)
+      {  /* stop if the full step can be made */
+         if (csa->alfa_max_p >= 1.0 && csa->alfa_max_d >= 1.0)
+            break;
+         /* determine aspiration stepsizes */
+         alfa_p = csa->alfa_max_p + DELTA;
+         if (alfa_p > 1.0) alfa_p = 1.0;
+         alfa_d = csa->alfa_max_d + DELTA;
+         if (alfa_d > 1.0) alfa_d = 1.0;
+         /* p = 0, q = 0, s = 0 */
+         for (i = 1; i <= m; i++) p[i] = 0.0;
+         for (j = 1; j <= n; j++) q[j] = s[j] = 0.0;
+         /* r (and t) = projection of complementarity products at the
+            trial point onto the target interval minus the products */
+         for (j = 1; j <= n; j++)
+         {  prod = (x[j] + alfa_p * dx[j]) * (z[j] + alfa_d * dz[j]);
+            r[j] = project(prod, mu_t);
+            if (u[j] != +DBL_MAX)
+            {  prod = (w[j] + alfa_p * dw[j]) * (v[j] + alfa_d * dv[j]);
+               t[j] = project(prod, mu_t);
+            }
+         }
+         /* solve the Newtonian system for the corrector */
+         if (solve_NS(csa, p, q, r, s, t, dx_cc, dy_cc, dz_cc, dw_cc,
+               dv_cc))
+            break;
+         /* (dx_cc,...) := (dx,...) + (dx_cc,...) */
+         for (j = 1; j <= n; j++) dx_cc[j] += dx[j];
+         for (i = 1; i <= m; i++) dy_cc[i] += dy[i];
+         for (j = 1; j <= n; j++) dz_cc[j] += dz[j];
+         for (j = 1; j <= n; j++) dw_cc[j] += dw[j];
+         for (j = 1; j <= n; j++) dv_cc[j] += dv[j];
+         /* check if the corrected direction allows a longer step */
+         step_len(csa, dx_cc, dz_cc, dw_cc, dv_cc, &new_p, &new_d);
+         prod = (csa->alfa_max_p <= csa->alfa_max_d ?
+            csa->alfa_max_p : csa->alfa_max_d);
+         if ((new_p <= new_d ? new_p : new_d) < prod + GAMMA * DELTA)
+            break;
+         /* accept the corrector */
+         for (j = 1; j <= n; j++) dx[j] = dx_cc[j];
+         for (i = 1; i <= m; i++) dy[i] = dy_cc[i];
+         for (j = 1; j <= n; j++) dz[j] = dz_cc[j];
+         for (j = 1; j <= n; j++) dw[j] = dw_cc[j];
+         for (j = 1; j <= n; j++) dv[j] = dv_cc[j];
+         csa->alfa_max_p = new_p;
+         csa->alfa_max_d = new_d;
+         csa->n_corr++;
+      }
+      return;
+}
+
+#undef DELTA
+#undef GAMMA
+#undef BETA_MIN
+#undef BETA_MAX
+#endif
+
 /***********************************************************************
 *  make_step - compute next point using Mehrotra's technique
 *
@@ -672,6 +1496,14 @@ static void basic_info(struct csa *csa)
 *
 *     alfa_max_d = inf{0 <= alfa <= 1 | z+alfa*dz >= 0}
 *
+*  For columns having upper bounds the same technique is applied to the
+*  additional pairs (w[j], v[j]) (see the routine solve_NS), so their
+*  components are also included in the stepsizes and in mu_aff.
+*
+*  If parm->mcc > 0, the combined direction and its maximal stepsizes
+*  are then improved with Gondzio's centrality correctors (see the
+*  routine correct_dir above).
+*
 *  In order to prevent the next point to be too close to the boundary
 *  of the positive ortant, the routine decreases maximal stepsizes:
 *
@@ -707,12 +1539,28 @@ static int make_step(struct csa *csa)
       double *dx = csa->dx;
       double *dy = csa->dy;
       double *dz = csa->dz;
+#if 1 /* 17/X-2026 */
+      double *u = csa->u;
+      double *w = csa->w;
+      double *v = csa->v;
+      double *dw_aff = csa->dw_aff;
+      double *dv_aff = csa->dv_aff;
+      double *dw_cc = csa->dw_cc;
+      double *dv_cc = csa->dv_cc;
+      double *dw = csa->dw;
+      double *dv = csa->dv;
+      double *s, *t;
+#endif
       int i, j, ret = 0;
       double temp, gamma_p, gamma_d, *p, *q, *r;
       /* allocate working arrays */
       p = xcalloc(1+m, sizeof(double));
       q = xcalloc(1+n, sizeof(double));
       r = xcalloc(1+n, sizeof(double));
+#if 1 /* 17/X-2026 */
+      s = xcalloc(1+n, sizeof(double));
+      t = xcalloc(1+n, sizeof(double));
+#endif
       /* p = b - A*x */
       A_by_vec(csa, x, p);
       for (i = 1; i <= m; i++) p[i] = b[i] - p[i];
@@ -721,8 +1569,24 @@ static int make_step(struct csa *csa)
       for (j = 1; j <= n; j++) q[j] = c[j] - q[j] - z[j];
       /* r = - X * Z * e */
       for (j = 1; j <= n; j++) r[j] = - x[j] * z[j];
+#if 1 /* 17/X-2026 */
+      /* for columns having upper bounds q := q + v, s = u - x - w, and
+         t = - W * V * e */
+      for (j = 1; j <= n; j++)
+      {  if (u[j] != +DBL_MAX)
+         {  q[j] += v[j];
+            s[j] = u[j] - x[j] - w[j];
+            t[j] = - w[j] * v[j];
+         }
+      }
+#endif
       /* solve the first Newtonian system */
+#if 0 /* 17/X-2026 */
       if (solve_NS(csa, p, q, r, dx_aff, dy_aff, dz_aff))
+#else
+      if (solve_NS(csa, p, q, r, s, t, dx_aff, dy_aff, dz_aff, dw_aff,
+            dv_aff))
+#endif
       {  ret = 1;
          goto done;
       }
@@ -738,13 +1602,34 @@ static int make_step(struct csa *csa)
          {  temp = - z[j] / dz_aff[j];
             if (csa->alfa_aff_d > temp) csa->alfa_aff_d = temp;
          }
+#if 1 /* 17/X-2026 */
+         if (u[j] == +DBL_MAX)
+            continue;
+         if (dw_aff[j] < 0.0)
+         {  temp = - w[j] / dw_aff[j];
+            if (csa->alfa_aff_p > temp) csa->alfa_aff_p = temp;
+         }
+         if (dv_aff[j] < 0.0)
+         {  temp = - v[j] / dv_aff[j];
+            if (csa->alfa_aff_d > temp) csa->alfa_aff_d = temp;
+         }
+#endif
       }
       /* mu_aff = (x+alfa_aff_p*dx_aff)' * (z+alfa_aff_d*dz_aff) / n */
       temp = 0.0;
       for (j = 1; j <= n; j++)
          temp += (x[j] + csa->alfa_aff_p * dx_aff[j]) *
                  (z[j] + csa->alfa_aff_d * dz_aff[j]);
+#if 0 /* 17/X-2026 */
       csa->mu_aff = temp / (double)n;
+#else
+      for (j = 1; j <= n; j++)
+      {  if (u[j] != +DBL_MAX)
+            temp += (w[j] + csa->alfa_aff_p * dw_aff[j]) *
+                    (v[j] + csa->alfa_aff_d * dv_aff[j]);
+      }
+      csa->mu_aff = temp / (double)(n + csa->nu);
+#endif
       /* sigma = (mu_aff/mu)^3 */
       temp = csa->mu_aff / csa->mu;
       csa->sigma = temp * temp * temp;
@@ -755,9 +1640,23 @@ static int make_step(struct csa *csa)
       /* r = sigma * mu * e - X * Z * e */
       for (j = 1; j <= n; j++)
          r[j] = csa->sigma * csa->mu - dx_aff[j] * dz_aff[j];
+#if 1 /* 17/X-2026 */
+      /* s = 0, t = sigma * mu * e - dW_aff * dV_aff * e */
+      for (j = 1; j <= n; j++)
+      {  if (u[j] != +DBL_MAX)
+         {  s[j] = 0.0;
+            t[j] = csa->sigma * csa->mu - dw_aff[j] * dv_aff[j];
+         }
+      }
+#endif
       /* solve the second Newtonian system with the same coefficients
          but with altered right-hand sides */
+#if 0 /* 17/X-2026 */
       if (solve_NS(csa, p, q, r, dx_cc, dy_cc, dz_cc))
+#else
+      if (solve_NS(csa, p, q, r, s, t, dx_cc, dy_cc, dz_cc, dw_cc,
+            dv_cc))
+#endif
       {  ret = 1;
          goto done;
       }
@@ -765,6 +1664,10 @@ static int make_step(struct csa *csa)
       for (j = 1; j <= n; j++) dx[j] = dx_aff[j] + dx_cc[j];
       for (i = 1; i <= m; i++) dy[i] = dy_aff[i] + dy_cc[i];
       for (j = 1; j <= n; j++) dz[j] = dz_aff[j] + dz_cc[j];
+#if 1 /* 17/X-2026 */
+      for (j = 1; j <= n; j++) dw[j] = dw_aff[j] + dw_cc[j];
+      for (j = 1; j <= n; j++) dv[j] = dv_aff[j] + dv_cc[j];
+#endif
       /* alfa_max_p = inf{0 <= alfa <= 1 | x + alfa*dx >= 0} */
       /* alfa_max_d = inf{0 <= alfa <= 1 | z + alfa*dz >= 0} */
       csa->alfa_max_p = csa->alfa_max_d = 1.0;
@@ -777,7 +1680,25 @@ static int make_step(struct csa *csa)
          {  temp = - z[j] / dz[j];
             if (csa->alfa_max_d > temp) csa->alfa_max_d = temp;
          }
+#if 1 /* 17/X-2026 */
+         if (u[j] == +DBL_MAX)
+            continue;
+         if (dw[j] < 0.0)
+         {  temp = - w[j] / dw[j];
+            if (csa->alfa_max_p > temp) csa->alfa_max_p = temp;
+         }
+         if (dv[j] < 0.0)
+         {  temp = - v[j] / dv[j];
+            if (csa->alfa_max_d > temp) csa->alfa_max_d = temp;
+         }
+#endif
       }
+#if 1 /* 17/X-2026 */
+      /* improve the combined direction with Gondzio's multiple
+         centrality correctors */
+      if (csa->parm->mcc > 0)
+         correct_dir(csa, p, q, r, s, t);
+#endif
       /* determine scale factors (not implemented yet) */
       gamma_p = 0.90;
       gamma_d = 0.90;
@@ -792,10 +1713,23 @@ static int make_step(struct csa *csa)
       {  z[j] += gamma_d * csa->alfa_max_d * dz[j];
          xassert(z[j] > 0.0);
       }
+#if 1 /* 17/X-2026 */
+      for (j = 1; j <= n; j++)
+      {  if (u[j] != +DBL_MAX)
+         {  w[j] += gamma_p * csa->alfa_max_p * dw[j];
+            v[j] += gamma_d * csa->alfa_max_d * dv[j];
+            xassert(w[j] > 0.0 && v[j] > 0.0);
+         }
+      }
+#endif
 done: /* free working arrays */
       xfree(p);
       xfree(q);
       xfree(r);
+#if 1 /* 17/X-2026 */
+      xfree(s);
+      xfree(t);
+#endif
       return ret;
 }
 
@@ -813,9 +1747,26 @@ static void terminate(struct csa *csa)
       xfree(csa->S_val);
       xfree(csa->S_diag);
       xfree(csa->U_ptr);
+#if 0 /* 17/X-2026 */
       xfree(csa->U_ind);
       xfree(csa->U_val);
+#endif
       xfree(csa->U_diag);
+#if 1 /* 17/X-2026 */
+      spadat_delete(csa->sa);
+      spchol_delete(csa->sc);
+      if (csa->nd > 0)
+      {  xfree(csa->N_ptr);
+         xfree(csa->N_ind);
+         xfree(csa->N_val);
+         xfree(csa->V_col);
+         xfree(csa->V_ptr);
+         xfree(csa->V_ind);
+         xfree(csa->V_val);
+         xfree(csa->W);
+         xfree(csa->C);
+      }
+#endif
       xfree(csa->phi_min);
       xfree(csa->best_x);
       xfree(csa->best_y);
@@ -826,6 +1777,14 @@ static void terminate(struct csa *csa)
       xfree(csa->dx_cc);
       xfree(csa->dy_cc);
       xfree(csa->dz_cc);
+#if 1 /* 17/X-2026 */
+      xfree(csa->best_w);
+      xfree(csa->best_v);
+      xfree(csa->dw_aff);
+      xfree(csa->dv_aff);
+      xfree(csa->dw_cc);
+      xfree(csa->dv_cc);
+#endif
       return;
 }
 
@@ -840,7 +1799,8 @@ static void terminate(struct csa *csa)
 *  1 - problem has no feasible (primal or dual) solution;
 *  2 - no convergence;
 *  3 - iteration limit exceeded;
-*  4 - numeric instability on solving Newtonian system.
+*  4 - numeric instability on solving Newtonian system;
+*  5 - search cancelled with the stop flag.
 *
 *  In case of non-zero return code the routine returns the best point,
 *  which has been reached during optimization. */
@@ -870,6 +1830,10 @@ static int ipm_main(struct csa *csa)
             for (j = 1; j <= n; j++) csa->best_x[j] = csa->x[j];
             for (i = 1; i <= m; i++) csa->best_y[i] = csa->y[i];
             for (j = 1; j <= n; j++) csa->best_z[j] = csa->z[j];
+#if 1 /* 17/X-2026 */
+            for (j = 1; j <= n; j++) csa->best_w[j] = csa->w[j];
+            for (j = 1; j <= n; j++) csa->best_v[j] = csa->v[j];
+#endif
             csa->best_obj = csa->obj;
          }
          else
@@ -913,10 +1877,28 @@ static int ipm_main(struct csa *csa)
             status = 3;
             break;
          }
+#if 1 /* 16/X-2026 */
+         /* check if the search has been cancelled */
+         if (csa->stop != NULL && *csa->stop)
+         {  if (csa->parm->msg_lev >= GLP_MSG_ALL)
+               xprintf("SEARCH CANCELLED\n");
+            status = 5;
+            break;
+         }
+#endif
          /* start the next iteration */
          csa->iter++;
          /* factorize normal equation system */
          for (j = 1; j <= n; j++) csa->D[j] = csa->x[j] / csa->z[j];
+#if 1 /* 17/X-2026 */
+         /* D[j] = 1 / (z[j]/x[j] + v[j]/w[j]) for columns having upper
+            bounds */
+         for (j = 1; j <= n; j++)
+         {  if (csa->u[j] != +DBL_MAX)
+               csa->D[j] = 1.0 / (csa->z[j] / csa->x[j] +
+                  csa->v[j] / csa->w[j]);
+         }
+#endif
          decomp_NE(csa);
          /* compute the next point using Mehrotra's predictor-corrector
             technique */
@@ -927,11 +1909,19 @@ static int ipm_main(struct csa *csa)
             break;
          }
       }
+#if 1 /* 17/X-2026 */
+      if (csa->parm->mcc > 0 && csa->parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("%d centrality corrector(s) used\n", csa->n_corr);
+#endif
       /* restore the best point */
       if (status != 0)
       {  for (j = 1; j <= n; j++) csa->x[j] = csa->best_x[j];
          for (i = 1; i <= m; i++) csa->y[i] = csa->best_y[i];
          for (j = 1; j <= n; j++) csa->z[j] = csa->best_z[j];
+#if 1 /* 17/X-2026 */
+         for (j = 1; j <= n; j++) csa->w[j] = csa->best_w[j];
+         for (j = 1; j <= n; j++) csa->v[j] = csa->best_v[j];
+#endif
          if (csa->parm->msg_lev >= GLP_MSG_ALL)
             xprintf("Best point %17.9e was reached on iteration %d\n",
                csa->best_obj, csa->best_iter);
@@ -976,6 +1966,12 @@ static int ipm_main(struct csa *csa)
 *
 *        x[1] >= 0, x[2] >= 0, ..., x[n] >= 0
 *
+*  Some variables may also have finite upper bounds x[j] <= u[j], which
+*  are handled directly by the solver (without additional rows and
+*  columns) by introducing slacks w[j] = u[j] - x[j] >= 0 and the
+*  corresponding dual variables v[j] >= 0. In this case reduced costs
+*  of such variables are z[j] - v[j].
+*
 *  where:
 *  F                    is the objective function;
 *  x[1], ..., x[n]      are (structural) variables;
@@ -1018,6 +2014,9 @@ static int ipm_main(struct csa *csa)
 *  GLP_EINSTAB
 *     Numeric instability on solving Newtonian system.
 *
+*  GLP_ESTOP
+*     Search cancelled with the stop flag (see glp_iptcp).
+*
 *  In case of non-zero return code the routine returns the best point,
 *  which has been reached during optimization. */
 
@@ -1031,6 +2030,10 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
       GLPAIJ *aij;
       int i, j, loc, ret, *A_ind, *A_ptr;
       double dir, *A_val, *b, *c, *x, *y, *z;
+#if 1 /* 17/X-2026 */
+      int nu;
+      double *u, *w, *v;
+#endif
       xassert(m > 0);
       xassert(n > 0);
       /* allocate working arrays */
@@ -1042,6 +2045,11 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
       x = xcalloc(1+n, sizeof(double));
       y = xcalloc(1+m, sizeof(double));
       z = xcalloc(1+n, sizeof(double));
+#if 1 /* 17/X-2026 */
+      u = xcalloc(1+n, sizeof(double));
+      w = xcalloc(1+n, sizeof(double));
+      v = xcalloc(1+n, sizeof(double));
+#endif
       /* prepare rows and constraint coefficients */
       loc = 1;
       for (i = 1; i <= m; i++)
@@ -1065,9 +2073,22 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
       else
          xassert(P != P);
       c[0] = dir * P->c0;
+#if 1 /* 17/X-2026 */
+      nu = 0;
+#endif
       for (j = 1; j <= n; j++)
       {  col = P->col[j];
+#if 0 /* 17/X-2026 */
          xassert(col->type == GLP_LO && col->lb == 0.0);
+#else
+         xassert(col->type == GLP_LO || col->type == GLP_DB);
+         xassert(col->lb == 0.0);
+         if (col->type == GLP_DB)
+            u[j] = col->ub / col->sjj, nu++;
+         else
+            u[j] = +DBL_MAX;
+         w[j] = v[j] = 0.0;
+#endif
          c[j] = dir * col->coef * col->sjj;
       }
       /* allocate and initialize the common storage area */
@@ -1081,7 +2102,16 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
       csa->x = x;
       csa->y = y;
       csa->z = z;
+#if 1 /* 17/X-2026 */
+      csa->u = u;
+      csa->nu = nu;
+      csa->w = w;
+      csa->v = v;
+#endif
       csa->parm = parm;
+#if 1 /* 17/X-2026 */
+      csa->stop = P->stop;
+#endif
       initialize(csa);
       /* solve LP with the interior-point method */
       ret = ipm_main(csa);
@@ -1113,6 +2143,13 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
          P->ipt_stat = GLP_INFEAS;
          ret = GLP_EINSTAB;
       }
+#if 1 /* 16/X-2026 */
+      else if (ret == 5)
+      {  /* search cancelled with the stop flag */
+         P->ipt_stat = GLP_INFEAS;
+         ret = GLP_ESTOP;
+      }
+#endif
       else
          xassert(ret != ret);
       /* store row solution components */
@@ -1126,7 +2163,11 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
       for (j = 1; j <= n; j++)
       {  col = P->col[j];
          col->pval = x[j] * col->sjj;
+#if 0 /* 17/X-2026 */
          col->dval = dir * z[j] / col->sjj;
+#else
+         col->dval = dir * (z[j] - v[j]) / col->sjj;
+#endif
          P->ipt_obj += col->coef * col->pval;
       }
       /* free working arrays */
@@ -1138,6 +2179,11 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
       xfree(x);
       xfree(y);
       xfree(z);
+#if 1 /* 17/X-2026 */
+      xfree(u);
+      xfree(w);
+      xfree(v);
+#endif
       return ret;
 }
 
@@ -108,6 +108,29 @@ struct glp_tree
       /* total number of nodes including those which have been already
          removed from the tree; this count is increased by one whenever
          a new node is created and never decreased */
+#if 1 /* 17/X-2026 */
+      /* to avoid scanning the active list on every selection, active
+         subproblems are also kept in binary heaps (priority queues),
+         which are maintained on creating and deleting subproblems */
+      int pq_max;
+      /* length of arrays bnd_pq and est_pq (enlarged automatically) */
+      int pq_cnt;
+      /* current number of subproblems in the heaps, pq_cnt = a_cnt */
+      IOSNPD **bnd_pq; /* IOSNPD *bnd_pq[1+pq_max]; */
+      /* heap of active subproblems ordered by their local bounds (see
+         the routine ios_pq_bound) */
+      IOSNPD **est_pq; /* IOSNPD *est_pq[1+pq_max]; */
+      /* heap of active subproblems ordered by estimates used by the
+         best projection heuristic (see the routine ios_pq_estim); this
+         heap is maintained only if bt_tech = GLP_BT_BPH */
+      int est_type;
+      /* type of estimates, by which the heap est_pq is ordered:
+         0 - sum of integer infeasibilities of the parent subproblem
+         1 - best projection of the parent subproblem */
+      double est_deg;
+      /* degradation of the objective per unit of the sum of integer
+         infeasibilities used to compute estimates of type 1 */
+#endif
       /*--------------------------------------------------------------*/
       /* problem components corresponding to the root subproblem */
       int root_m;
@@ -126,6 +149,7 @@ struct glp_tree
       /* pointer to the current subproblem (which can be only active);
          NULL means the current subproblem does not exist */
       glp_prob *mip;
+#if 0 /* 17/X-2026 */
       /* original problem object passed to the solver; if the current
          subproblem exists, its LP segment corresponds to LP relaxation
          of the current subproblem; if the current subproblem does not
@@ -133,6 +157,34 @@ struct glp_tree
          subproblem (note that the root subproblem may differ from the
          original MIP, because it may be preprocessed and/or may have
          additional rows) */
+#else
+      /* original problem object passed to the solver; if the current
+         subproblem exists, its LP segment corresponds to LP relaxation
+         of the current subproblem; if the current subproblem does not
+         exist, its LP segment corresponds to LP relaxation of the
+         subproblem loaded (see below) */
+      IOSNPD *loaded;
+      /* pointer to the subproblem, whose LP relaxation is kept in the
+         problem object while the current subproblem does not exist
+         (note that the root subproblem may differ from the original
+         MIP, because it may be preprocessed and/or may have additional
+         rows); this is the most recently frozen subproblem or its
+         nearest ancestor, so on reviving another subproblem only the
+         changes along the path through their common ancestor are
+         made; NULL means that the current subproblem exists or the
+         tree is empty */
+      void *undo;
+      /* pointer to working area, which keeps attributes of rows and
+         columns changed on the path from the root to the subproblem
+         loaded (or to the parent of the current subproblem) */
+      int bf_keep;
+      /* this flag is set if the basis factorization of the most
+         recently frozen subproblem would remain valid, if the problem
+         object were returned to the root subproblem; it allows keeping
+         the factorization on reviving a subproblem in the same cases
+         as if the subproblem were revived starting from the root (see
+         the routine ios_revive_node) */
+#endif
       unsigned char *non_int; /* uchar non_int[1+n]; */
       /* these column flags are set each time when LP relaxation of the
          current subproblem has been solved;
@@ -172,6 +224,24 @@ struct glp_tree
       /*--------------------------------------------------------------*/
       void *pcost;
       /* pointer to working area used on pseudocost branching */
+#if 1 /* 16/X-2026 */
+      void *eval;
+      /* pointer to working area used on parallel node evaluation */
+#endif
+#if 1 /* 17/X-2026 */
+      int sb_cnt;
+      /* number of LP relaxations solved by strong branching */
+      int sb_itc;
+      /* number of simplex iterations spent on strong branching */
+      int sb_out;
+      /* value of sb_cnt on last displaying progress of the search */
+      size_t lst_size;
+      /* total size, in bytes, of change lists of all subproblems kept
+         in memory (see the routine ios_nf_spill) */
+      void *nfile;
+      /* pointer to working area used on writing change lists of
+         subproblems to node files */
+#endif
       int *iwrk; /* int iwrk[1+n]; */
       /* working array */
       double *dwrk; /* double dwrk[1+n]; */
@@ -255,14 +325,27 @@ struct IOSNPD
       /* if count = 0, this subproblem is active; if count > 0, this
          subproblem is inactive, in which case count is the number of
          its child subproblems */
-      /* the following three linked lists are destroyed on reviving and
-         built anew on freezing the subproblem: */
+      /* the following three lists are destroyed on reviving and built
+         anew on freezing the subproblem: */
+#if 0 /* 17/X-2026 */
       IOSBND *b_ptr;
       /* linked list of rows and columns of the parent subproblem whose
          types and bounds were changed */
       IOSTAT *s_ptr;
       /* linked list of rows and columns of the parent subproblem whose
          statuses were changed */
+#else
+      int b_len;
+      /* number of entries in the bound change list */
+      IOSBND *b_ptr; /* IOSBND b_ptr[b_len]; */
+      /* packed list of rows and columns of the parent subproblem whose
+         types and bounds were changed; NULL if b_len = 0 */
+      int s_len;
+      /* number of entries in the status change list */
+      IOSTAT *s_ptr; /* IOSTAT s_ptr[s_len]; */
+      /* packed list of rows and columns of the parent subproblem whose
+         statuses were changed; NULL if s_len = 0 */
+#endif
       IOSROW *r_ptr;
       /* linked list of rows (cuts) added to the parent subproblem */
       double lp_obj;
@@ -301,6 +384,39 @@ struct IOSNPD
       double br_val;
       /* (fractional) value of branching variable in optimal solution
          to final LP relaxation of this subproblem */
+#if 1 /* 16/X-2026 */
+      int ahead;
+      /* flag set if LP relaxation of this (active) subproblem has been
+         solved in advance by the parallel node evaluation routine */
+#endif
+#if 1 /* 17/X-2026 */
+      int seq;
+      /* sequential number of this subproblem (the value of t_cnt on
+         its creation) */
+      double bnd_key;
+      /* local bound, by which this (active) subproblem is currently
+         placed in the heap bnd_pq; since the local bound can only be
+         made stronger, bnd_key is never stronger than bound */
+      int bnd_pos;
+      /* position of this (active) subproblem in the heap bnd_pq */
+      double est_key;
+      /* estimate, by which this (active) subproblem is placed in the
+         heap est_pq */
+      int est_pos;
+      /* position of this (active) subproblem in the heap est_pq */
+      int nf_ref;
+      /* if nf_ref > 0, change lists of this subproblem are stored in
+         the node file having this number rather than in memory */
+      int nf_use;
+      /* value of t_cnt on the last use of change lists of this
+         subproblem; subproblems whose change lists were not used for
+         the longest time are written to node files first */
+      int root_bas;
+      /* this flag is set if final LP basis of this (frozen) subproblem
+         as well as of all its ancestors have the same basic variables
+         as the final LP basis of the root subproblem, and no rows are
+         added to these subproblems */
+#endif
       void *data; /* char data[tree->cb_size]; */
       /* pointer to the application-specific data */
       IOSNPD *temp;
@@ -311,6 +427,7 @@ struct IOSNPD
       /* pointer to next subproblem in the active list */
 };
 
+#if 0 /* 17/X-2026 */
 struct IOSBND
 {     /* bounds change entry */
       int k;
@@ -338,6 +455,31 @@ struct IOSTAT
       IOSTAT *next;
       /* pointer to next entry for the same subproblem */
 };
+#else
+struct IOSBND
+{     /* bounds change entry */
+      int k;
+      /* ordinal number of corresponding row (1 <= k <= m) or column
+         (m+1 <= k <= m+n), where m and n are the number of rows and
+         columns, resp., in the parent subproblem */
+      unsigned char type;
+      /* new type */
+      double lb;
+      /* new lower bound */
+      double ub;
+      /* new upper bound */
+};
+
+struct IOSTAT
+{     /* status change entry */
+      int k;
+      /* ordinal number of corresponding row (1 <= k <= m) or column
+         (m+1 <= k <= m+n), where m and n are the number of rows and
+         columns, resp., in the parent subproblem */
+      unsigned char stat;
+      /* new status */
+};
+#endif
 
 struct IOSROW
 {     /* row (constraint) addition entry */
@@ -432,6 +574,20 @@ void ios_clone_node(glp_tree *tree, int p, int nnn, int ref[]);
 void ios_delete_node(glp_tree *tree, int p);
 /* delete specified subproblem */
 
+#if 1 /* 17/X-2026 */
+#define ios_bnd_list _glp_ios_bnd_list
+IOSBND *ios_bnd_list(glp_tree *tree, IOSNPD *node, int len);
+/* allocate bound change list of subproblem */
+
+#define ios_stat_list _glp_ios_stat_list
+IOSTAT *ios_stat_list(glp_tree *tree, IOSNPD *node, int len);
+/* allocate status change list of subproblem */
+
+#define ios_free_rows _glp_ios_free_rows
+void ios_free_rows(glp_tree *tree, IOSNPD *node);
+/* delete row addition list of subproblem */
+#endif
+
 #define ios_delete_tree _glp_ios_delete_tree
 void ios_delete_tree(glp_tree *tree);
 /* delete branch-and-bound tree */
@@ -538,10 +694,89 @@ void ios_process_cuts(glp_tree *T);
 int ios_choose_node(glp_tree *T);
 /* select subproblem to continue the search */
 
+#if 1 /* 17/X-2026 */
+#define ios_pq_add _glp_ios_pq_add
+void ios_pq_add(glp_tree *T, IOSNPD *node);
+/* add active subproblem to priority queues */
+
+#define ios_pq_del _glp_ios_pq_del
+void ios_pq_del(glp_tree *T, IOSNPD *node);
+/* remove active subproblem from priority queues */
+
+#define ios_pq_bound _glp_ios_pq_bound
+IOSNPD *ios_pq_bound(glp_tree *T);
+/* find active subproblem with best local bound */
+
+#define ios_pq_estim _glp_ios_pq_estim
+IOSNPD *ios_pq_estim(glp_tree *T);
+/* find active subproblem with best estimate */
+
+#define ios_pq_top _glp_ios_pq_top
+int ios_pq_top(glp_tree *T, int max_cnt, IOSNPD *list[]);
+/* list active subproblems having best local bounds */
+#endif
+
 #define ios_choose_var _glp_ios_choose_var
 int ios_choose_var(glp_tree *T, int *next);
 /* select variable to branch on */
 
+#if 1 /* 16/X-2026 */
+#define ios_eval_nodes _glp_ios_eval_nodes
+void ios_eval_nodes(glp_tree *T);
+/* solve LP relaxations of active subproblems in parallel */
+
+#define ios_eval_free _glp_ios_eval_free
+void ios_eval_free(glp_tree *T);
+/* free working area used on parallel node evaluation */
+#endif
+
+#if 1 /* 17/X-2026 */
+typedef struct IOSPRB IOSPRB;
+
+#define ios_probe_init _glp_ios_probe_init
+IOSPRB *ios_probe_init(glp_prob *P);
+/* create LP probe */
+
+#define ios_probe_bnds _glp_ios_probe_bnds
+void ios_probe_bnds(IOSPRB *prb, int j, int type, double lb,
+      double ub);
+/* change bounds of column for probing */
+
+#define ios_probe_solve _glp_ios_probe_solve
+int ios_probe_solve(IOSPRB *prb, int it_lim);
+/* reoptimize LP with dual simplex */
+
+#define ios_probe_restore _glp_ios_probe_restore
+void ios_probe_restore(IOSPRB *prb);
+/* restore LP to its saved state */
+
+#define ios_probe_free _glp_ios_probe_free
+void ios_probe_free(IOSPRB *prb);
+/* delete LP probe */
+
+#define ios_probe_copy _glp_ios_probe_copy
+void ios_probe_copy(glp_prob *dest, glp_prob *P);
+/* copy problem object to be probed */
+#endif
+
+#if 1 /* 17/X-2026 */
+#define ios_nf_spill _glp_ios_nf_spill
+void ios_nf_spill(glp_tree *T);
+/* write change lists of subproblems to node file, if necessary */
+
+#define ios_nf_fetch _glp_ios_nf_fetch
+void ios_nf_fetch(glp_tree *T, IOSNPD *node);
+/* read change lists of subproblem from node file, if necessary */
+
+#define ios_nf_drop _glp_ios_nf_drop
+void ios_nf_drop(glp_tree *T, IOSNPD *node);
+/* discard change lists of subproblem stored in node file */
+
+#define ios_nf_free _glp_ios_nf_free
+void ios_nf_free(glp_tree *T);
+/* delete all node files and free working area */
+#endif
+
 #endif
 
 /* eof */
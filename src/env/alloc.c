@@ -21,6 +21,10 @@
 *  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
 ***********************************************************************/
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
 #include "env.h"
 
 #define ALIGN 16
@@ -34,6 +38,230 @@
 /* size of memory block descriptor, in bytes, rounded up to multiple
  * of the alignment boundary */
 
+#if 1 /* 17/X-2026 */
+/* Small memory blocks are allocated from the memory pool, which
+ * belongs to the environment block. The pool has a list of free blocks
+ * for each size class k = 1, ..., POOL_NCLS, where blocks of class k
+ * are k * ALIGN bytes long (including the descriptor). New blocks are
+ * carved from large chunks obtained with malloc; freed blocks are kept
+ * in the lists for reuse and returned to the system only on calling
+ * glp_free_env. Large blocks are allocated with malloc and kept in the
+ * linked list env->mem_ptr. The memory usage counts are maintained in
+ * the same way for both kinds of blocks.
+ *
+ * If the package is configured with --enable-memdebug, the pool is not
+ * used, i.e. every block is allocated with malloc and kept in the
+ * linked list, so that tools like valgrind could check every block. */
+
+#ifdef MEMDEBUG
+#define POOL_NCLS 0
+#else
+#define POOL_NCLS 64
+#endif
+/* number of size classes; blocks up to POOL_NCLS * ALIGN bytes long
+ * are allocated from the pool */
+
+#define POOL_CHUNK (64 * 1024)
+/* size of chunk, in bytes, allocated to the pool with malloc */
+
+#define size_class(size) (((size) + (ALIGN - 1)) / ALIGN)
+/* size class of memory block of specified size (in bytes, including
+ * the descriptor) */
+
+#define is_pooled(size) (size_class(size) <= POOL_NCLS)
+/* check if memory block of specified size belongs to the pool */
+
+struct pool
+{     /* memory pool */
+      MBD *avail[1+POOL_NCLS];
+      /* avail[k] is a pointer to the list of free blocks of class k;
+       * free blocks are chained through the next field */
+      char *ptr;
+      /* pointer to unused space in the current chunk */
+      size_t left;
+      /* size of unused space in the current chunk, in bytes */
+      void *chunk;
+      /* pointer to the list of all chunks; first ALIGN bytes of each
+       * chunk hold a pointer to the next chunk */
+};
+
+/***********************************************************************
+*  pool_get - take memory block from the pool
+*
+*  This routine takes a free memory block of class k from the pool.
+*  If there is no such block, the routine carves it from the current
+*  chunk or, if the latter has not enough space, from a new chunk.
+*  If the system has no memory available, the routine returns NULL. */
+
+static MBD *pool_get(ENV *env, int k)
+{     struct pool *pool = env->mem_pool;
+      size_t size = (size_t)k * ALIGN;
+      MBD *mbd;
+      xassert(1 <= k && k <= POOL_NCLS);
+      if (pool == NULL)
+      {  /* create the pool on first use */
+         pool = env->mem_pool = calloc(1, sizeof(struct pool));
+         if (pool == NULL)
+            return NULL;
+      }
+      if (pool->avail[k] != NULL)
+      {  /* reuse free block */
+         mbd = pool->avail[k];
+         pool->avail[k] = mbd->next;
+         return mbd;
+      }
+      if (pool->left < size)
+      {  /* start new chunk (unused space left in the current chunk is
+          * wasted) */
+         char *chunk = malloc(POOL_CHUNK);
+         if (chunk == NULL)
+            return NULL;
+         *(void **)chunk = pool->chunk;
+         pool->chunk = chunk;
+         pool->ptr = chunk + ALIGN;
+         pool->left = POOL_CHUNK - ALIGN;
+      }
+      mbd = (MBD *)pool->ptr;
+      pool->ptr += size;
+      pool->left -= size;
+      return mbd;
+}
+
+/***********************************************************************
+*  link_block - add memory block to linked list
+*
+*  This routine adds a large memory block to the beginning of the
+*  linked list env->mem_ptr. */
+
+static void link_block(ENV *env, MBD *mbd)
+{     mbd->prev = NULL;
+      mbd->next = env->mem_ptr;
+      if (mbd->next != NULL)
+         mbd->next->prev = mbd;
+      env->mem_ptr = mbd;
+      return;
+}
+
+/***********************************************************************
+*  unlink_block - remove memory block from linked list
+*
+*  This routine removes a large memory block from the linked list
+*  env->mem_ptr. */
+
+static void unlink_block(ENV *env, MBD *mbd)
+{     if (mbd->prev == NULL)
+         env->mem_ptr = mbd->next;
+      else
+         mbd->prev->next = mbd->next;
+      if (mbd->next == NULL)
+         ;
+      else
+         mbd->next->prev = mbd->prev;
+      return;
+}
+
+/***********************************************************************
+*  release_block - release memory block
+*
+*  This routine returns a small memory block to the pool or frees a
+*  large memory block. The size field of the block descriptor must be
+*  valid. */
+
+static void release_block(ENV *env, MBD *mbd)
+{     if (is_pooled(mbd->size))
+      {  struct pool *pool = env->mem_pool;
+         int k = size_class(mbd->size);
+         mbd->next = pool->avail[k];
+         pool->avail[k] = mbd;
+      }
+      else
+      {  unlink_block(env, mbd);
+         free(mbd);
+      }
+      return;
+}
+
+/***********************************************************************
+*  get_block - get memory block
+*
+*  This routine returns a memory block of specified size (in bytes,
+*  including the descriptor). If old is not NULL, the routine moves the
+*  contents of the old block to the new one (or reuses the old block
+*  when possible) and releases the old block. The size field of the old
+*  block descriptor must be valid. If the system has no memory
+*  available, the routine returns NULL. */
+
+static MBD *get_block(ENV *env, MBD *old, size_t size)
+{     MBD *mbd;
+      if (old != NULL && is_pooled(old->size) && is_pooled(size) &&
+          size_class(old->size) == size_class(size))
+      {  /* the old block has the same size class, so reuse it */
+         mbd = old;
+      }
+      else if (!is_pooled(size) &&
+               (old == NULL || !is_pooled(old->size)))
+      {  /* both blocks are large; use the standard routines */
+         if (old != NULL)
+            unlink_block(env, old);
+         mbd = (old == NULL ? malloc(size) : realloc(old, size));
+         if (mbd == NULL)
+         {  if (old != NULL)
+               link_block(env, old);
+            goto done;
+         }
+         link_block(env, mbd);
+      }
+      else
+      {  /* allocate new block and copy contents of the old block */
+         if (is_pooled(size))
+            mbd = pool_get(env, size_class(size));
+         else
+         {  mbd = malloc(size);
+            if (mbd != NULL)
+               link_block(env, mbd);
+         }
+         if (mbd == NULL)
+            goto done;
+         if (old != NULL)
+         {  memcpy((char *)mbd + MBD_SIZE, (char *)old + MBD_SIZE,
+               (old->size < size ? old->size : size) - MBD_SIZE);
+            release_block(env, old);
+         }
+      }
+done: return mbd;
+}
+
+/***********************************************************************
+*  mem_free_all - free all memory blocks
+*
+*  This routine frees all memory blocks, which are still allocated, as
+*  well as the memory pool of the specified environment block. It is
+*  called on freeing the environment. */
+
+void mem_free_all(ENV *env)
+{     struct pool *pool = env->mem_pool;
+      MBD *desc;
+      void *chunk;
+      /* free large memory blocks */
+      while (env->mem_ptr != NULL)
+      {  desc = env->mem_ptr;
+         env->mem_ptr = desc->next;
+         free(desc);
+      }
+      /* free chunks allocated to the pool */
+      if (pool != NULL)
+      {  while (pool->chunk != NULL)
+         {  chunk = pool->chunk;
+            pool->chunk = *(void **)chunk;
+            free(chunk);
+         }
+         free(pool);
+         env->mem_pool = NULL;
+      }
+      return;
+}
+#endif
+
 /***********************************************************************
 *  dma - dynamic memory allocation (basic routine)
 *
@@ -46,6 +274,9 @@
 static void *dma(const char *func, void *ptr, size_t size)
 {     ENV *env = get_env_ptr();
       MBD *mbd;
+      /* serialize access to the memory pool, if worker threads exist */
+      if (env->mt_lock != NULL)
+         mutex_lock(env->mt_lock);
       if (ptr == NULL)
       {  /* new memory block will be allocated */
          mbd = NULL;
@@ -57,6 +288,7 @@ static void *dma(const char *func, void *ptr, size_t size)
          /* make sure that the block descriptor is valid */
          if (mbd->self != mbd)
             xerror("%s: ptr = %p; invalid pointer\n", func, ptr);
+#if 0 /* 17/X-2026 */
          /* remove the block from the linked list */
          mbd->self = NULL;
          if (mbd->prev == NULL)
@@ -67,6 +299,9 @@ static void *dma(const char *func, void *ptr, size_t size)
             ;
          else
             mbd->next->prev = mbd->prev;
+#else
+         mbd->self = NULL;
+#endif
          /* decrease usage counts */
          if (!(env->mem_count >= 1 && env->mem_total >= mbd->size))
             xerror("%s: memory allocation error\n", func);
@@ -74,8 +309,13 @@ static void *dma(const char *func, void *ptr, size_t size)
          env->mem_total -= mbd->size;
          if (size == 0)
          {  /* free the memory block */
+#if 0 /* 17/X-2026 */
             free(mbd);
-            return NULL;
+#else
+            release_block(env, mbd);
+#endif
+            mbd = NULL;
+            goto done;
          }
       }
       /* allocate/reallocate memory block */
@@ -86,18 +326,24 @@ static void *dma(const char *func, void *ptr, size_t size)
          xerror("%s: memory allocation limit exceeded\n", func);
       if (env->mem_count == INT_MAX)
          xerror("%s: too many memory blocks allocated\n", func);
+#if 0 /* 17/X-2026 */
       mbd = (mbd == NULL ? malloc(size) : realloc(mbd, size));
+#else
+      mbd = get_block(env, mbd, size);
+#endif
       if (mbd == NULL)
          xerror("%s: no memory available\n", func);
       /* setup the block descriptor */
       mbd->size = size;
       mbd->self = mbd;
+#if 0 /* 17/X-2026 */
       mbd->prev = NULL;
       mbd->next = env->mem_ptr;
       /* add the block to the beginning of the linked list */
       if (mbd->next != NULL)
          mbd->next->prev = mbd;
       env->mem_ptr = mbd;
+#endif
       /* increase usage counts */
       env->mem_count++;
       if (env->mem_cpeak < env->mem_count)
@@ -105,7 +351,9 @@ static void *dma(const char *func, void *ptr, size_t size)
       env->mem_total += size;
       if (env->mem_tpeak < env->mem_total)
          env->mem_tpeak = env->mem_total;
-      return (char *)mbd + MBD_SIZE;
+done: if (env->mt_lock != NULL)
+         mutex_unlock(env->mt_lock);
+      return mbd == NULL ? NULL : (char *)mbd + MBD_SIZE;
 }
 
 /***********************************************************************
@@ -99,6 +99,9 @@ int glp_init_env(void)
       env->err_buf[0] = '\0';
       env->mem_limit = SIZE_T_MAX;
       env->mem_ptr = NULL;
+#if 1 /* 17/X-2026 */
+      env->mem_pool = NULL;
+#endif
       env->mem_count = env->mem_cpeak = 0;
       env->mem_total = env->mem_tpeak = env->last_mem_tpeak = 0;
 #if 1 /* 23/XI-2015 */
@@ -107,6 +110,7 @@ int glp_init_env(void)
       env->gmp_work = NULL;
 #endif
       env->h_odbc = env->h_mysql = NULL;
+      env->mt_lock = NULL;
       /* save pointer to the environment block */
       tls_set_ptr(env);
       env->time_start = env->last_time_start = glp_time();
@@ -278,7 +282,9 @@ const char *glp_config(const char *option)
 
 int glp_free_env(void)
 {     ENV *env = tls_get_ptr();
+#if 0 /* 17/X-2026 */
       MBD *desc;
+#endif
       /* check if the environment is active */
       if (env == NULL)
          return 1;
@@ -294,11 +300,15 @@ int glp_free_env(void)
       if (env->h_mysql != NULL)
          xdlclose(env->h_mysql);
       /* free memory blocks which are still allocated */
+#if 0 /* 17/X-2026 */
       while (env->mem_ptr != NULL)
       {  desc = env->mem_ptr;
          env->mem_ptr = desc->next;
          free(desc);
       }
+#else
+      mem_free_all(env);
+#endif
       /* close text file used for copying terminal output */
       if (env->tee_file != NULL)
          fclose(env->tee_file);
@@ -84,7 +84,8 @@ struct ENV
       /* maximal amount of memory, in bytes, available for dynamic
        * allocation */
       MBD *mem_ptr;
-      /* pointer to the linked list of allocated memory blocks */
+      /* pointer to the linked list of allocated memory blocks (except
+       * small blocks allocated from the memory pool) */
       int show_mem_count;
       /* total number of currently allocated memory blocks */
       int mem_count;
@@ -96,6 +97,10 @@ struct ENV
        * the sum of the size field over all memory block descriptors */
       size_t mem_tpeak;
       /* peak value of mem_total */
+#if 1 /* 17/X-2026 */
+      void *mem_pool; /* struct pool *mem_pool; */
+      /* memory pool used to allocate small memory blocks */
+#endif
 #if 1 /* 23/XI-2015 */
       /*--------------------------------------------------------------*/
       /* bignum module working area */
@@ -118,6 +123,12 @@ struct ENV
       /* last start time to compute time spent */
       size_t last_mem_tpeak;
       /* last peak value of mem_total */
+      /*--------------------------------------------------------------*/
+      /* multi-threading support */
+      void *mt_lock;
+      /* mutex used to serialize memory allocation and terminal output
+       * while worker threads started by thread_run are running; NULL
+       * means that no worker threads exist */
 };
 
 struct MBD
@@ -254,6 +265,12 @@ void glp_free(void *ptr);
 /* free memory block */
 #endif
 
+#if 1 /* 17/X-2026 */
+#define mem_free_all _glp_mem_free_all
+void mem_free_all(ENV *env);
+/* free all memory blocks */
+#endif
+
 void glp_mem_limit(int limit);
 /* set memory usage limit */
 
@@ -319,6 +336,34 @@ void *xdlsym(void *h, const char *symbol);
 void xdlclose(void *h);
 /* close dynamically linked library */
 
+#define thread_avail _glp_thread_avail
+int thread_avail(void);
+/* check if multi-threading is supported */
+
+#define mutex_create _glp_mutex_create
+void *mutex_create(void);
+/* create mutual exclusion object */
+
+#define mutex_lock _glp_mutex_lock
+void mutex_lock(void *mutex);
+/* lock mutex */
+
+#define mutex_unlock _glp_mutex_unlock
+void mutex_unlock(void *mutex);
+/* unlock mutex */
+
+#define mutex_delete _glp_mutex_delete
+void mutex_delete(void *mutex);
+/* delete mutex */
+
+#define thread_run _glp_thread_run
+void thread_run(int nt, void (*func)(void *info, int t), void *info);
+/* run routine in parallel threads */
+
+#define thread_error _glp_thread_error
+glp_errfunc thread_error(const char *file, int line);
+/* intercept error detected in parallel thread */
+
 #endif
 
 /* eof */
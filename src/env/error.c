@@ -59,6 +59,14 @@ static void errfunc(const char *fmt, ...)
 
 glp_errfunc glp_error_(const char *file, int line)
 {     ENV *env = get_env_ptr();
+#if 1 /* 17/X-2026 */
+      glp_errfunc func;
+      /* errors detected in parallel threads are raised later by the
+       * routine thread_run in the calling thread */
+      func = thread_error(file, line);
+      if (func != NULL)
+         return func;
+#endif
       env->err_file = file;
       env->err_line = line;
       return errfunc;
@@ -41,10 +41,13 @@ void glp_puts(const char *s)
       /* if terminal output is disabled, do nothing */
       if (!env->term_out)
          goto skip;
+      /* serialize output, if worker threads exist */
+      if (env->mt_lock != NULL)
+         mutex_lock(env->mt_lock);
       /* pass the string to the hook routine, if defined */
       if (env->term_hook != NULL)
       {  if (env->term_hook(env->term_info, s) != 0)
-            goto skip;
+            goto fini;
       }
       /* write the string on the terminal */
       fputs(s, stdout);
@@ -54,6 +57,8 @@ void glp_puts(const char *s)
       {  fputs(s, env->tee_file);
          fflush(env->tee_file);
       }
+fini: if (env->mt_lock != NULL)
+         mutex_unlock(env->mt_lock);
 skip: return;
 }
 
@@ -77,6 +82,9 @@ void glp_printf(const char *fmt, ...)
       /* if terminal output is disabled, do nothing */
       if (!env->term_out)
          goto skip;
+      /* the output buffer is shared by all worker threads */
+      if (env->mt_lock != NULL)
+         mutex_lock(env->mt_lock);
       /* format the output */
       va_start(arg, fmt);
       vsprintf(env->term_buf, fmt, arg);
@@ -85,6 +93,8 @@ void glp_printf(const char *fmt, ...)
       va_end(arg);
       /* write the formatted output on the terminal */
       glp_puts(env->term_buf);
+      if (env->mt_lock != NULL)
+         mutex_unlock(env->mt_lock);
 skip: return;
 }
 
@@ -108,12 +118,17 @@ void glp_vprintf(const char *fmt, va_list arg)
       /* if terminal output is disabled, do nothing */
       if (!env->term_out)
          goto skip;
+      /* the output buffer is shared by all worker threads */
+      if (env->mt_lock != NULL)
+         mutex_lock(env->mt_lock);
       /* format the output */
       vsprintf(env->term_buf, fmt, arg);
       /* (do not use xassert) */
       assert(strlen(env->term_buf) < TBUF_SIZE);
       /* write the formatted output on the terminal */
       glp_puts(env->term_buf);
+      if (env->mt_lock != NULL)
+         mutex_unlock(env->mt_lock);
 skip: return;
 }
 
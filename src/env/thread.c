@@ -0,0 +1,402 @@
+/* thread.c (multi-threading support) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <assert.h>
+#include "env.h"
+
+/* multi-threading needs thread local storage to give each worker
+ * thread access to the environment block of the calling thread */
+
+#if defined(TLS) && defined(HAVE_PTHREAD)
+#define MT_PTHREAD 1
+#include <pthread.h>
+#elif defined(TLS) && defined(__WOE__)
+#define MT_WIN32 1
+#include <windows.h>
+#endif
+
+#define MAX_LOCKS 8
+/* maximal number of mutexes locked by a thread at the same time */
+
+struct worker
+{     /* worker thread descriptor */
+      ENV *env;
+      /* environment block of the calling thread */
+      void (*func)(void *info, int t);
+      /* routine to be run */
+      void *info;
+      /* transit pointer passed to the routine */
+      int t;
+      /* ordinal number of the worker, 1 <= t <= nt-1 */
+      int ok;
+      /* flag set if the thread has been successfully created */
+#if defined(MT_PTHREAD)
+      pthread_t tid;
+#elif defined(MT_WIN32)
+      HANDLE tid;
+#endif
+      jmp_buf jump;
+      /* long-jump point used to leave the routine func on error */
+      int fail;
+      /* flag set if the routine func has called xerror or xassert */
+      const char *file;
+      /* value of the __FILE__ macro passed to xerror */
+      int line;
+      /* value of the __LINE__ macro passed to xerror */
+      char msg[TBUF_SIZE];
+      /* error message */
+      int nlock;
+      /* number of mutexes currently locked by the thread */
+      void *lock[MAX_LOCKS];
+      /* lock[0], ..., lock[nlock-1] are mutexes currently locked by
+       * the thread in the order of locking */
+};
+
+#if defined(MT_PTHREAD) || defined(MT_WIN32)
+static TLS struct worker *self = NULL;
+/* descriptor of the task currently run by the thread; NULL means that
+ * the thread is not running the routine func passed to thread_run */
+#endif
+
+/***********************************************************************
+*  NAME
+*
+*  thread_avail - check if multi-threading is supported
+*
+*  SYNOPSIS
+*
+*  #include "env.h"
+*  int thread_avail(void);
+*
+*  RETURNS
+*
+*  The routine thread_avail returns non-zero if the GLPK library was
+*  configured with multi-threading support, and zero otherwise. In the
+*  latter case the routine thread_run runs all its tasks sequentially
+*  in the calling thread. */
+
+int thread_avail(void)
+{
+#if defined(MT_PTHREAD) || defined(MT_WIN32)
+      return 1;
+#else
+      return 0;
+#endif
+}
+
+/***********************************************************************
+*  NAME
+*
+*  mutex_create - create mutual exclusion object
+*
+*  SYNOPSIS
+*
+*  #include "env.h"
+*  void *mutex_create(void);
+*
+*  DESCRIPTION
+*
+*  The routine mutex_create creates a recursive mutual exclusion object
+*  (mutex) and returns a handle to it. If multi-threading is not
+*  supported, the routine returns a dummy non-NULL handle, in which case
+*  locking and unlocking the mutex has no effect.
+*
+*  Note that the mutex is allocated with malloc (not glp_alloc), since
+*  it is used to serialize the memory allocation routines. */
+
+void *mutex_create(void)
+{
+#if defined(MT_PTHREAD)
+      pthread_mutex_t *mutex;
+      pthread_mutexattr_t attr;
+      mutex = malloc(sizeof(pthread_mutex_t));
+      if (mutex == NULL)
+         xerror("mutex_create: no memory available\n");
+      pthread_mutexattr_init(&attr);
+      pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+      if (pthread_mutex_init(mutex, &attr) != 0)
+         xerror("mutex_create: unable to initialize mutex\n");
+      pthread_mutexattr_destroy(&attr);
+      return mutex;
+#elif defined(MT_WIN32)
+      CRITICAL_SECTION *mutex;
+      mutex = malloc(sizeof(CRITICAL_SECTION));
+      if (mutex == NULL)
+         xerror("mutex_create: no memory available\n");
+      InitializeCriticalSection(mutex);
+      return mutex;
+#else
+      static char dummy;
+      return &dummy;
+#endif
+}
+
+/**********************************************************************/
+
+void mutex_lock(void *mutex)
+{     /* lock mutex */
+      xassert(mutex != NULL);
+#if defined(MT_PTHREAD) || defined(MT_WIN32)
+      if (self != NULL && self->nlock == MAX_LOCKS)
+         xerror("mutex_lock: too many mutexes locked\n");
+#endif
+#if defined(MT_PTHREAD)
+      pthread_mutex_lock(mutex);
+#elif defined(MT_WIN32)
+      EnterCriticalSection(mutex);
+#endif
+#if defined(MT_PTHREAD) || defined(MT_WIN32)
+      /* remember the mutex to release it on error */
+      if (self != NULL)
+         self->lock[self->nlock++] = mutex;
+#endif
+      return;
+}
+
+/**********************************************************************/
+
+void mutex_unlock(void *mutex)
+{     /* unlock mutex */
+      xassert(mutex != NULL);
+#if defined(MT_PTHREAD) || defined(MT_WIN32)
+      if (self != NULL)
+      {  int k;
+         for (k = self->nlock-1; k >= 0; k--)
+         {  if (self->lock[k] == mutex)
+               break;
+         }
+         xassert(k >= 0);
+         self->nlock--;
+         for (; k < self->nlock; k++)
+            self->lock[k] = self->lock[k+1];
+      }
+#endif
+#if defined(MT_PTHREAD)
+      pthread_mutex_unlock(mutex);
+#elif defined(MT_WIN32)
+      LeaveCriticalSection(mutex);
+#endif
+      return;
+}
+
+/**********************************************************************/
+
+void mutex_delete(void *mutex)
+{     /* delete mutex */
+      xassert(mutex != NULL);
+#if defined(MT_PTHREAD)
+      pthread_mutex_destroy(mutex);
+      free(mutex);
+#elif defined(MT_WIN32)
+      DeleteCriticalSection(mutex);
+      free(mutex);
+#endif
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  thread_run - run routine in parallel threads
+*
+*  SYNOPSIS
+*
+*  #include "env.h"
+*  void thread_run(int nt, void (*func)(void *info, int t),
+*     void *info);
+*
+*  DESCRIPTION
+*
+*  The routine thread_run calls the routine func exactly once for each
+*  t = 0, 1, ..., nt-1, passing to it the transit pointer info and the
+*  ordinal number t. The call with t = 0 is made in the calling thread
+*  while other calls are made concurrently in nt-1 worker threads. The
+*  routine thread_run returns only after all the calls have returned.
+*
+*  All worker threads share the environment block of the calling
+*  thread. While they are running, the memory allocation routines and
+*  the terminal output routines are serialized with a mutex stored in
+*  the environment block, so the routine func may allocate and free
+*  memory blocks and write messages as usual. However, it must neither
+*  call the error handling routines other than xerror and xassert, nor
+*  change the environment settings.
+*
+*  If some call to the routine func (including the one made in the
+*  calling thread) detects an error with xerror or xassert, the error
+*  is not raised at once. Instead, the error message is stored, the
+*  mutexes locked by the failed call are unlocked, and the call is
+*  abandoned by a long jump within its own thread, while other calls
+*  continue running. Once all the threads have finished, the routine
+*  thread_run raises the error of the failed call with the smallest t
+*  in the calling thread as if xerror were called there. Thus, the
+*  environment block is never changed by the error handling routines
+*  while worker threads exist. Note that memory blocks allocated by
+*  the failed call are not freed.
+*
+*  If multi-threading is not supported, or if the routine thread_run
+*  is called from a worker thread (nested parallelism is not allowed),
+*  or if a worker thread cannot be created, the corresponding calls to
+*  the routine func are made sequentially in the calling thread. */
+
+#if defined(MT_PTHREAD) || defined(MT_WIN32)
+static void run_task(struct worker *w)
+{     /* run the routine func in the current thread */
+      w->fail = w->nlock = 0;
+      self = w;
+      if (setjmp(w->jump) == 0)
+         w->func(w->info, w->t);
+      self = NULL;
+      return;
+}
+
+static void task_error(const char *fmt, ...)
+{     /* store error message and leave the routine func */
+      struct worker *w = self;
+      va_list arg;
+      va_start(arg, fmt);
+      vsprintf(w->msg, fmt, arg);
+      /* (do not use xassert) */
+      assert(strlen(w->msg) < TBUF_SIZE);
+      va_end(arg);
+      w->fail = 1;
+      /* unlock mutexes still locked by the failed call */
+      while (w->nlock > 0)
+         mutex_unlock(w->lock[w->nlock-1]);
+      longjmp(w->jump, 1);
+      /* no return */
+}
+
+#if defined(MT_PTHREAD)
+static void *worker_func(void *arg)
+#else
+static DWORD WINAPI worker_func(LPVOID arg)
+#endif
+{     struct worker *w = arg;
+      /* worker thread uses environment block of the calling thread */
+      tls_set_ptr(w->env);
+      run_task(w);
+      tls_set_ptr(NULL);
+      return 0;
+}
+#endif
+
+/***********************************************************************
+*  NAME
+*
+*  thread_error - intercept error detected in parallel thread
+*
+*  SYNOPSIS
+*
+*  #include "env.h"
+*  glp_errfunc thread_error(const char *file, int line);
+*
+*  DESCRIPTION
+*
+*  The routine thread_error is called on entry to xerror and xassert.
+*  If the current thread is running a call to the routine func passed
+*  to thread_run, the routine thread_error stores the values of file
+*  and line in the task descriptor.
+*
+*  RETURNS
+*
+*  If the error has been intercepted, the routine thread_error returns
+*  a pointer to the routine which stores the error message and abandons
+*  the call to func (see thread_run). Otherwise, NULL is returned, in
+*  which case the error should be handled as usual. */
+
+glp_errfunc thread_error(const char *file, int line)
+{
+#if defined(MT_PTHREAD) || defined(MT_WIN32)
+      if (self != NULL)
+      {  self->file = file;
+         self->line = line;
+         return task_error;
+      }
+#endif
+      return NULL;
+}
+
+void thread_run(int nt, void (*func)(void *info, int t), void *info)
+{     ENV *env = get_env_ptr();
+      struct worker *w;
+      int t;
+      xassert(nt >= 1);
+      if (nt == 1 || !thread_avail() || env->mt_lock != NULL)
+      {  /* run all tasks sequentially */
+         for (t = 0; t < nt; t++)
+            func(info, t);
+         goto done;
+      }
+      w = talloc(nt, struct worker);
+      /* serialize access to the environment block */
+      env->mt_lock = mutex_create();
+      /* start worker threads */
+      for (t = 1; t < nt; t++)
+      {  w[t].env = env;
+         w[t].func = func;
+         w[t].info = info;
+         w[t].t = t;
+#if defined(MT_PTHREAD)
+         w[t].ok = (pthread_create(&w[t].tid, NULL, worker_func, &w[t])
+            == 0);
+#elif defined(MT_WIN32)
+         w[t].tid = CreateThread(NULL, 0, worker_func, &w[t], 0, NULL);
+         w[t].ok = (w[t].tid != NULL);
+#endif
+      }
+      /* the calling thread is worker 0 */
+      w[0].env = env;
+      w[0].func = func;
+      w[0].info = info;
+      w[0].t = 0;
+      run_task(&w[0]);
+      /* wait for worker threads to finish */
+      for (t = 1; t < nt; t++)
+      {  if (!w[t].ok)
+         {  /* thread was not created; run its task here */
+            run_task(&w[t]);
+            continue;
+         }
+#if defined(MT_PTHREAD)
+         pthread_join(w[t].tid, NULL);
+#elif defined(MT_WIN32)
+         WaitForSingleObject(w[t].tid, INFINITE);
+         CloseHandle(w[t].tid);
+#endif
+      }
+      mutex_delete(env->mt_lock);
+      env->mt_lock = NULL;
+      /* raise the error detected by some call to func, if any, now
+       * when no worker threads exist */
+      for (t = 0; t < nt; t++)
+      {  if (w[t].fail)
+            glp_error_(w[t].file, w[t].line)("%s", w[t].msg);
+      }
+      tfree(w);
+done: return;
+}
+
+/* eof */
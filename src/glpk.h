@@ -104,7 +104,12 @@ typedef struct
       double upd_tol;         /* (not used) */
       int nrs_max;            /* scfint.nn_max */
       int rs_size;            /* (not used) */
-      double foo_bar[38];     /* (reserved) */
+#if 1 /* 17/X-2026 */
+      int threads;            /* btfint.nt */
+      int sva_slack;          /* sva.slack */
+      int mkz_bnd;            /* sgf_mkz_bnd */
+#endif
+      double foo_bar[36];     /* (reserved) */
 } glp_bfcp;
 
 typedef struct
@@ -122,6 +127,9 @@ typedef struct
       int pricing;            /* pricing technique: */
 #define GLP_PT_STD      0x11  /* standard (Dantzig's rule) */
 #define GLP_PT_PSE      0x22  /* projected steepest edge */
+#if 1 /* 17/X-2026 */
+#define GLP_PT_PARTIAL  0x33  /* partial pricing (Dantzig's rule) */
+#endif
       int r_test;             /* ratio test technique: */
 #define GLP_RT_STD      0x11  /* standard (textbook) */
 #define GLP_RT_HAR      0x22  /* Harris' two-pass ratio test */
@@ -144,11 +152,14 @@ typedef struct
       int aorn;               /* option to use A or N: */
 #define GLP_USE_AT         1  /* use A matrix in row-wise format */
 #define GLP_USE_NT         2  /* use N matrix in row-wise format */
+#if 1 /* 17/X-2026 */
+      int incr;               /* incremental mode (GLP_ON/GLP_OFF) */
+#endif
 #ifdef CSL_MULTI_OBJECTIVE
      int mobj;               /* flag enable/disable multiobjective */
      double foo_bar[33];     /* reserved */
 #else
-     double foo_bar[33];     /* (reserved) */
+     double foo_bar[32];     /* (reserved) */
 #endif
 #endif
 } glp_smcp;
@@ -161,7 +172,13 @@ typedef struct
 #define GLP_ORD_QMD        1  /* quotient minimum degree (QMD) */
 #define GLP_ORD_AMD        2  /* approx. minimum degree (AMD) */
 #define GLP_ORD_SYMAMD     3  /* approx. minimum degree (SYMAMD) */
-      double foo_bar[48];     /* (reserved) */
+#if 1 /* 17/X-2026 */
+      int threads;            /* number of threads for Cholesky */
+      int crossover;          /* find optimal basis (GLP_ON/GLP_OFF) */
+      int mcc;                /* max number of centrality correctors */
+      int ubnd;               /* handle upper bounds directly */
+#endif
+      double foo_bar[46];     /* (reserved) */
 } glp_iptcp;
 
 typedef struct glp_tree glp_tree;
@@ -176,6 +193,9 @@ typedef struct
 #define GLP_BR_MFV         3  /* most fractional variable */
 #define GLP_BR_DTH         4  /* heuristic by Driebeck and Tomlin */
 #define GLP_BR_PCH         5  /* hybrid pseudocost heuristic */
+#if 1 /* 17/X-2026 */
+#define GLP_BR_RLB         6  /* reliability branching */
+#endif
       int bt_tech;            /* backtracking technique: */
 #define GLP_BT_DFS         1  /* depth first search */
 #define GLP_BT_BFS         2  /* breadth first search */
@@ -213,7 +233,18 @@ typedef struct
 #if 1 /* 16/III-2016; not documented--should not be used */
       int flip;               /* use long-step dual simplex */
 #endif
-      double foo_bar[23];     /* (reserved) */
+#if 1 /* 16/X-2026 */
+      int threads;            /* number of threads for node evaluation */
+      int sb_par;             /* parallel strong branching */
+#endif
+#if 1 /* 17/X-2026 */
+      int rel_min;            /* reliability threshold */
+      int sb_nd_lim;          /* SB iteration limit per node */
+      int sb_it_lim;          /* SB iteration limit in total */
+      int nf_mem;             /* node file memory threshold (Mb) */
+      const char *nf_dir;     /* directory to create node files in */
+#endif
+      double foo_bar[19];     /* (reserved) */
 } glp_iocp;
 
 typedef struct
@@ -554,6 +585,12 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm);
 void glp_init_iptcp(glp_iptcp *parm);
 /* initialize interior-point solver control parameters */
 
+#if 1 /* 16/X-2026 */
+int glp_concurrent(glp_prob *P, const glp_smcp *smcp,
+      const glp_iptcp *iptcp, int *sol);
+/* solve LP with concurrent optimizer */
+#endif
+
 int glp_ipt_status(glp_prob *P);
 /* retrieve status of interior-point solution */
 
@@ -646,6 +683,12 @@ int glp_factorize(glp_prob *P);
 int glp_bf_updated(glp_prob *P);
 /* check if LP basis factorization has been updated */
 
+#if 1 /* 17/X-2026 */
+void glp_bf_stats(glp_prob *P, int *n_defrag, int *n_resize,
+      double *moved);
+/* retrieve LP basis factorization storage statistics */
+#endif
+
 void glp_get_bfcp(glp_prob *P, glp_bfcp *parm);
 /* retrieve LP basis factorization control parameters */
 
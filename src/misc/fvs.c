@@ -23,6 +23,9 @@
 
 #include "env.h"
 #include "fvs.h"
+#if 1 /* 17/X-2026 */
+#include "vscan.h"
+#endif
 
 void fvs_alloc_vec(FVS *x, int n)
 {     /* allocate sparse vector */
@@ -69,12 +72,17 @@ void fvs_gather_vec(FVS *x, double eps)
       int *ind = x->ind;
       double *vec = x->vec;
       int j, nnz = 0;
+#if 0 /* 17/X-2026 */
       for (j = n; j >= 1; j--)
       {  if (-eps < vec[j] && vec[j] < +eps)
             vec[j] = 0.0;
          else
             ind[++nnz] = j;
       }
+#else
+      for (j = n; (j = vscan_prev(vec, eps, j)) >= 1; j--)
+         ind[++nnz] = j;
+#endif
       x->nnz = nnz;
       return;
 }
@@ -0,0 +1,506 @@
+/* spadat.c (computing normal equation matrix S = P*A*D*A'*P') */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "env.h"
+#include "spadat.h"
+
+/***********************************************************************
+*  The routines in this module compute the symmetric matrix
+*  S = P*A*D*A'*P' in the same way as the routine adat_numeric (see
+*  glpmat.c) does, however, they are intended to be used when S has to
+*  be computed many times for the same A and different D, as on
+*  iterations of the interior-point method.
+*
+*  Element s[ii,jj] of S, where ii = P[i] and jj = P[j], is the sum of
+*  products a[i,k] * d[k,k] * a[j,k] over all k such that a[i,k] and
+*  a[j,k] both are non-zero. Once the patterns of A and S are known,
+*  the routine spadat_create determines, for each element of S, the
+*  list of pairs (p, q) of locations in the arrays A_ind and A_val,
+*  where p refers to a[i,k] and q refers to a[j,k] (the scatter map).
+*  Then the routine spadat_numeric computes w[p] = a[i,k] * d[k,k] for
+*  all non-zeros of A and sums products w[p] * a[j,k] streaming through
+*  the lists, so no search is needed. The products are summed in the
+*  same order as in adat_numeric, so the results are exactly the same.
+*
+*  If the scatter map would take too much memory, the routine
+*  spadat_numeric uses the algorithm of adat_numeric.
+*
+*  Rows of S are computed independently of each other, so if more than
+*  one thread is specified, the rows are divided into chunks of nearly
+*  the same amount of work, which are processed in parallel threads. */
+
+struct SPADAT
+{     /* workspace to compute S = P*A*D*A'*P' */
+      int m;
+      /* number of rows in A, order of S */
+      int n;
+      /* number of columns in A */
+      const int *P_per; /* const int P_per[1+m+m]; */
+      const int *A_ptr; /* const int A_ptr[1+m+1]; */
+      const int *A_ind; /* const int A_ind[A_ptr[m+1]]; */
+      const int *S_ptr; /* const int S_ptr[1+m+1]; */
+      const int *S_ind; /* const int S_ind[S_ptr[m+1]]; */
+      /* permutation matrix P and patterns of A and S (see comments to
+       * the routine adat_numeric); these arrays are not copied */
+      int size;
+      /* total number of pairs in the scatter map; size = 0 means that
+       * the scatter map is not used */
+      int *sl_ptr; /* int sl_ptr[1+nnz+m+1]; */
+      /* non-zeros of S are numbered row by row, so elements of ii-th
+       * row (in the same order as in S_ind) are followed by diagonal
+       * element s[ii,ii]; pairs for s-th element are stored in
+       * locations sl_ptr[s], ..., sl_ptr[s+1]-1 of the arrays pp and
+       * qq; nnz is the number of non-diagonal elements of S */
+      int *pp; /* int pp[1+size]; */
+      int *qq; /* int qq[1+size]; */
+      /* the scatter map */
+      double *w; /* double w[A_ptr[m+1]]; */
+      /* w[p] = a[i,k] * d[k,k], where a[i,k] is stored in location p
+       * of A_val */
+      int nt;
+      /* number of threads */
+      int nc;
+      /* number of chunks */
+      int *ch_beg; /* int ch_beg[1+nc+1]; */
+      /* c-th chunk consists of rows ch_beg[c], ..., ch_beg[c+1]-1 of
+       * S */
+      double *work; /* double work[nt*(1+n)]; */
+      /* working arrays used if the scatter map is not used */
+};
+
+/* maximal average number of pairs per element of S to build the
+ * scatter map */
+#define MAP_RATIO 8.0
+
+/* maximal number of pairs in the scatter map */
+#define MAP_MAX 1e8
+
+/* minimal amount of work to use parallel threads */
+#define PAR_MIN 1e5
+
+static int row_pairs(SPADAT *sa, int ii, int pos[], int s, int pp[],
+      int qq[], int sl_ptr[])
+{     /* determine pairs for elements of ii-th row of S, whose first
+       * element has number s (see above); if pp is NULL, only count
+       * the pairs */
+      const int *P_per = sa->P_per;
+      const int *A_ptr = sa->A_ptr;
+      const int *A_ind = sa->A_ind;
+      const int *S_ptr = sa->S_ptr;
+      const int *S_ind = sa->S_ind;
+      int m = sa->m;
+      int i, j, t, p, q, cnt;
+      cnt = 0;
+      i = P_per[ii];
+      for (p = A_ptr[i]; p < A_ptr[i+1]; p++)
+         pos[A_ind[p]] = p;
+      for (t = S_ptr[ii]; t < S_ptr[ii+1]; t++, s++)
+      {  j = P_per[S_ind[t]];
+         xassert(1 <= j && j <= m);
+         if (pp != NULL)
+            sl_ptr[s] = sl_ptr[0] + cnt;
+         for (q = A_ptr[j]; q < A_ptr[j+1]; q++)
+         {  if ((p = pos[A_ind[q]]) != 0)
+            {  cnt++;
+               if (pp != NULL)
+                  pp[sl_ptr[0]+cnt-1] = p, qq[sl_ptr[0]+cnt-1] = q;
+            }
+         }
+      }
+      /* diagonal element */
+      if (pp != NULL)
+         sl_ptr[s] = sl_ptr[0] + cnt;
+      for (p = A_ptr[i]; p < A_ptr[i+1]; p++)
+      {  cnt++;
+         if (pp != NULL)
+            pp[sl_ptr[0]+cnt-1] = qq[sl_ptr[0]+cnt-1] = p;
+         pos[A_ind[p]] = 0;
+      }
+      return cnt;
+}
+
+/***********************************************************************
+*  spadat_create - prepare computing S = P*A*D*A'*P'
+*
+*  This routine creates the workspace used by the routine
+*  spadat_numeric to compute S = P*A*D*A'*P'.
+*
+*  The parameters m, n, P_per, A_ptr, A_ind, S_ptr, and S_ind have the
+*  same meaning as for the routine adat_numeric (the pattern of S is
+*  assumed to be computed with the routine adat_symbolic). Note that
+*  these arrays are not copied and should not be changed while the
+*  workspace exists.
+*
+*  The parameter nt specifies the number of threads to be used,
+*  1 <= nt <= 256. It is ignored if multi-threading is not supported. */
+
+SPADAT *spadat_create(int m, int n, const int P_per[],
+      const int A_ptr[], const int A_ind[], const int S_ptr[],
+      const int S_ind[], int nt)
+{     SPADAT *sa;
+      int ii, nnz, c, cnt, *pos;
+      double size, *cost, sum, total;
+      xassert(m > 0 && n > 0);
+      xassert(1 <= nt && nt <= 256);
+      sa = talloc(1, SPADAT);
+      sa->m = m;
+      sa->n = n;
+      sa->P_per = P_per;
+      sa->A_ptr = A_ptr;
+      sa->A_ind = A_ind;
+      sa->S_ptr = S_ptr;
+      sa->S_ind = S_ind;
+      nnz = S_ptr[m+1] - 1;
+      /* count pairs in the scatter map; the number of pairs in each
+       * row of S also estimates the work needed to compute it */
+      pos = talloc(1+n, int);
+      memset(&pos[1], 0, n * sizeof(int));
+      cost = talloc(1+m, double);
+      size = 0.0;
+      for (ii = 1; ii <= m; ii++)
+      {  cnt = row_pairs(sa, ii, pos, 0, NULL, NULL, NULL);
+         cost[ii] = (double)cnt;
+         size += (double)cnt;
+      }
+      /* build the scatter map, if it is not too large */
+      if (size <= MAP_RATIO * (double)(nnz + m) && size <= MAP_MAX)
+      {  int s, *sl_ptr;
+         sa->size = (int)size;
+         sl_ptr = sa->sl_ptr = talloc(1+nnz+m+1, int);
+         sa->pp = talloc(1+sa->size, int);
+         sa->qq = talloc(1+sa->size, int);
+         sa->w = talloc(A_ptr[m+1], double);
+         /* sl_ptr[0] is used to pass pointer to first free location */
+         sl_ptr[0] = 1;
+         for (ii = 1, s = 1; ii <= m; ii++)
+         {  sl_ptr[0] += row_pairs(sa, ii, pos, s, sa->pp, sa->qq,
+               sl_ptr);
+            s += (S_ptr[ii+1] - S_ptr[ii]) + 1;
+         }
+         xassert(s == nnz + m + 1);
+         xassert(sl_ptr[0] == sa->size + 1);
+         sl_ptr[s] = sl_ptr[0];
+      }
+      else
+      {  sa->size = 0;
+         sa->sl_ptr = sa->pp = sa->qq = NULL;
+         sa->w = NULL;
+      }
+      /* divide rows of S into chunks */
+      sa->nt = (thread_avail() ? nt : 1);
+      if (size < PAR_MIN)
+         sa->nt = 1;
+      sa->nc = (sa->nt == 1 ? 1 : 8 * sa->nt);
+      if (sa->nc > m)
+         sa->nc = m;
+      sa->ch_beg = talloc(1+sa->nc+1, int);
+      total = size, sum = 0.0;
+      sa->ch_beg[1] = 1;
+      for (ii = 1, c = 1; ii <= m; ii++)
+      {  /* row ii starts a new chunk, if previous chunks have taken
+          * their share of work */
+         if (c < sa->nc && sum >= total * (double)c / (double)sa->nc)
+            sa->ch_beg[++c] = ii;
+         sum += cost[ii];
+      }
+      sa->nc = c;
+      sa->ch_beg[c+1] = m+1;
+      sa->work = (sa->size == 0 ? talloc(sa->nt * (1+n), double) :
+         NULL);
+      if (sa->work != NULL)
+      {  for (c = 0; c < sa->nt * (1+n); c++)
+            sa->work[c] = 0.0;
+      }
+      tfree(pos);
+      tfree(cost);
+      return sa;
+}
+
+/***********************************************************************
+*  compute_rows - compute rows of S
+*
+*  This routine computes rows ii = beg, ..., end-1 of S, using working
+*  array of t-th thread. */
+
+static void compute_rows(SPADAT *sa, int beg, int end, int t,
+      const double A_val[], const double D_diag[], double S_val[],
+      double S_diag[])
+{     const int *P_per = sa->P_per;
+      const int *A_ptr = sa->A_ptr;
+      const int *A_ind = sa->A_ind;
+      const int *S_ptr = sa->S_ptr;
+      const int *S_ind = sa->S_ind;
+      int i, j, k, ii, p, q, r, s, end1;
+      double sum;
+      if (sa->size != 0)
+      {  /* stream through the scatter map */
+         const int *sl_ptr = sa->sl_ptr;
+         const int *pp = sa->pp;
+         const int *qq = sa->qq;
+         const double *w = sa->w;
+         for (ii = beg; ii < end; ii++)
+         {  /* ii-th row starts with element number s */
+            s = S_ptr[ii] + (ii - 1);
+            for (p = S_ptr[ii]; p < S_ptr[ii+1]; p++, s++)
+            {  sum = 0.0;
+               for (r = sl_ptr[s], end1 = sl_ptr[s+1]; r < end1; r++)
+                  sum += w[pp[r]] * A_val[qq[r]];
+               S_val[p] = sum;
+            }
+            sum = 0.0;
+            for (r = sl_ptr[s], end1 = sl_ptr[s+1]; r < end1; r++)
+               sum += w[pp[r]] * A_val[qq[r]];
+            S_diag[ii] = sum;
+         }
+      }
+      else
+      {  /* use the algorithm of adat_numeric */
+         double *work = sa->work + t * (1+sa->n);
+         for (ii = beg; ii < end; ii++)
+         {  i = P_per[ii];
+            for (p = A_ptr[i]; p < A_ptr[i+1]; p++)
+               work[A_ind[p]] = A_val[p];
+            for (p = S_ptr[ii]; p < S_ptr[ii+1]; p++)
+            {  j = P_per[S_ind[p]];
+               sum = 0.0;
+               for (q = A_ptr[j]; q < A_ptr[j+1]; q++)
+               {  k = A_ind[q];
+                  sum += work[k] * D_diag[k] * A_val[q];
+               }
+               S_val[p] = sum;
+            }
+            sum = 0.0;
+            for (p = A_ptr[i]; p < A_ptr[i+1]; p++)
+            {  k = A_ind[p];
+               sum += A_val[p] * D_diag[k] * A_val[p];
+               work[k] = 0.0;
+            }
+            S_diag[ii] = sum;
+         }
+      }
+      return;
+}
+
+struct task
+{     /* data passed to threads */
+      SPADAT *sa;
+      const double *A_val, *D_diag;
+      double *S_val, *S_diag;
+      void *mutex;
+      /* mutex to claim chunks */
+      int next;
+      /* next chunk to be processed */
+};
+
+static void task_func(void *info, int t)
+{     /* compute chunks of rows in t-th thread */
+      struct task *task = info;
+      SPADAT *sa = task->sa;
+      int c;
+      for (;;)
+      {  mutex_lock(task->mutex);
+         c = task->next++;
+         mutex_unlock(task->mutex);
+         if (c > sa->nc)
+            break;
+         compute_rows(sa, sa->ch_beg[c], sa->ch_beg[c+1], t,
+            task->A_val, task->D_diag, task->S_val, task->S_diag);
+      }
+      return;
+}
+
+/***********************************************************************
+*  spadat_numeric - compute S = P*A*D*A'*P' (numeric phase)
+*
+*  This routine computes the matrix S = P*A*D*A'*P'. The parameters
+*  A_val, D_diag, S_val, and S_diag have the same meaning as for the
+*  routine adat_numeric. */
+
+void spadat_numeric(SPADAT *sa, const double A_val[],
+      const double D_diag[], double S_val[], double S_diag[])
+{     if (sa->size != 0)
+      {  /* w[p] := a[i,k] * d[k,k] */
+         const int *A_ind = sa->A_ind;
+         double *w = sa->w;
+         int p, nnz = sa->A_ptr[sa->m+1] - 1;
+         for (p = 1; p <= nnz; p++)
+            w[p] = A_val[p] * D_diag[A_ind[p]];
+      }
+      if (sa->nt == 1)
+         compute_rows(sa, 1, sa->m+1, 0, A_val, D_diag, S_val,
+            S_diag);
+      else
+      {  struct task task;
+         task.sa = sa;
+         task.A_val = A_val, task.D_diag = D_diag;
+         task.S_val = S_val, task.S_diag = S_diag;
+         task.mutex = mutex_create();
+         task.next = 1;
+         thread_run(sa->nt, task_func, &task);
+         mutex_delete(task.mutex);
+      }
+      return;
+}
+
+/***********************************************************************
+*  spadat_size - determine size of scatter map
+*
+*  This routine returns the number of pairs in the scatter map, or 0 if
+*  the scatter map is not used. */
+
+int spadat_size(SPADAT *sa)
+{     return sa->size;
+}
+
+/***********************************************************************
+*  spadat_delete - delete workspace
+*
+*  This routine deletes the workspace created by spadat_create. */
+
+void spadat_delete(SPADAT *sa)
+{     if (sa->sl_ptr != NULL)
+         tfree(sa->sl_ptr);
+      if (sa->pp != NULL)
+         tfree(sa->pp);
+      if (sa->qq != NULL)
+         tfree(sa->qq);
+      if (sa->w != NULL)
+         tfree(sa->w);
+      tfree(sa->ch_beg);
+      if (sa->work != NULL)
+         tfree(sa->work);
+      tfree(sa);
+      return;
+}
+
+#ifdef GLP_TEST
+/***********************************************************************
+*  This is a benchmark program, which compares the routines
+*  adat_numeric and spadat_numeric on constraint matrices of real LP
+*  problems.
+*
+*  Usage: spadat problem [nt]
+*
+*  The problem should be specified in free MPS format (or in CPLEX LP
+*  format, if the file name ends with '.lp'). The program computes
+*  S = A*D*A' for the constraint matrix A, where D is a random positive
+*  diagonal matrix, and reports average time of computing S with each
+*  routine (nt is the number of threads used by spadat_numeric) and
+*  the maximal difference between the results.
+*
+*  To build the program, compile this file with -DGLP_TEST and link it
+*  with the static GLPK library, for example:
+*
+*     cd glpk/src
+*     gcc -O2 -DGLP_TEST -I. -Idraft -Ienv -Imisc misc/spadat.c \
+*        .libs/libglpk.a -lm -o spadatbench */
+
+#include "glpk.h"
+#include "glpmat.h"
+
+int main(int argc, char *argv[])
+{     glp_prob *P;
+      SPADAT *sa;
+      int m, n, i, k, cnt, len, nt, ret, *A_ptr, *A_ind, *P_per,
+         *S_ptr, *S_ind;
+      double tm, tm_beg, err, *A_val, *D, *S_val, *S_diag, *T_val,
+         *T_diag;
+      if (!(argc == 2 || argc == 3))
+      {  fprintf(stderr, "Usage: %s problem [nt]\n", argv[0]);
+         return 2;
+      }
+      nt = (argc == 3 ? atoi(argv[2]) : 1);
+      P = glp_create_prob();
+      len = strlen(argv[1]);
+      if (len > 3 && strcmp(argv[1] + len - 3, ".lp") == 0)
+         ret = glp_read_lp(P, NULL, argv[1]);
+      else
+         ret = glp_read_mps(P, GLP_MPS_FILE, NULL, argv[1]);
+      if (ret != 0)
+         return 1;
+      m = glp_get_num_rows(P);
+      n = glp_get_num_cols(P);
+      /* A is constraint matrix in storage-by-rows format */
+      A_ptr = talloc(1+m+1, int);
+      A_ind = talloc(1+glp_get_num_nz(P), int);
+      A_val = talloc(1+glp_get_num_nz(P), double);
+      A_ptr[1] = 1;
+      for (i = 1; i <= m; i++)
+      {  len = glp_get_mat_row(P, i, &A_ind[A_ptr[i]-1],
+            &A_val[A_ptr[i]-1]);
+         /* glp_get_mat_row stores elements in locations 1, ..., len
+          * of the arrays passed, so shift is needed */
+         A_ptr[i+1] = A_ptr[i] + len;
+      }
+      D = talloc(1+n, double);
+      for (k = 1; k <= n; k++)
+         D[k] = exp(20.0 * (rand() / (RAND_MAX + 1.0)) - 10.0);
+      P_per = talloc(1+m+m, int);
+      for (i = 1; i <= m; i++)
+         P_per[i] = P_per[m+i] = i;
+      S_ptr = talloc(1+m+1, int);
+      S_ind = adat_symbolic(m, n, P_per, A_ptr, A_ind, S_ptr);
+      S_val = talloc(S_ptr[m+1], double);
+      S_diag = talloc(1+m, double);
+      T_val = talloc(S_ptr[m+1], double);
+      T_diag = talloc(1+m, double);
+      printf("m = %d; n = %d; nnz(A) = %d; nnz(S) = %d\n", m, n,
+         A_ptr[m+1]-1, S_ptr[m+1]-1 + m);
+      /* compute S with adat_numeric */
+      cnt = 0, tm_beg = glp_time();
+      do
+      {  adat_numeric(m, n, P_per, A_ptr, A_ind, A_val, D, S_ptr,
+            S_ind, S_val, S_diag);
+         cnt++;
+         tm = glp_difftime(glp_time(), tm_beg);
+      } while (tm < 1.0 || cnt < 3);
+      printf("adat_numeric:   %10.3f ms\n", 1000.0 * tm / cnt);
+      /* compute S with spadat_numeric */
+      tm_beg = glp_time();
+      sa = spadat_create(m, n, P_per, A_ptr, A_ind, S_ptr, S_ind, nt);
+      tm = glp_difftime(glp_time(), tm_beg);
+      printf("spadat_create:  %10.3f ms (%d pairs)\n", 1000.0 * tm,
+         spadat_size(sa));
+      cnt = 0, tm_beg = glp_time();
+      do
+      {  spadat_numeric(sa, A_val, D, T_val, T_diag);
+         cnt++;
+         tm = glp_difftime(glp_time(), tm_beg);
+      } while (tm < 1.0 || cnt < 3);
+      printf("spadat_numeric: %10.3f ms (%d thread(s))\n",
+         1000.0 * tm / cnt, nt);
+      err = 0.0;
+      for (k = 1; k < S_ptr[m+1]; k++)
+      {  if (err < fabs(S_val[k] - T_val[k]))
+            err = fabs(S_val[k] - T_val[k]);
+      }
+      for (i = 1; i <= m; i++)
+      {  if (err < fabs(S_diag[i] - T_diag[i]))
+            err = fabs(S_diag[i] - T_diag[i]);
+      }
+      printf("max difference = %g\n", err);
+      spadat_delete(sa);
+      return 0;
+}
+#endif
+
+/* eof */
@@ -0,0 +1,49 @@
+/* spadat.h (computing normal equation matrix S = P*A*D*A'*P') */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#ifndef SPADAT_H
+#define SPADAT_H
+
+typedef struct SPADAT SPADAT;
+
+#define spadat_create _glp_spadat_create
+SPADAT *spadat_create(int m, int n, const int P_per[],
+      const int A_ptr[], const int A_ind[], const int S_ptr[],
+      const int S_ind[], int nt);
+/* prepare computing S = P*A*D*A'*P' */
+
+#define spadat_numeric _glp_spadat_numeric
+void spadat_numeric(SPADAT *sa, const double A_val[],
+      const double D_diag[], double S_val[], double S_diag[]);
+/* compute S = P*A*D*A'*P' (numeric phase) */
+
+#define spadat_size _glp_spadat_size
+int spadat_size(SPADAT *sa);
+/* determine size of scatter map */
+
+#define spadat_delete _glp_spadat_delete
+void spadat_delete(SPADAT *sa);
+/* delete workspace */
+
+#endif
+
+/* eof */
@@ -0,0 +1,710 @@
+/* spchol.c (supernodal sparse Cholesky factorization) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "env.h"
+#include "spchol.h"
+
+/***********************************************************************
+*  The routines in this module compute the Cholesky factorization
+*  A = U'*U of a sparse symmetric positive definite matrix A, whose
+*  pattern has been previously analyzed with the routine chol_symbolic
+*  (see glpmat.c). The factor U is kept in the workspace, and systems
+*  with U and U' are solved with the routines spchol_u_solve and
+*  spchol_ut_solve, which give the same results as the routines u_solve
+*  and ut_solve applied to the factor computed by chol_numeric.
+*
+*  Each element of U is computed with exactly the same sequence of
+*  floating-point operations as in the routine chol_numeric (elements
+*  of A minus products of elements of previous rows of U in ascending
+*  order of the rows, then division by the diagonal element), so the
+*  factor computed is the same, and the interior-point method follows
+*  the same path as with chol_numeric. For the same reason updates are
+*  not accumulated in dense buffers, but subtracted directly.
+*
+*  Row k of U is column k of the lower triangular factor L = U'. It is
+*  known that if column k+1 is the parent of column k in the
+*  elimination tree and the patterns of these columns are the same
+*  (except element l[k+1,k]), both columns can be processed together.
+*  A maximal set of such adjacent columns is called a supernode. The
+*  routine spchol_numeric processes L supernode by supernode in the
+*  left-looking manner: non-zeros of the columns of current supernode
+*  are gathered in a dense matrix (panel), updated by all previously
+*  computed supernodes, which have non-zeros in the rows corresponding
+*  to the columns of current supernode, factorized with the dense
+*  Cholesky algorithm and then stored back to U.
+*
+*  The computation of a supernode depends only on its descendants in
+*  the supernodal elimination tree. Therefore, if more than one thread
+*  is specified, the tree is partitioned into disjoint subtrees, which
+*  are factorized concurrently, after which supernodes near the root
+*  are factorized by the calling thread.
+*
+*  See also:
+*
+*  E.Ng, B.W.Peyton. Block sparse Cholesky algorithms on advanced
+*  uniprocessor computers. SIAM J. Sci. Comput. 14, 1993, 1034-56. */
+
+struct SPCHOL
+{     /* supernodal Cholesky factorization workspace */
+      int n;
+      /* order of matrices A and U */
+      const int *U_ptr; /* const int U_ptr[1+n+1]; */
+      /* row pointers of matrix U (without diagonal) in storage-by-rows
+       * format; elements of each row are stored in ascending order of
+       * column indices (see R_ind below) */
+      int *U_ord; /* int U_ord[U_ptr[n+1]]; */
+      /* U_ord[t] is the location of the element stored in location t
+       * of the original (unsorted) pattern of U specified by the
+       * caller */
+      double *U_val; /* double U_val[U_ptr[n+1]]; */
+      /* non-zero elements of U; the array is allocated on the first
+       * call to the routine spchol_numeric */
+      int ns;
+      /* number of supernodes */
+      int *sn_beg; /* int sn_beg[1+ns+1]; */
+      /* J-th supernode consists of columns sn_beg[J], sn_beg[J]+1,
+       * ..., sn_beg[J+1]-1 of L; sn_beg[ns+1] = n+1 */
+      int *R_ptr; /* int R_ptr[1+ns+1]; */
+      int *R_ind; /* int R_ind[R_ptr[ns+1]]; */
+      /* R_ind[R_ptr[J]], ..., R_ind[R_ptr[J+1]-1] are column indices
+       * (in ascending order) of non-zeros in the last row l of J-th
+       * supernode; row k of U, sn_beg[J] <= k <= l, has non-zeros in
+       * columns k+1, ..., l followed by these columns, so the pattern
+       * of U is stored in compressed form */
+      int *up_ptr; /* int up_ptr[1+ns+1]; */
+      int *up_sn; /* int up_sn[up_ptr[ns+1]]; */
+      int *up_pos; /* int up_pos[up_ptr[ns+1]]; */
+      /* supernodes K = up_sn[t], up_ptr[J] <= t < up_ptr[J+1], are
+       * ones, which update J-th supernode; p = up_pos[t] is position
+       * of first element of (off-diagonal) row pattern of K, which
+       * belongs to a column of J */
+      int nt;
+      /* number of threads */
+      int nw;
+      /* number of subtrees factorized concurrently (nw = 0 means that
+       * all supernodes are factorized by the calling thread) */
+      int *tk_ptr; /* int tk_ptr[1+nw+1]; */
+      int *tk_sn; /* int tk_sn[ns]; */
+      /* supernodes of w-th subtree are tk_sn[t], tk_ptr[w] <= t <
+       * tk_ptr[w+1] (in ascending order); supernodes tk_sn[t],
+       * tk_ptr[nw+1] <= t < ns, are remaining ones (near the root) */
+      int p_size;
+      /* size of panel, in elements */
+      int *map; /* int map[nt*(1+n)]; */
+      int *rel; /* int rel[nt*(1+n)]; */
+      int *end; /* int end[nt*(1+n)]; */
+      double *panel; /* double panel[nt*p_size]; */
+      int *count; /* int count[nt]; */
+      /* working arrays used by each thread; they are allocated only
+       * while the routine spchol_numeric is running */
+};
+
+/* maximal number of columns in supernode; larger supernodes are split
+ * to limit the panel size */
+#define NC_MAX 128
+
+/* minimal number of flops to use parallel threads */
+#define PAR_MIN 1e6
+
+static void sort_rows(int n, const int U_ptr[], const int U_ind[],
+      int ind[])
+{     /* copy pattern of U to ind with elements of each row sorted by
+       * ascending column indices, using transposition twice */
+      int nnz = U_ptr[n+1] - 1;
+      int *ptr, *pos, *row, i, j, t;
+      ptr = talloc(1+n+1, int);
+      pos = talloc(1+n, int);
+      row = talloc(1+nnz, int);
+      /* build pattern of U in column-wise format */
+      for (j = 1; j <= n; j++)
+         pos[j] = 0;
+      for (t = 1; t <= nnz; t++)
+         pos[U_ind[t]]++;
+      ptr[1] = 1;
+      for (j = 1; j <= n; j++)
+         ptr[j+1] = ptr[j] + pos[j], pos[j] = ptr[j];
+      for (i = 1; i <= n; i++)
+      {  for (t = U_ptr[i]; t < U_ptr[i+1]; t++)
+            row[pos[U_ind[t]]++] = i;
+      }
+      /* build it again in row-wise format (row pointers remain the
+       * same, and column indices are stored in ascending order) */
+      for (i = 1; i <= n; i++)
+         pos[i] = U_ptr[i];
+      for (j = 1; j <= n; j++)
+      {  for (t = ptr[j]; t < ptr[j+1]; t++)
+            ind[pos[row[t]]++] = j;
+      }
+      tfree(ptr);
+      tfree(pos);
+      tfree(row);
+      return;
+}
+
+static void order_rows(int n, const int U_ptr[], const int U_ind[],
+      const int ind[], int ord[])
+{     /* store to ord[t] the location in ind of element U_ind[t] */
+      int *loc, i, t;
+      loc = talloc(1+n, int);
+      for (i = 1; i <= n; i++)
+      {  for (t = U_ptr[i]; t < U_ptr[i+1]; t++)
+            loc[ind[t]] = t;
+         for (t = U_ptr[i]; t < U_ptr[i+1]; t++)
+            ord[t] = loc[U_ind[t]];
+      }
+      tfree(loc);
+      return;
+}
+
+static void sort_tasks(int nw, int list[], const double work[])
+{     /* sort subtrees list[1], ..., list[nw] by decreasing work
+       * (insertion sort, since the number of subtrees is small) */
+      int k, t, w;
+      for (k = 2; k <= nw; k++)
+      {  w = list[k];
+         for (t = k-1; t >= 1 && work[w] > work[list[t]]; t--)
+            list[t+1] = list[t];
+         list[t+1] = w;
+      }
+      return;
+}
+
+static void partition(SPCHOL *sc, const int parent[])
+{     /* partition supernodal elimination tree into subtrees to be
+       * factorized concurrently */
+      int ns = sc->ns;
+      int *sn_beg = sc->sn_beg;
+      const int *U_ptr = sc->U_ptr;
+      int J, c, nc, nr, w, nw, t, *tree, *list, *ptr;
+      double *work, *wsum, total, tol;
+      work = talloc(1+ns, double);
+      tree = talloc(1+ns, int);
+      /* estimate number of flops needed to factorize each subtree */
+      for (J = 1; J <= ns; J++)
+      {  nc = sn_beg[J+1] - sn_beg[J];
+         nr = U_ptr[sn_beg[J]+1] - U_ptr[sn_beg[J]] + 1;
+         work[J] = 0.0;
+         for (c = 0; c < nc; c++)
+            work[J] += (double)(nr - c) * (double)(nr - c);
+      }
+      total = 0.0;
+      for (J = 1; J <= ns; J++)
+      {  if (parent[J] == 0)
+            total += work[J];
+         else
+         {  xassert(parent[J] > J);
+            work[parent[J]] += work[J];
+         }
+      }
+      nw = 0;
+      if (total < PAR_MIN)
+         goto skip;
+      /* tree[J] > 0 means that J belongs to subtree tree[J], and
+       * tree[J] = 0 means that J is a supernode near the root */
+      tol = total / (double)(4 * sc->nt);
+      for (J = ns; J >= 1; J--)
+      {  if (parent[J] == 0 || tree[parent[J]] == 0)
+            tree[J] = (work[J] <= tol ? ++nw : 0);
+         else
+            tree[J] = tree[parent[J]];
+      }
+skip: if (nw < 2)
+      {  /* parallel processing is not worth doing */
+         sc->nw = 0;
+         goto done;
+      }
+      /* determine work needed to factorize each subtree */
+      wsum = talloc(1+nw, double);
+      for (w = 1; w <= nw; w++)
+         wsum[w] = 0.0;
+      for (J = ns; J >= 1; J--)
+      {  if (tree[J] != 0 && (parent[J] == 0 ||
+            tree[parent[J]] == 0))
+            wsum[tree[J]] = work[J];
+      }
+      /* order subtrees by decreasing work for better load balance */
+      list = talloc(1+nw, int);
+      for (w = 1; w <= nw; w++)
+         list[w] = w;
+      sort_tasks(nw, list, wsum);
+      /* tree[J] := new number of subtree J belongs to */
+      ptr = talloc(1+nw, int);
+      for (w = 1; w <= nw; w++)
+         ptr[list[w]] = w;
+      for (J = 1; J <= ns; J++)
+      {  if (tree[J] != 0)
+            tree[J] = ptr[tree[J]];
+      }
+      /* build lists of supernodes of subtrees */
+      sc->nw = nw;
+      sc->tk_ptr = talloc(1+nw+1, int);
+      sc->tk_sn = talloc(ns, int);
+      for (w = 1; w <= nw+1; w++)
+         sc->tk_ptr[w] = 0;
+      for (J = 1; J <= ns; J++)
+         sc->tk_ptr[tree[J] == 0 ? nw+1 : tree[J]]++;
+      for (w = 1, t = 0; w <= nw+1; w++)
+         t += sc->tk_ptr[w], sc->tk_ptr[w] = t;
+      for (J = ns; J >= 1; J--)
+         sc->tk_sn[--sc->tk_ptr[tree[J] == 0 ? nw+1 : tree[J]]] = J;
+      tfree(wsum);
+      tfree(list);
+      tfree(ptr);
+done: tfree(work);
+      tfree(tree);
+      return;
+}
+
+/***********************************************************************
+*  spchol_symbolic - analyze pattern of Cholesky factor
+*
+*  This routine analyzes the pattern of the upper triangular factor U
+*  (without diagonal elements) specified in the arrays U_ptr and ind in
+*  storage-by-rows format (previously computed with the routine
+*  chol_symbolic), determines supernodes and creates the workspace
+*  used by the routine spchol_numeric.
+*
+*  The array U_ptr is not copied and should not be changed while the
+*  workspace exists. The pattern of U is stored in the workspace in
+*  compressed supernodal form along with the original order of the
+*  elements, so the array ind is not changed and may be freed on exit.
+*
+*  The parameter nt specifies the number of threads to be used on
+*  computing numeric factorization, 1 <= nt <= 256. It is ignored if
+*  multi-threading is not supported. */
+
+SPCHOL *spchol_symbolic(int n, const int U_ptr[], const int ind[],
+      int nt)
+{     SPCHOL *sc;
+      int *U_ind;
+      int J, K, f, l, k, ns, nc, nr, p, size, *sn_beg, *col2sn,
+         *parent;
+      xassert(n > 0);
+      xassert(1 <= nt && nt <= 256);
+      sc = talloc(1, SPCHOL);
+      sc->n = n;
+      sc->U_ptr = U_ptr;
+      /* sorted pattern of U is only needed to analyze it */
+      U_ind = talloc(U_ptr[n+1], int);
+      sort_rows(n, U_ptr, ind, U_ind);
+      sc->U_ord = talloc(U_ptr[n+1], int);
+      order_rows(n, U_ptr, ind, U_ind, sc->U_ord);
+      sc->U_val = NULL;
+      /* determine supernodes */
+      sn_beg = sc->sn_beg = talloc(1+n+1, int);
+      col2sn = talloc(1+n, int);
+      ns = 0;
+      for (k = 1; k <= n; k++)
+      {  /* column k of L can be added to the current supernode if
+          * the pattern of column k-1 is k followed by the pattern of
+          * column k */
+         if (k > 1 && k - sn_beg[ns] < NC_MAX &&
+            U_ptr[k] - U_ptr[k-1] == U_ptr[k+1] - U_ptr[k] + 1 &&
+            U_ind[U_ptr[k-1]] == k)
+            /* nop */;
+         else
+            sn_beg[++ns] = k;
+         col2sn[k] = ns;
+      }
+      sn_beg[ns+1] = n+1;
+      sc->ns = ns;
+      /* store pattern of U in compressed form */
+      sc->R_ptr = talloc(1+ns+1, int);
+      sc->R_ptr[1] = 1;
+      for (J = 1; J <= ns; J++)
+      {  l = sn_beg[J+1] - 1;
+         sc->R_ptr[J+1] = sc->R_ptr[J] + (U_ptr[l+1] - U_ptr[l]);
+      }
+      sc->R_ind = talloc(sc->R_ptr[ns+1], int);
+      for (J = 1; J <= ns; J++)
+      {  l = sn_beg[J+1] - 1;
+         memcpy(&sc->R_ind[sc->R_ptr[J]], &U_ind[U_ptr[l]],
+            (U_ptr[l+1] - U_ptr[l]) * sizeof(int));
+      }
+      /* determine supernodal elimination tree and update lists */
+      parent = talloc(1+ns, int);
+      sc->up_ptr = talloc(1+ns+1, int);
+      for (J = 1; J <= ns+1; J++)
+         sc->up_ptr[J] = 0;
+      for (K = 1; K <= ns; K++)
+      {  l = sn_beg[K+1] - 1;
+         parent[K] = (U_ptr[l] < U_ptr[l+1] ?
+            col2sn[U_ind[U_ptr[l]]] : 0);
+         for (J = 0, p = U_ptr[l]; p < U_ptr[l+1]; p++)
+         {  if (J != col2sn[U_ind[p]])
+               J = col2sn[U_ind[p]], sc->up_ptr[J]++;
+         }
+      }
+      for (J = 1, p = 0; J <= ns+1; J++)
+         p += sc->up_ptr[J], sc->up_ptr[J] = p;
+      sc->up_sn = talloc(1+p, int);
+      sc->up_pos = talloc(1+p, int);
+      sc->p_size = 0;
+      for (K = ns; K >= 1; K--)
+      {  f = sn_beg[K];
+         l = sn_beg[K+1] - 1;
+         nc = l - f + 1;
+         nr = U_ptr[l+1] - U_ptr[l];
+         /* panel of K-th supernode has nc + nr rows and nc columns */
+         size = (nc + nr) * nc;
+         if (sc->p_size < size)
+            sc->p_size = size;
+         for (J = 0, p = U_ptr[l]; p < U_ptr[l+1]; p++)
+         {  if (J != col2sn[U_ind[p]])
+            {  J = col2sn[U_ind[p]];
+               k = --sc->up_ptr[J];
+               sc->up_sn[k] = K;
+               sc->up_pos[k] = p - U_ptr[l];
+            }
+         }
+      }
+      /* partition elimination tree to use parallel threads */
+      sc->nt = (thread_avail() ? nt : 1);
+      sc->nw = 0;
+      sc->tk_ptr = sc->tk_sn = NULL;
+      if (sc->nt > 1)
+         partition(sc, parent);
+      if (sc->nw == 0)
+         sc->nt = 1;
+      tfree(U_ind);
+      tfree(col2sn);
+      tfree(parent);
+      return sc;
+}
+
+/***********************************************************************
+*  factorize - factorize supernode
+*
+*  This routine computes columns of the factor L = U', which belong to
+*  J-th supernode, using working arrays of t-th thread, and returns the
+*  number of non-positive diagonal elements replaced by a huge positive
+*  number (see comments to the routine chol_numeric). */
+
+static int factorize(SPCHOL *sc, int J, int t, const int A_ptr[],
+      const int A_ind[], const double A_val[], const double A_diag[],
+      double U_diag[])
+{     const int *U_ptr = sc->U_ptr;
+      const int *R_ptr = sc->R_ptr;
+      const int *R_ind = sc->R_ind;
+      int *sn_beg = sc->sn_beg;
+      int *map = sc->map + t * (1+sc->n);
+      double *panel = sc->panel + t * sc->p_size;
+      int *rel = sc->rel + t * (1+sc->n);
+      int *end = sc->end + t * (1+sc->n);
+      double *U_val = sc->U_val;
+      int f, l, nc, nr, K, fK, lK, ncK, nrK, c, i, j, k, p, p1, p2, r1,
+         e, q, count = 0;
+      const int *R, *RK;
+      double d, s, *pc, *pd;
+      const double *v;
+      f = sn_beg[J];
+      l = sn_beg[J+1] - 1;
+      nc = l - f + 1;
+      /* rows of the panel are columns f, ..., l of L followed by rows
+       * of the off-diagonal pattern R */
+      R = &R_ind[R_ptr[J]];
+      nr = nc + (U_ptr[l+1] - U_ptr[l]);
+      for (c = 0; c < nc; c++)
+         map[f+c] = c;
+      for (i = nc; i < nr; i++)
+         map[R[i-nc]] = i;
+      /* panel := corresponding columns of A */
+      memset(panel, 0, nr * nc * sizeof(double));
+      for (c = 0, pc = panel; c < nc; c++, pc += nr)
+      {  k = f + c;
+         pc[c] = A_diag[k];
+         for (p = A_ptr[k]; p < A_ptr[k+1]; p++)
+            pc[map[A_ind[p]]] = A_val[p];
+      }
+      /* apply updates from descendant supernodes */
+      for (q = sc->up_ptr[J]; q < sc->up_ptr[J+1]; q++)
+      {  K = sc->up_sn[q];
+         p1 = sc->up_pos[q];
+         fK = sn_beg[K];
+         lK = sn_beg[K+1] - 1;
+         ncK = lK - fK + 1;
+         RK = &R_ind[R_ptr[K]];
+         nrK = U_ptr[lK+1] - U_ptr[lK];
+         /* rows RK[p1], ..., RK[p2-1] belong to columns of J */
+         for (p2 = p1 + 1; p2 < nrK && RK[p2] <= l; p2++)
+            /* nop */;
+         r1 = nrK - p1;
+         /* determine rows of the panel affected by the update and
+          * runs of consecutive rows; row rel[i] belongs to the run of
+          * rows rel[i], ..., rel[i] + (end[i] - i) - 1 */
+         for (i = 0; i < r1; i++)
+            rel[i] = map[RK[p1+i]];
+         for (i = r1-1; i >= 0; i--)
+            end[i] = (i+1 < r1 && rel[i+1] == rel[i]+1 ? end[i+1] :
+               i+1);
+         /* subtract products of columns of K-th supernode from the
+          * panel one column after another, i.e. in the same order as
+          * chol_numeric does */
+         for (c = 0; c < ncK; c++)
+         {  /* element of column fK+c of L in row RK[p] is stored in
+             * location ptr + p of U_val */
+            v = &U_val[U_ptr[fK+c] + (ncK-1-c)] + p1;
+            for (j = 0; j < p2 - p1; j++)
+            {  s = v[j];
+               for (i = j; i < r1; i = e)
+               {  e = end[i];
+                  pc = panel + rel[j] * nr + (rel[i] - i);
+                  for (k = i; k < e; k++)
+                     pc[k] -= v[k] * s;
+               }
+            }
+         }
+      }
+      /* factorize the panel with dense Cholesky algorithm */
+      for (c = 0, pc = panel; c < nc; c++, pc += nr)
+      {  d = pc[c];
+         if (d > 0.0)
+            d = sqrt(d);
+         else
+            d = DBL_MAX, count++;
+         pc[c] = d;
+         for (i = c+1; i < nr; i++)
+            pc[i] /= d;
+         for (j = c+1, pd = pc + nr; j < nc; j++, pd += nr)
+         {  s = pc[j];
+            for (i = j; i < nr; i++)
+               pd[i] -= pc[i] * s;
+         }
+      }
+      /* store columns of the panel to rows of U (note that elements
+       * of each row of U are sorted in the same order as rows of the
+       * panel) */
+      for (c = 0, pc = panel; c < nc; c++, pc += nr)
+      {  k = f + c;
+         xassert(U_ptr[k+1] - U_ptr[k] == nr - c - 1);
+         U_diag[k] = pc[c];
+         memcpy(&U_val[U_ptr[k]], &pc[c+1],
+            (nr - c - 1) * sizeof(double));
+      }
+      return count;
+}
+
+struct task
+{     /* data passed to threads */
+      SPCHOL *sc;
+      const int *A_ptr, *A_ind;
+      const double *A_val, *A_diag;
+      double *U_diag;
+      void *mutex;
+      /* mutex to claim subtrees */
+      int next;
+      /* next subtree to be factorized */
+};
+
+static void task_func(void *info, int t)
+{     /* factorize subtrees in t-th thread */
+      struct task *task = info;
+      SPCHOL *sc = task->sc;
+      int w, q;
+      for (;;)
+      {  mutex_lock(task->mutex);
+         w = task->next++;
+         mutex_unlock(task->mutex);
+         if (w > sc->nw)
+            break;
+         for (q = sc->tk_ptr[w]; q < sc->tk_ptr[w+1]; q++)
+            sc->count[t] += factorize(sc, sc->tk_sn[q], t,
+               task->A_ptr, task->A_ind, task->A_val, task->A_diag,
+               task->U_diag);
+      }
+      return;
+}
+
+/***********************************************************************
+*  spchol_numeric - compute Cholesky factorization (numeric phase)
+*
+*  This routine computes the Cholesky factorization A = U'*U, where
+*  A is a sparse symmetric positive definite matrix, whose pattern is
+*  the same as was used on computing the pattern of U.
+*
+*  The parameters A_ptr, A_ind, A_val, A_diag, and U_diag have the
+*  same meaning as for the routine chol_numeric. The pattern of U is
+*  the one specified on creating the workspace. Non-diagonal elements
+*  of U are stored in the workspace.
+*
+*  The routine returns the number of non-positive diagonal elements of
+*  U, which have been replaced by a huge positive number (see comments
+*  to the routine chol_numeric). */
+
+int spchol_numeric(SPCHOL *sc, const int A_ptr[], const int A_ind[],
+      const double A_val[], const double A_diag[], double U_diag[])
+{     int n = sc->n;
+      int J, q, t, count;
+      if (sc->U_val == NULL)
+         sc->U_val = talloc(sc->U_ptr[n+1], double);
+      /* allocate working arrays */
+      sc->map = talloc(sc->nt * (1+n), int);
+      sc->rel = talloc(sc->nt * (1+n), int);
+      sc->end = talloc(sc->nt * (1+n), int);
+      sc->panel = talloc(sc->nt * sc->p_size, double);
+      sc->count = talloc(sc->nt, int);
+      for (t = 0; t < sc->nt; t++)
+         sc->count[t] = 0;
+      if (sc->nw == 0)
+      {  /* factorize all supernodes in the calling thread */
+         for (J = 1; J <= sc->ns; J++)
+            sc->count[0] += factorize(sc, J, 0, A_ptr, A_ind, A_val,
+               A_diag, U_diag);
+      }
+      else
+      {  struct task task;
+         /* factorize subtrees in parallel threads */
+         task.sc = sc;
+         task.A_ptr = A_ptr, task.A_ind = A_ind;
+         task.A_val = A_val, task.A_diag = A_diag;
+         task.U_diag = U_diag;
+         task.mutex = mutex_create();
+         task.next = 1;
+         thread_run(sc->nt, task_func, &task);
+         mutex_delete(task.mutex);
+         /* factorize remaining supernodes in the calling thread */
+         for (q = sc->tk_ptr[sc->nw+1]; q < sc->ns; q++)
+            sc->count[0] += factorize(sc, sc->tk_sn[q], 0, A_ptr,
+               A_ind, A_val, A_diag, U_diag);
+      }
+      count = 0;
+      for (t = 0; t < sc->nt; t++)
+         count += sc->count[t];
+      /* free working arrays */
+      tfree(sc->map);
+      tfree(sc->rel);
+      tfree(sc->end);
+      tfree(sc->panel);
+      tfree(sc->count);
+      return count;
+}
+
+/***********************************************************************
+*  spchol_u_solve - solve upper triangular system U*x = b
+*
+*  This routine solves the system U*x = b, where U is the factor
+*  computed by the routine spchol_numeric, and U_diag contains its
+*  diagonal elements. On entry the array x contains the vector b, and
+*  on exit it contains the vector x.
+*
+*  Products of each row of U are subtracted in the original order of
+*  the pattern specified on creating the workspace, so the result is
+*  exactly the same as computed by the routine u_solve. */
+
+void spchol_u_solve(SPCHOL *sc, const double U_diag[], double x[])
+{     const int *U_ptr = sc->U_ptr;
+      const int *U_ord = sc->U_ord;
+      const double *U_val = sc->U_val;
+      int J, f, l, i, d, k, t;
+      const int *R;
+      double temp;
+      for (J = sc->ns; J >= 1; J--)
+      {  f = sc->sn_beg[J];
+         l = sc->sn_beg[J+1] - 1;
+         R = &sc->R_ind[sc->R_ptr[J]];
+         for (i = l; i >= f; i--)
+         {  /* k-th element of row i is in column i+1+k, if k < d, or
+             * in column R[k-d], otherwise */
+            temp = x[i];
+            d = l - i;
+            for (t = U_ptr[i]; t < U_ptr[i+1]; t++)
+            {  k = U_ord[t] - U_ptr[i];
+               temp -= U_val[U_ptr[i]+k] * x[k < d ? i+1+k : R[k-d]];
+            }
+            xassert(U_diag[i] != 0.0);
+            x[i] = temp / U_diag[i];
+         }
+      }
+      return;
+}
+
+/***********************************************************************
+*  spchol_ut_solve - solve lower triangular system U'*x = b
+*
+*  This routine solves the system U'*x = b, where U is the factor
+*  computed by the routine spchol_numeric, and U_diag contains its
+*  diagonal elements. On entry the array x contains the vector b, and
+*  on exit it contains the vector x.
+*
+*  Each component of x is updated at most once by each row of U, so
+*  the result does not depend on the order of elements within rows and
+*  is exactly the same as computed by the routine ut_solve. */
+
+void spchol_ut_solve(SPCHOL *sc, const double U_diag[], double x[])
+{     const int *U_ptr = sc->U_ptr;
+      const double *U_val = sc->U_val;
+      int J, f, l, i, j, k, t;
+      const int *R;
+      double temp;
+      for (J = 1; J <= sc->ns; J++)
+      {  f = sc->sn_beg[J];
+         l = sc->sn_beg[J+1] - 1;
+         R = &sc->R_ind[sc->R_ptr[J]];
+         for (i = f; i <= l; i++)
+         {  xassert(U_diag[i] != 0.0);
+            temp = (x[i] /= U_diag[i]);
+            if (temp == 0.0)
+               continue;
+            /* row i has non-zeros in columns i+1, ..., l, R[0], ... */
+            t = U_ptr[i];
+            for (j = i+1; j <= l; j++, t++)
+               x[j] -= U_val[t] * temp;
+            for (k = 0; t < U_ptr[i+1]; k++, t++)
+               x[R[k]] -= U_val[t] * temp;
+         }
+      }
+      return;
+}
+
+/***********************************************************************
+*  spchol_nsup - determine number of supernodes
+*
+*  This routine returns the number of supernodes found. */
+
+int spchol_nsup(SPCHOL *sc)
+{     return sc->ns;
+}
+
+/***********************************************************************
+*  spchol_delete - delete supernodal factorization workspace
+*
+*  This routine deletes the workspace created by spchol_symbolic. */
+
+void spchol_delete(SPCHOL *sc)
+{     tfree(sc->sn_beg);
+      tfree(sc->up_ptr);
+      tfree(sc->up_sn);
+      tfree(sc->up_pos);
+      if (sc->tk_ptr != NULL)
+         tfree(sc->tk_ptr);
+      if (sc->tk_sn != NULL)
+         tfree(sc->tk_sn);
+      tfree(sc->R_ptr);
+      tfree(sc->R_ind);
+      tfree(sc->U_ord);
+      if (sc->U_val != NULL)
+         tfree(sc->U_val);
+      tfree(sc);
+      return;
+}
+
+/* eof */
@@ -0,0 +1,56 @@
+/* spchol.h (supernodal sparse Cholesky factorization) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#ifndef SPCHOL_H
+#define SPCHOL_H
+
+typedef struct SPCHOL SPCHOL;
+
+#define spchol_symbolic _glp_spchol_symbolic
+SPCHOL *spchol_symbolic(int n, const int U_ptr[], const int U_ind[],
+      int nt);
+/* analyze pattern of Cholesky factor for supernodal factorization */
+
+#define spchol_numeric _glp_spchol_numeric
+int spchol_numeric(SPCHOL *sc, const int A_ptr[], const int A_ind[],
+      const double A_val[], const double A_diag[], double U_diag[]);
+/* compute Cholesky factorization (supernodal numeric phase) */
+
+#define spchol_u_solve _glp_spchol_u_solve
+void spchol_u_solve(SPCHOL *sc, const double U_diag[], double x[]);
+/* solve upper triangular system U*x = b */
+
+#define spchol_ut_solve _glp_spchol_ut_solve
+void spchol_ut_solve(SPCHOL *sc, const double U_diag[], double x[]);
+/* solve lower triangular system U'*x = b */
+
+#define spchol_nsup _glp_spchol_nsup
+int spchol_nsup(SPCHOL *sc);
+/* determine number of supernodes */
+
+#define spchol_delete _glp_spchol_delete
+void spchol_delete(SPCHOL *sc);
+/* delete supernodal factorization workspace */
+
+#endif
+
+/* eof */
@@ -0,0 +1,338 @@
+/* vscan.c (vectorized scans of dense vectors) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "env.h"
+#include "vscan.h"
+
+/***********************************************************************
+*  The routines in this module scan dense vectors to skip elements,
+*  which are small in magnitude. They are used in inner loops of the
+*  simplex method, where most elements of a vector (say, a row of the
+*  simplex table) are zeros and only few non-zeros need processing.
+*
+*  Besides portable code each routine has implementations that use
+*  AVX2 and AVX-512 instructions, which are chosen at run time depending
+*  on the capabilities of the CPU, if the package is configured with
+*  SIMD support (macro HAVE_SIMD). All implementations give exactly the
+*  same results. */
+
+#if defined(HAVE_SIMD)
+#include <immintrin.h>
+
+/* instruction set to be used: 2 - AVX-512, 1 - AVX2, 0 - none; -1
+ * means that the CPU has not been checked yet; the routines may be
+ * called concurrently from worker threads (see thread_run), so the
+ * variable is accessed atomically; if several threads check the CPU
+ * at the same time, they all store the same value */
+static int level = -1;
+
+static int get_level(void)
+{     int lev = __atomic_load_n(&level, __ATOMIC_RELAXED);
+      if (lev < 0)
+      {  lev = 0;
+         __builtin_cpu_init();
+         if (__builtin_cpu_supports("avx512f"))
+            lev = 2;
+         else if (__builtin_cpu_supports("avx2"))
+            lev = 1;
+         __atomic_store_n(&level, lev, __ATOMIC_RELAXED);
+      }
+      return lev;
+}
+
+#define AVX2   __attribute__((target("avx2")))
+#define AVX512 __attribute__((target("avx512f")))
+
+AVX2 static int next_avx2(int n, const double x[], double eps, int j)
+{     __m256d lo = _mm256_set1_pd(-eps), hi = _mm256_set1_pd(+eps);
+      __m256d v;
+      int mask;
+      for (; j + 3 <= n; j += 4)
+      {  v = _mm256_loadu_pd(&x[j]);
+         mask = _mm256_movemask_pd(_mm256_and_pd(
+            _mm256_cmp_pd(v, lo, _CMP_GT_OQ),
+            _mm256_cmp_pd(v, hi, _CMP_LT_OQ))) ^ 0xF;
+         if (mask)
+            return j + __builtin_ctz(mask);
+      }
+      return j;
+}
+
+AVX512 static int next_avx512(int n, const double x[], double eps,
+      int j)
+{     __m512d lo = _mm512_set1_pd(-eps), hi = _mm512_set1_pd(+eps);
+      __m512d v;
+      int mask;
+      for (; j + 7 <= n; j += 8)
+      {  v = _mm512_loadu_pd(&x[j]);
+         mask = (_mm512_cmp_pd_mask(v, lo, _CMP_GT_OQ) &
+            _mm512_cmp_pd_mask(v, hi, _CMP_LT_OQ)) ^ 0xFF;
+         if (mask)
+            return j + __builtin_ctz(mask);
+      }
+      return j;
+}
+
+AVX2 static int prev_avx2(double x[], double eps, int j)
+{     __m256d lo = _mm256_set1_pd(-eps), hi = _mm256_set1_pd(+eps);
+      __m256d v;
+      for (; j >= 4; j -= 4)
+      {  v = _mm256_loadu_pd(&x[j-3]);
+         if (_mm256_movemask_pd(_mm256_and_pd(
+            _mm256_cmp_pd(v, lo, _CMP_GT_OQ),
+            _mm256_cmp_pd(v, hi, _CMP_LT_OQ))) != 0xF)
+            break;
+         _mm256_storeu_pd(&x[j-3], _mm256_setzero_pd());
+      }
+      return j;
+}
+
+AVX512 static int prev_avx512(double x[], double eps, int j)
+{     __m512d lo = _mm512_set1_pd(-eps), hi = _mm512_set1_pd(+eps);
+      __m512d v;
+      for (; j >= 8; j -= 8)
+      {  v = _mm512_loadu_pd(&x[j-7]);
+         if ((_mm512_cmp_pd_mask(v, lo, _CMP_GT_OQ) &
+            _mm512_cmp_pd_mask(v, hi, _CMP_LT_OQ)) != 0xFF)
+            break;
+         _mm512_storeu_pd(&x[j-7], _mm512_setzero_pd());
+      }
+      return j;
+}
+
+/* NaN's are skipped, since vmaxpd returns its second operand if the
+ * first one is NaN */
+
+AVX2 static double amax_avx2(int n, const double x[], int *j)
+{     __m256d sign = _mm256_set1_pd(-0.0);
+      __m256d big = _mm256_setzero_pd();
+      double t[4], temp;
+      int k;
+      for (k = 1; k + 3 <= n; k += 4)
+         big = _mm256_max_pd(_mm256_andnot_pd(sign,
+            _mm256_loadu_pd(&x[k])), big);
+      _mm256_storeu_pd(t, big);
+      temp = t[0];
+      if (temp < t[1]) temp = t[1];
+      if (temp < t[2]) temp = t[2];
+      if (temp < t[3]) temp = t[3];
+      *j = k;
+      return temp;
+}
+
+AVX512 static double amax_avx512(int n, const double x[], int *j)
+{     __m512d big = _mm512_setzero_pd();
+      int k;
+      for (k = 1; k + 7 <= n; k += 8)
+         big = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(&x[k])),
+            big);
+      *j = k;
+      return _mm512_reduce_max_pd(big);
+}
+
+#if 1 /* 17/X-2026 */
+/* products and differences are computed by separate instructions and
+ * must not be contracted to fused multiply-add, since otherwise the
+ * results would depend on the CPU */
+
+#define NOFMA __attribute__((optimize("fp-contract=off")))
+
+AVX2 NOFMA static int update_avx2(int n, int nb, const double l[],
+      const double u[], int ldu, double y[])
+{     __m256d acc0, acc1;
+      int j, s;
+      for (j = 1; j + 7 <= n; j += 8)
+      {  acc0 = _mm256_loadu_pd(&y[j]);
+         acc1 = _mm256_loadu_pd(&y[j+4]);
+         for (s = 1; s <= nb; s++)
+         {  const double *us = &u[(s-1) * ldu + j];
+            __m256d ls;
+            if (l[s] == 0.0)
+               continue;
+            ls = _mm256_set1_pd(l[s]);
+            acc0 = _mm256_sub_pd(acc0,
+               _mm256_mul_pd(ls, _mm256_loadu_pd(&us[0])));
+            acc1 = _mm256_sub_pd(acc1,
+               _mm256_mul_pd(ls, _mm256_loadu_pd(&us[4])));
+         }
+         _mm256_storeu_pd(&y[j], acc0);
+         _mm256_storeu_pd(&y[j+4], acc1);
+      }
+      return j;
+}
+
+AVX512 NOFMA static int update_avx512(int n, int nb, const double l[],
+      const double u[], int ldu, double y[])
+{     __m512d acc0, acc1;
+      int j, s;
+      for (j = 1; j + 15 <= n; j += 16)
+      {  acc0 = _mm512_loadu_pd(&y[j]);
+         acc1 = _mm512_loadu_pd(&y[j+8]);
+         for (s = 1; s <= nb; s++)
+         {  const double *us = &u[(s-1) * ldu + j];
+            __m512d ls;
+            if (l[s] == 0.0)
+               continue;
+            ls = _mm512_set1_pd(l[s]);
+            acc0 = _mm512_sub_pd(acc0,
+               _mm512_mul_pd(ls, _mm512_loadu_pd(&us[0])));
+            acc1 = _mm512_sub_pd(acc1,
+               _mm512_mul_pd(ls, _mm512_loadu_pd(&us[8])));
+         }
+         _mm512_storeu_pd(&y[j], acc0);
+         _mm512_storeu_pd(&y[j+8], acc1);
+      }
+      return j;
+}
+#endif
+#endif
+
+/***********************************************************************
+*  vscan_next - find next element not in (-eps, +eps)
+*
+*  This routine scans elements x[j], x[j+1], ..., x[n] and returns the
+*  index of the first element such that x[k] <= -eps or x[k] >= +eps
+*  (or x[k] is NaN). If there is no such element, n+1 is returned. */
+
+int vscan_next(int n, const double x[], double eps, int j)
+{
+#if defined(HAVE_SIMD)
+      switch (get_level())
+      {  case 2:
+            j = next_avx512(n, x, eps, j);
+            break;
+         case 1:
+            j = next_avx2(n, x, eps, j);
+            break;
+      }
+#endif
+      for (; j <= n; j++)
+      {  if (!(-eps < x[j] && x[j] < +eps))
+            break;
+      }
+      return j;
+}
+
+/***********************************************************************
+*  vscan_prev - find previous element not in (-eps, +eps)
+*
+*  This routine scans elements x[j], x[j-1], ..., x[1] and returns the
+*  index of the first element such that x[k] <= -eps or x[k] >= +eps
+*  (or x[k] is NaN). If there is no such element, 0 is returned. The
+*  elements skipped are replaced by exact zeros. */
+
+int vscan_prev(double x[], double eps, int j)
+{
+#if defined(HAVE_SIMD)
+      switch (get_level())
+      {  case 2:
+            j = prev_avx512(x, eps, j);
+            break;
+         case 1:
+            j = prev_avx2(x, eps, j);
+            break;
+      }
+#endif
+      for (; j >= 1; j--)
+      {  if (!(-eps < x[j] && x[j] < +eps))
+            break;
+         x[j] = 0.0;
+      }
+      return j;
+}
+
+/***********************************************************************
+*  vscan_amax - find maximal magnitude of vector elements
+*
+*  This routine returns max(0, |x[1]|, ..., |x[n]|). Elements, which
+*  are NaN, are ignored. */
+
+double vscan_amax(int n, const double x[])
+{     int j = 1;
+      double big = 0.0, temp;
+#if defined(HAVE_SIMD)
+      switch (get_level())
+      {  case 2:
+            big = amax_avx512(n, x, &j);
+            break;
+         case 1:
+            big = amax_avx2(n, x, &j);
+            break;
+      }
+#endif
+      for (; j <= n; j++)
+      {  temp = x[j];
+         if (temp < 0.0)
+            temp = - temp;
+         if (big < temp)
+            big = temp;
+      }
+      return big;
+}
+
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  vscan_update - subtract linear combination of vectors from vector
+*
+*  This routine computes
+*
+*     y[j] := y[j] - l[1] * u1[j] - l[2] * u2[j] - ... - l[nb] * unb[j]
+*
+*  for j = 1, ..., n, where us[j] = u[(s-1) * ldu + j] is j-th element
+*  of s-th vector, 1 <= s <= nb. Vectors with l[s] = 0 are skipped.
+*
+*  Each element of y is updated in registers by all the vectors, so
+*  y is loaded and stored only once. The terms are subtracted in the
+*  same order by all implementations. */
+
+#if defined(HAVE_SIMD)
+NOFMA
+#endif
+void vscan_update(int n, int nb, const double l[], const double u[],
+      int ldu, double y[])
+{     int j = 1, s;
+      double t;
+#if defined(HAVE_SIMD)
+      switch (get_level())
+      {  case 2:
+            j = update_avx512(n, nb, l, u, ldu, y);
+            break;
+         case 1:
+            j = update_avx2(n, nb, l, u, ldu, y);
+            break;
+      }
+#endif
+      if (j > n)
+         goto done;
+      for (s = 1; s <= nb; s++)
+      {  const double *us = &u[(s-1) * ldu];
+         int k;
+         if ((t = l[s]) == 0.0)
+            continue;
+         for (k = j; k <= n; k++)
+            y[k] -= t * us[k];
+      }
+done: return;
+}
+#endif
+
+/* eof */
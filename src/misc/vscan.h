@@ -0,0 +1,47 @@
+/* vscan.h (vectorized scans of dense vectors) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#ifndef VSCAN_H
+#define VSCAN_H
+
+#define vscan_next _glp_vscan_next
+int vscan_next(int n, const double x[], double eps, int j);
+/* find next element not in (-eps, +eps) */
+
+#define vscan_prev _glp_vscan_prev
+int vscan_prev(double x[], double eps, int j);
+/* find previous element not in (-eps, +eps) */
+
+#define vscan_amax _glp_vscan_amax
+double vscan_amax(int n, const double x[]);
+/* find maximal magnitude of vector elements */
+
+#if 1 /* 17/X-2026 */
+#define vscan_update _glp_vscan_update
+void vscan_update(int n, int nb, const double l[], const double u[],
+      int ldu, double y[]);
+/* subtract linear combination of vectors from vector */
+#endif
+
+#endif
+
+/* eof */
@@ -34,6 +34,13 @@ int spx_primal(glp_prob *P, const glp_smcp *parm);
 int spy_dual(glp_prob *P, const glp_smcp *parm);
 /* driver to the dual simplex method */
 
+#if 1 /* 17/X-2026 */
+#define spx_crossover _glp_spx_crossover
+int spx_crossover(glp_prob *P, const glp_smcp *parm, int *np,
+      int *nd);
+/* find basis from interior-point solution */
+#endif
+
 #endif
 
 /* eof */
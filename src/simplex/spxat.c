@@ -34,10 +34,17 @@ void spx_alloc_at(SPXLP *lp, SPXAT *at)
 {     int m = lp->m;
       int n = lp->n;
       int nnz = lp->nnz;
+#if 0 /* 17/X-2026 */
       at->ptr = talloc(1+m+1, int);
       at->ind = talloc(1+nnz, int);
       at->val = talloc(1+nnz, double);
       at->work = talloc(1+n, double);
+#else
+      at->ptr = spx_talloc(lp, 1+m+1, int);
+      at->ind = spx_talloc(lp, 1+nnz, int);
+      at->val = spx_talloc(lp, 1+nnz, double);
+      at->work = spx_talloc(lp, 1+n, double);
+#endif
       return;
 }
 
@@ -255,10 +262,17 @@ void spx_eval_trow1(SPXLP *lp, SPXAT *at, const double rho[/*1+m*/],
 
 void spx_free_at(SPXLP *lp, SPXAT *at)
 {     xassert(lp == lp);
+#if 0 /* 17/X-2026 */
       tfree(at->ptr);
       tfree(at->ind);
       tfree(at->val);
       tfree(at->work);
+#else
+      spx_tfree(lp, at->ptr);
+      spx_tfree(lp, at->ind);
+      spx_tfree(lp, at->val);
+      spx_tfree(lp, at->work);
+#endif
       return;
 }
 
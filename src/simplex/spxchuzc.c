@@ -143,6 +143,129 @@ int spx_chuzc_std(SPXLP *lp, const double d[/*1+n-m*/], int num,
       return q;
 }
 
+#if 1 /* 17/X-2026 */
+static int eligible(SPXLP *lp, const double d[/*1+n-m*/], double tol,
+      double tol1, int j)
+{     /* check if non-basic variable xN[j] is eligible (see
+       * spx_chuzc_sel) */
+      int m = lp->m;
+      double *c = lp->c;
+      double *l = lp->l;
+      double *u = lp->u;
+      int *head = lp->head;
+      char *flag = lp->flag;
+      int k;
+      double ck, eps;
+      k = head[m+j]; /* x[k] = xN[j] */
+      if (l[k] == u[k])
+      {  /* xN[j] is fixed variable */
+         return 0;
+      }
+      /* determine absolute tolerance eps[j] */
+      ck = c[k];
+      eps = tol + tol1 * (ck >= 0.0 ? +ck : -ck);
+      if (d[j] <= -eps)
+      {  if (flag[j])
+            return 0;
+      }
+      else if (d[j] >= +eps)
+      {  if (!flag[j] && l[k] != -DBL_MAX)
+            return 0;
+      }
+      else
+         return 0;
+      return 1;
+}
+
+/***********************************************************************
+*  spx_chuzc_part - select eligible non-basic variables (partial
+*  pricing)
+*
+*  This routine is similar to spx_chuzc_sel, however, it does not need
+*  all reduced costs to be known. Instead, it computes reduced costs
+*  d[j] of non-basic variables xN[j] for a segment of size consecutive
+*  indices j, starting from j = *start, using the vector of simplex
+*  multipliers pi computed for the current basis, and selects eligible
+*  variables in that segment. If no eligible variables are found, the
+*  routine goes to the next segment, and so on. Indices j are walked
+*  thru cyclically, so the routine stops either once some eligible
+*  variables have been found, or once all n-m non-basic variables have
+*  been scanned.
+*
+*  On exit the routine stores in *start the index of the non-basic
+*  variable, from which the next scan should start, stores indices j of
+*  eligible non-basic variables xN[j] to the array locations list[1],
+*  ..., list[num] and returns num. Note that num = 0 means that all
+*  reduced costs d[1], ..., d[n-m] have been just computed and none of
+*  non-basic variables is eligible. Otherwise, only reduced costs d[j]
+*  of non-basic variables scanned are valid. */
+
+int spx_chuzc_part(SPXLP *lp, const double pi[/*1+m*/],
+      double d[/*1+n-m*/], double tol, double tol1, int *start,
+      int size, int list[/*1+n-m*/])
+{     int m = lp->m;
+      int n = lp->n;
+      int j, cnt, num;
+      xassert(n-m > 0);
+      xassert(size > 0);
+      j = *start;
+      if (!(1 <= j && j <= n-m))
+         j = 1;
+      num = 0;
+      /* walk thru list of non-basic variables */
+      for (cnt = 1; cnt <= n-m; cnt++, j = (j < n-m ? j+1 : 1))
+      {  /* stop at the end of segment, if some eligible variables have
+          * been found */
+         if (num > 0 && (cnt - 1) % size == 0)
+            break;
+         /* compute reduced cost d[j] */
+         d[j] = spx_eval_dj(lp, pi, j);
+         /* check if xN[j] is eligible */
+         if (eligible(lp, d, tol, tol1, j))
+         {  num++;
+            list[num] = j;
+         }
+      }
+      *start = j;
+      return num;
+}
+
+/***********************************************************************
+*  spx_chuzc_mult - reprice candidate non-basic variables (multiple
+*  pricing)
+*
+*  Given the list of candidate non-basic variables xN[j], whose indices
+*  j are stored in list[1], ..., list[num], this routine recomputes
+*  their reduced costs d[j] using the vector of simplex multipliers pi
+*  computed for the current basis, and removes from the list variables
+*  which are not eligible anymore. On exit the routine returns the new
+*  length of the list. Reduced costs of other non-basic variables are
+*  not changed.
+*
+*  The routine is used along with spx_chuzc_part, which provides the
+*  list of candidates, to perform several (minor) iterations without
+*  scanning a segment of non-basic variables. */
+
+int spx_chuzc_mult(SPXLP *lp, const double pi[/*1+m*/],
+      double d[/*1+n-m*/], double tol, double tol1, int num,
+      int list[/*1+num*/])
+{     int n = lp->n;
+      int m = lp->m;
+      int j, t, cnt;
+      cnt = 0;
+      for (t = 1; t <= num; t++)
+      {  j = list[t];
+         xassert(1 <= j && j <= n-m);
+         /* compute reduced cost d[j] */
+         d[j] = spx_eval_dj(lp, pi, j);
+         /* keep xN[j] in the list, if it is still eligible */
+         if (eligible(lp, d, tol, tol1, j))
+            list[++cnt] = j;
+      }
+      return cnt;
+}
+#endif
+
 /***********************************************************************
 *  spx_alloc_se - allocate pricing data block
 *
@@ -153,9 +276,15 @@ void spx_alloc_se(SPXLP *lp, SPXSE *se)
 {     int m = lp->m;
       int n = lp->n;
       se->valid = 0;
+#if 0 /* 17/X-2026 */
       se->refsp = talloc(1+n, char);
       se->gamma = talloc(1+n-m, double);
       se->work = talloc(1+m, double);
+#else
+      se->refsp = spx_talloc(lp, 1+n, char);
+      se->gamma = spx_talloc(lp, 1+n-m, double);
+      se->work = spx_talloc(lp, 1+m, double);
+#endif
       return;
 }
 
@@ -203,7 +332,9 @@ void spx_reset_refsp(SPXLP *lp, SPXSE *se)
 *     delta[j] = {
 *                ( 0, otherwise
 *
-*  NOTE: For testing/debugging only. */
+*  NOTE: This routine is expensive, since it computes column of the
+*        simplex table. It is used for testing/debugging and to
+*        compute weights of new variables in incremental mode. */
 
 double spx_eval_gamma_j(SPXLP *lp, SPXSE *se, int j)
 {     int m = lp->m;
@@ -226,6 +357,94 @@ double spx_eval_gamma_j(SPXLP *lp, SPXSE *se, int j)
       return gamma_j;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  spx_save_se - save pricing data for incremental mode
+*
+*  This routine saves the reference space and projected steepest edge
+*  weights of the current basis to the workspace of the working LP, so
+*  they can be reused by the next call to the primal simplex solver
+*  with the routine spx_restore_se. If the weights are not valid, the
+*  routine drops the data previously saved.
+*
+*  The parameter refct is the number of weight updates left before the
+*  reference space is to be reset. The parameters m0 and n0 are the
+*  number of rows and columns in the original LP, and the array map is
+*  the one built by the routine spx_build_lp. */
+
+void spx_save_se(SPXLP *lp, SPXSE *se, int refct, int m0, int n0,
+      const int map[])
+{     int m = lp->m;
+      int n = lp->n;
+      int *head = lp->head;
+      int j;
+      double *wk;
+      if (!se->valid)
+      {  spx_ws_save_se(lp, 0, m0, n0, map, NULL, NULL, 0);
+         goto done;
+      }
+      wk = spx_talloc(lp, 1+n, double);
+      for (j = 1; j <= n-m; j++)
+         wk[head[m+j]] = se->gamma[j];
+      spx_ws_save_se(lp, 1, m0, n0, map, se->refsp, wk, refct);
+      spx_tfree(lp, wk);
+done: return;
+}
+
+/***********************************************************************
+*  spx_restore_se - restore pricing data for incremental mode
+*
+*  This routine restores the reference space and projected steepest
+*  edge weights saved by the routine spx_save_se on the previous call
+*  to the primal simplex solver. Weights of new non-basic variables are
+*  computed directly, so the basis factorization should be valid. The
+*  parameters m0, n0, and map are the same as for spx_save_se.
+*
+*  RETURNS
+*
+*  If the pricing data have been restored, the routine returns the
+*  number of weight updates left before the reference space is to be
+*  reset. Otherwise, the routine returns zero, in which case the data
+*  block remains invalid. */
+
+int spx_restore_se(SPXLP *lp, SPXSE *se, int m0, int n0,
+      const int map[])
+{     int m = lp->m;
+      int n = lp->n;
+      int *head = lp->head;
+      int j, cnt, refct;
+      double *wk;
+      xassert(lp->valid);
+      se->valid = 0;
+      wk = spx_talloc(lp, 1+n, double);
+      refct = spx_ws_load_se(lp, 1, m0, n0, map, se->refsp, wk);
+      if (refct == 0)
+         goto skip;
+      /* computing weights directly is expensive, so if there are too
+       * many new variables, resetting the reference space is better */
+      cnt = 0;
+      for (j = 1; j <= n-m; j++)
+      {  if (wk[head[m+j]] < 0.0)
+            cnt++;
+      }
+      if (cnt > 10 + (n-m) / 10)
+      {  refct = 0;
+         goto skip;
+      }
+      se->valid = 1;
+      for (j = 1; j <= n-m; j++)
+      {  if (wk[head[m+j]] >= 0.0)
+            se->gamma[j] = wk[head[m+j]];
+      }
+      for (j = 1; j <= n-m; j++)
+      {  if (wk[head[m+j]] < 0.0)
+            se->gamma[j] = spx_eval_gamma_j(lp, se, j);
+      }
+skip: spx_tfree(lp, wk);
+      return refct;
+}
+#endif
+
 /***********************************************************************
 *  spx_chuzc_pse - choose non-basic variable (projected steepest edge)
 *
@@ -372,9 +591,15 @@ double spx_update_gamma(SPXLP *lp, SPXSE *se, int p, int q,
 
 void spx_free_se(SPXLP *lp, SPXSE *se)
 {     xassert(lp == lp);
+#if 0 /* 17/X-2026 */
       tfree(se->refsp);
       tfree(se->gamma);
       tfree(se->work);
+#else
+      spx_tfree(lp, se->refsp);
+      spx_tfree(lp, se->gamma);
+      spx_tfree(lp, se->work);
+#endif
       return;
 }
 
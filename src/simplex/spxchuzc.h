@@ -36,6 +36,20 @@ int spx_chuzc_std(SPXLP *lp, const double d[/*1+n-m*/], int num,
       const int list[]);
 /* choose non-basic variable (Dantzig's rule) */
 
+#if 1 /* 17/X-2026 */
+#define spx_chuzc_part _glp_spx_chuzc_part
+int spx_chuzc_part(SPXLP *lp, const double pi[/*1+m*/],
+      double d[/*1+n-m*/], double tol, double tol1, int *start,
+      int size, int list[/*1+n-m*/]);
+/* select eligible non-basic variables (partial pricing) */
+
+#define spx_chuzc_mult _glp_spx_chuzc_mult
+int spx_chuzc_mult(SPXLP *lp, const double pi[/*1+m*/],
+      double d[/*1+n-m*/], double tol, double tol1, int num,
+      int list[/*1+num*/]);
+/* reprice candidate non-basic variables (multiple pricing) */
+#endif
+
 typedef struct SPXSE SPXSE;
 
 struct SPXSE
@@ -66,6 +80,18 @@ void spx_reset_refsp(SPXLP *lp, SPXSE *se);
 double spx_eval_gamma_j(SPXLP *lp, SPXSE *se, int j);
 /* compute projeted steepest edge weight directly */
 
+#if 1 /* 17/X-2026 */
+#define spx_save_se _glp_spx_save_se
+void spx_save_se(SPXLP *lp, SPXSE *se, int refct, int m0, int n0,
+      const int map[]);
+/* save pricing data for incremental mode */
+
+#define spx_restore_se _glp_spx_restore_se
+int spx_restore_se(SPXLP *lp, SPXSE *se, int m0, int n0,
+      const int map[]);
+/* restore pricing data for incremental mode */
+#endif
+
 #define spx_chuzc_pse _glp_spx_chuzc_pse
 int spx_chuzc_pse(SPXLP *lp, SPXSE *se, const double d[/*1+n-m*/],
       int num, const int list[]);
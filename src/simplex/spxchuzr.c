@@ -23,6 +23,9 @@
 
 #include "env.h"
 #include "spxchuzr.h"
+#if 1 /* 17/X-2026 */
+#include "vscan.h"
+#endif
 
 /***********************************************************************
 *  spx_chuzr_std - choose basic variable (textbook ratio test)
@@ -120,7 +123,11 @@ int spx_chuzr_std(SPXLP *lp, int phase, const double beta[/*1+m*/],
          p = -1, *p_flag = 0, teta_min = fabs(l[k] - u[k]), biga = 1.0;
       }
       /* walk thru the list of basic variables */
+#if 0 /* 17/X-2026 */
       for (i = 1; i <= m; i++)
+#else
+      for (i = 1; (i = vscan_next(m, tcol, tol_piv, i)) <= m; i++)
+#endif
       {  k = head[i]; /* x[k] = xB[i] */
          /* determine alfa such that delta xB[i] = alfa * teta */
          alfa = s * tcol[i];
@@ -231,7 +238,11 @@ int spx_chuzr_harris(SPXLP *lp, int phase, const double beta[/*1+m*/],
       /*--------------------------------------------------------------*/
       teta_min = DBL_MAX;
       /* walk thru the list of basic variables */
+#if 0 /* 17/X-2026 */
       for (i = 1; i <= m; i++)
+#else
+      for (i = 1; (i = vscan_next(m, tcol, tol_piv, i)) <= m; i++)
+#endif
       {  k = head[i]; /* x[k] = xB[i] */
          /* determine alfa such that delta xB[i] = alfa * teta */
          alfa = s * tcol[i];
@@ -315,7 +326,11 @@ int spx_chuzr_harris(SPXLP *lp, int phase, const double beta[/*1+m*/],
       /* nothing is chosen so far */
       p = 0, *p_flag = 0, biga = 0.0;
       /* walk thru the list of basic variables */
+#if 0 /* 17/X-2026 */
       for (i = 1; i <= m; i++)
+#else
+      for (i = 1; (i = vscan_next(m, tcol, tol_piv, i)) <= m; i++)
+#endif
       {  k = head[i]; /* x[k] = xB[i] */
          /* determine alfa such that delta xB[i] = alfa * teta */
          alfa = s * tcol[i];
@@ -426,7 +441,11 @@ int spx_ls_eval_bp(SPXLP *lp, const double beta[/*1+m*/],
       }
       /* build the list of all basic variables xB[i] that can cross
        * their bound(s) for the ray parameter 0 <= teta < teta_max */
+#if 0 /* 17/X-2026 */
       for (i = 1; i <= m; i++)
+#else
+      for (i = 1; (i = vscan_next(m, tcol, tol_piv, i)) <= m; i++)
+#endif
       {  k = head[i]; /* x[k] = xB[i] */
          xassert(l[k] <= u[k]);
          /* determine alfa such that (delta xB[i]) = alfa * teta */
@@ -0,0 +1,533 @@
+/* spxcross.c (crossover from interior point to basic solution) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2026 agent. All rights reserved.
+*  E-mail: <agent@local>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "env.h"
+#include "simplex.h"
+#include "spxat.h"
+#include "spxprob.h"
+#include "spychuzc.h"
+#include "vscan.h"
+
+/***********************************************************************
+*  The crossover procedure implemented in this module converts the
+*  interior-point solution, which is usually not basic, to an advanced
+*  basis, which is expected to be optimal or nearly optimal, so the
+*  simplex method is able to finish with a few iterations.
+*
+*  The procedure starts from the standard basis, where all auxiliary
+*  variables are basic, and consists of two phases.
+*
+*  On the primal push phase every non-basic variable, which is strictly
+*  between its bounds in the interior-point solution (superbasic
+*  variable), is moved toward one of its bounds in the direction which
+*  does not increase the objective, while basic variables change to
+*  satisfy the equality constraints. If some basic variable reaches its
+*  bound first, it leaves the basis and the superbasic variable enters
+*  it. Otherwise, the superbasic variable becomes non-basic on its
+*  bound. Thus, on completion of this phase the basic solution is
+*  primal feasible (within the interior-point tolerance).
+*
+*  On the dual push phase every basic variable, which is on its bound
+*  and whose reduced cost in the interior-point solution is non-zero,
+*  is removed from the basis, if possible, by a degenerate pivot. The
+*  entering variable is chosen with the dual ratio test applied to the
+*  interior-point reduced costs, so they remain dual feasible while the
+*  reduced cost of the leaving variable is moved toward zero, and the
+*  basic solution remains the same.
+*
+*  This is a simplified version of the crossover procedure described
+*  in the paper: R. E. Bixby, M. J. Saltzman, "Recovering an optimal LP
+*  basis from an interior point solution", Operations Research Letters
+*  15 (1994), pp. 169-178. */
+
+struct csa
+{     /* common storage area */
+      SPXLP *lp;
+      /* working LP, which includes all original variables, so x[k]
+       * corresponds to k-th original variable, 1 <= k <= m+n */
+      int *map; /* int map[1+n]; */
+      /* map provided by spx_build_lp */
+      int *pos; /* int pos[1+n]; */
+      /* pos[k] = kk means that head[kk] = k */
+      double *x; /* double x[1+n]; */
+      /* current values of all variables */
+      double *z; /* double z[1+n]; */
+      /* reduced costs of all variables in the interior-point
+       * solution */
+      double tol_bnd, tol_bnd1;
+      /* primal feasibility tolerances */
+      double tol_dj, tol_dj1;
+      /* dual feasibility tolerances */
+      double tol_piv;
+      /* tolerance on pivot elements */
+      FVS tcol; /* FVS tcol[1:m]; */
+      /* column of simplex table */
+      SPXAT at;
+      /* constraint matrix in sparse row-wise format */
+      double *rho; /* double rho[1+m]; */
+      /* row of basis matrix inverse */
+      double *trow; /* double trow[1+n-m]; */
+      /* row of simplex table */
+      double *d; /* double d[1+n-m]; */
+      /* reduced costs of non-basic variables on the dual push phase */
+      int *list; /* int list[1+n]; */
+      /* list of variables to be pushed */
+      double *key; /* double key[1+n]; */
+      /* key[k] is a sort key of x[k] used on ordering the list */
+      int np, nd;
+      /* numbers of primal and dual pushes performed */
+};
+
+static double *sort_key;
+/* pointer to array of sort keys used by fcmp */
+
+static int CDECL fcmp(const void *p1, const void *p2)
+{     /* compare variables in descending order of sort keys */
+      int k1 = *(const int *)p1, k2 = *(const int *)p2;
+      if (sort_key[k1] > sort_key[k2])
+         return -1;
+      if (sort_key[k1] < sort_key[k2])
+         return +1;
+      return k1 - k2;
+}
+
+/***********************************************************************
+*  change_basis - change basis and update its factorization
+*
+*  This routine makes xB[p] non-basic (with active upper bound, if
+*  p_flag is set) and xN[q] basic, and updates the factorization of the
+*  basis matrix. It returns non-zero if the factorization has failed. */
+
+static int change_basis(struct csa *csa, int p, int p_flag, int q)
+{     SPXLP *lp = csa->lp;
+      int m = lp->m;
+      int *head = lp->head;
+      spx_change_basis(lp, p, p_flag, q);
+      csa->pos[head[p]] = p;
+      csa->pos[head[m+q]] = m+q;
+      if (spx_update_invb(lp, p, head[p]) != 0)
+      {  /* update failed; compute factorization from scratch */
+         if (spx_factorize(lp) != 0)
+            return 1;
+      }
+      return 0;
+}
+
+/***********************************************************************
+*  primal_push - push superbasic variable to its bound
+*
+*  This routine moves non-basic variable x[k], which is strictly
+*  between its bounds, to one of its bounds or (if x[k] is free) to
+*  zero. If some basic variable blocks the move, the routine replaces
+*  it by x[k] in the basis.
+*
+*  The routine returns non-zero if the factorization has failed. */
+
+static int primal_push(struct csa *csa, int k)
+{     SPXLP *lp = csa->lp;
+      int m = lp->m;
+      double *c = lp->c;
+      double *l = lp->l;
+      double *u = lp->u;
+      int *head = lp->head;
+      char *flag = lp->flag;
+      double *x = csa->x;
+      int *ind = csa->tcol.ind;
+      double *vec = csa->tcol.vec;
+      int i, kk, p, p_flag, q, t, nnz;
+      double dq, s, target, teta, teta_q, teta_max, alfa, big, lim,
+         delta;
+      q = csa->pos[k] - m;
+      xassert(1 <= q && q <= lp->n-m);
+      /* compute column of simplex table for xN[q] = x[k] */
+      spx_eval_tcol_s(lp, q, &csa->tcol);
+      nnz = csa->tcol.nnz;
+      /* compute reduced cost of x[k] in the current basis */
+      dq = c[k];
+      for (t = 1; t <= nnz; t++)
+      {  i = ind[t];
+         dq += c[head[i]] * vec[i];
+      }
+      /* choose direction, which does not increase the objective, and
+       * determine the target value for x[k] */
+      if (dq <= - (csa->tol_dj + csa->tol_dj1 * fabs(c[k])))
+         s = +1.0, target = u[k];
+      else if (dq >= + (csa->tol_dj + csa->tol_dj1 * fabs(c[k])))
+         s = -1.0, target = l[k];
+      else if (l[k] == -DBL_MAX && u[k] == +DBL_MAX)
+         s = (x[k] > 0.0 ? -1.0 : +1.0), target = 0.0;
+      else if (l[k] == -DBL_MAX)
+         s = +1.0, target = u[k];
+      else if (u[k] == +DBL_MAX)
+         s = -1.0, target = l[k];
+      else if (x[k] - l[k] <= u[k] - x[k])
+         s = -1.0, target = l[k];
+      else
+         s = +1.0, target = u[k];
+      if (target == -DBL_MAX || target == +DBL_MAX)
+         teta_q = DBL_MAX;
+      else
+      {  teta_q = s * (target - x[k]);
+         if (teta_q < 0.0)
+            teta_q = 0.0;
+      }
+      /* first pass of Harris' ratio test: determine the maximal step
+       * for relaxed bounds of basic variables */
+      teta_max = DBL_MAX;
+      for (t = 1; t <= nnz; t++)
+      {  i = ind[t];
+         alfa = s * vec[i];
+         kk = head[i];
+         if (alfa >= + csa->tol_piv && u[kk] != +DBL_MAX)
+         {  delta = csa->tol_bnd + csa->tol_bnd1 * fabs(u[kk]);
+            lim = (u[kk] + delta - x[kk]) / alfa;
+         }
+         else if (alfa <= - csa->tol_piv && l[kk] != -DBL_MAX)
+         {  delta = csa->tol_bnd + csa->tol_bnd1 * fabs(l[kk]);
+            lim = (l[kk] - delta - x[kk]) / alfa;
+         }
+         else
+            continue;
+         if (lim < 0.0)
+            lim = 0.0;
+         if (teta_max > lim)
+            teta_max = lim;
+      }
+      p = 0, teta = teta_q;
+      if (teta_q > teta_max)
+      {  /* second pass: choose basic variable having largest pivot
+          * among those which reach their bounds not later than at
+          * teta_max */
+         big = 0.0;
+         for (t = 1; t <= nnz; t++)
+         {  i = ind[t];
+            alfa = s * vec[i];
+            kk = head[i];
+            if (alfa >= + csa->tol_piv && u[kk] != +DBL_MAX)
+               lim = (u[kk] - x[kk]) / alfa;
+            else if (alfa <= - csa->tol_piv && l[kk] != -DBL_MAX)
+               lim = (l[kk] - x[kk]) / alfa;
+            else
+               continue;
+            if (lim < 0.0)
+               lim = 0.0;
+            if (lim <= teta_max && big < fabs(alfa))
+               p = i, big = fabs(alfa), teta = lim;
+         }
+         xassert(p != 0);
+      }
+      else if (teta_q == DBL_MAX)
+      {  /* x[k] may move unlimitedly; leave it on its bound or zero
+          * and let the simplex method decide */
+         teta = 0.0;
+         target = (l[k] != -DBL_MAX ? l[k] : u[k] != +DBL_MAX ? u[k] :
+            0.0);
+      }
+      /* move x[k] and basic variables */
+      if (teta != 0.0)
+      {  for (t = 1; t <= nnz; t++)
+         {  i = ind[t];
+            x[head[i]] += (s * teta) * vec[i];
+         }
+      }
+      csa->np++;
+      if (p == 0)
+      {  /* x[k] becomes non-basic on its bound or zero */
+         x[k] = target;
+         flag[q] = (char)(l[k] != u[k] && target == u[k]);
+      }
+      else
+      {  /* xB[p] leaves the basis and x[k] enters it */
+         x[k] += s * teta;
+         kk = head[p];
+         if (s * vec[p] > 0.0)
+            x[kk] = u[kk], p_flag = (l[kk] != u[kk]);
+         else
+            x[kk] = l[kk], p_flag = 0;
+         if (change_basis(csa, p, p_flag, q))
+            return 1;
+      }
+      return 0;
+}
+
+/***********************************************************************
+*  dual_push - push reduced cost of basic variable to zero
+*
+*  This routine moves reduced cost of basic variable x[k] toward zero
+*  changing reduced costs of non-basic variables, which are kept dual
+*  feasible. If reduced cost of some non-basic variable reaches zero
+*  first, that variable replaces x[k] in the basis, and x[k] becomes
+*  non-basic on its active bound.
+*
+*  The routine returns non-zero if the factorization has failed. */
+
+static int dual_push(struct csa *csa, int k, int p_flag)
+{     SPXLP *lp = csa->lp;
+      int m = lp->m;
+      int n = lp->n;
+      double *trow = csa->trow;
+      double *d = csa->d;
+      int j, p, q;
+      double dp, s, teta;
+      p = csa->pos[k];
+      xassert(1 <= p && p <= m);
+      dp = csa->z[k];
+      xassert(dp != 0.0);
+      /* compute p-th row of simplex table */
+      spx_eval_rho(lp, p, csa->rho);
+      spx_eval_trow1(lp, &csa->at, csa->rho, trow);
+      /* reduced costs of non-basic variables change as
+       * d[j] := d[j] - teta * s * trow[j], where teta >= 0, while
+       * reduced cost of x[k] changes as dp := dp + teta * s */
+      s = (dp > 0.0 ? -1.0 : +1.0);
+      q = spy_chuzc_harris(lp, d, -dp, trow, csa->tol_piv,
+         .30 * csa->tol_dj, .30 * csa->tol_dj1);
+      if (q == 0)
+         teta = fabs(dp);
+      else
+      {  teta = d[q] / (s * trow[q]);
+         if (teta < 0.0)
+            teta = 0.0;
+         if (teta >= fabs(dp))
+            teta = fabs(dp), q = 0;
+      }
+      /* update reduced costs of non-basic variables */
+      if (teta != 0.0)
+      {  /* (skip zero elements of trow) */
+         for (j = 1; (j = vscan_next(n-m, trow, DBL_MIN, j)) <= n-m;
+            j++)
+            d[j] -= (teta * s) * trow[j];
+      }
+      csa->nd++;
+      if (q != 0)
+      {  /* x[k] leaves the basis and xN[q] enters it */
+         if (change_basis(csa, p, p_flag, q))
+            return 1;
+         d[q] = dp + teta * s;
+      }
+      return 0;
+}
+
+/***********************************************************************
+*  spx_crossover - find basis from interior-point solution
+*
+*  This routine uses the interior-point solution stored in the problem
+*  object P to construct an advanced basis for the simplex method (see
+*  comments at the beginning of this module). The basis and its valid
+*  factorization are stored in the problem object, while the basic
+*  solution remains undefined.
+*
+*  The parameter parm specifies the simplex control parameters, which
+*  provide the tolerances used on the primal and dual push phases.
+*
+*  On exit the routine stores the number of primal and dual pushes
+*  performed to locations, which np and nd point to.
+*
+*  The routine returns zero on success. If the factorization of some
+*  basis matrix failed, the routine stores the standard basis in the
+*  problem object and returns non-zero. */
+
+int spx_crossover(glp_prob *P, const glp_smcp *parm, int *np, int *nd)
+{     struct csa csa_, *csa = &csa_;
+      SPXLP lp;
+      int m = P->m;
+      int i, j, k, kk, cnt, ret, *daeh;
+      double dir, delta, *y;
+      memset(csa, 0, sizeof(struct csa));
+      *np = *nd = 0;
+      ret = 0;
+      /* start from the standard basis */
+      glp_std_basis(P);
+      if (m == 0 || glp_factorize(P) != 0)
+         goto done;
+      /* build working LP which includes all original variables */
+      csa->lp = &lp;
+      spx_init_lp(&lp, P, 0);
+      spx_alloc_lp(&lp);
+      xassert(lp.n == m + P->n);
+      csa->map = spx_talloc(&lp, 1+lp.n, int);
+      spx_build_lp(&lp, P, 0, 0, csa->map);
+      for (k = 1; k <= lp.n; k++)
+         xassert(csa->map[k] == k);
+      spx_build_basis(&lp, P, csa->map);
+      csa->pos = spx_talloc(&lp, 1+lp.n, int);
+      for (kk = 1; kk <= lp.n; kk++)
+         csa->pos[lp.head[kk]] = kk;
+      csa->tol_bnd = parm->tol_bnd;
+      csa->tol_bnd1 = .001 * parm->tol_bnd;
+      csa->tol_dj = parm->tol_dj;
+      csa->tol_dj1 = .001 * parm->tol_dj;
+      csa->tol_piv = parm->tol_piv;
+      /* convert the interior-point solution to working LP */
+      dir = (P->dir == GLP_MIN ? +1.0 : -1.0);
+      csa->x = spx_talloc(&lp, 1+lp.n, double);
+      csa->z = spx_talloc(&lp, 1+lp.n, double);
+      for (i = 1; i <= m; i++)
+      {  GLPROW *row = P->row[i];
+         csa->x[i] = row->pval * row->rii;
+         csa->z[i] = dir * row->dval / row->rii;
+      }
+      for (j = 1; j <= P->n; j++)
+      {  GLPCOL *col = P->col[j];
+         csa->x[m+j] = col->pval / col->sjj;
+         csa->z[m+j] = dir * col->dval * col->sjj;
+      }
+      /* all structural variables are non-basic; make those close to
+       * their bounds to be on the bounds, and collect the rest */
+      csa->list = spx_talloc(&lp, 1+lp.n, int);
+      csa->key = spx_talloc(&lp, 1+lp.n, double);
+      cnt = 0;
+      for (kk = m+1; kk <= lp.n; kk++)
+      {  double lk, uk, xk;
+         k = lp.head[kk];
+         lk = lp.l[k], uk = lp.u[k], xk = csa->x[k];
+         if (lk == uk)
+         {  csa->x[k] = lk, lp.flag[kk-m] = 0;
+            continue;
+         }
+         if (lk != -DBL_MAX)
+         {  delta = csa->tol_bnd + csa->tol_bnd1 * fabs(lk);
+            if (xk <= lk + delta)
+            {  csa->x[k] = lk, lp.flag[kk-m] = 0;
+               continue;
+            }
+         }
+         if (uk != +DBL_MAX)
+         {  delta = csa->tol_bnd + csa->tol_bnd1 * fabs(uk);
+            if (xk >= uk - delta)
+            {  csa->x[k] = uk, lp.flag[kk-m] = 1;
+               continue;
+            }
+         }
+         if (lk == -DBL_MAX && uk == +DBL_MAX && fabs(xk) <=
+            csa->tol_bnd)
+         {  csa->x[k] = 0.0, lp.flag[kk-m] = 0;
+            continue;
+         }
+         /* x[k] is superbasic; variables far from their bounds are
+          * pushed first, since they are most likely to be basic */
+         cnt++;
+         csa->list[cnt] = k;
+         csa->key[k] = DBL_MAX;
+         if (lk != -DBL_MAX)
+            csa->key[k] = (xk - lk) / (1.0 + fabs(lk));
+         if (uk != +DBL_MAX && csa->key[k] > (uk - xk) / (1.0 +
+            fabs(uk)))
+            csa->key[k] = (uk - xk) / (1.0 + fabs(uk));
+      }
+      /* compute values of basic variables xB = inv(B) * (b - N * xN) */
+      y = spx_talloc(&lp, 1+m, double);
+      memcpy(&y[1], &lp.b[1], m * sizeof(double));
+      for (kk = m+1; kk <= lp.n; kk++)
+      {  int ptr, end;
+         k = lp.head[kk];
+         if (csa->x[k] == 0.0)
+            continue;
+         end = lp.A_ptr[k+1];
+         for (ptr = lp.A_ptr[k]; ptr < end; ptr++)
+            y[lp.A_ind[ptr]] -= lp.A_val[ptr] * csa->x[k];
+      }
+      bfd_ftran(lp.bfd, y);
+      for (i = 1; i <= m; i++)
+         csa->x[lp.head[i]] = y[i];
+      spx_tfree(&lp, y);
+      /* primal push phase */
+      sort_key = csa->key;
+      qsort(&csa->list[1], cnt, sizeof(int), fcmp);
+      spx_alloc_vec(&lp, &csa->tcol, m);
+      for (i = 1; i <= cnt; i++)
+      {  if (primal_push(csa, csa->list[i]))
+         {  ret = 1;
+            goto fini;
+         }
+      }
+      /* collect basic variables to be pushed on dual push phase */
+      cnt = 0;
+      for (i = 1; i <= m; i++)
+      {  double lk, uk, xk, zk;
+         k = lp.head[i];
+         lk = lp.l[k], uk = lp.u[k], xk = csa->x[k], zk = csa->z[k];
+         if (fabs(zk) <= csa->tol_dj + csa->tol_dj1 * fabs(lp.c[k]))
+            continue;
+         if (lk == uk)
+            ;
+         else if (zk > 0.0 && lk != -DBL_MAX &&
+            xk <= lk + csa->tol_bnd + csa->tol_bnd1 * fabs(lk))
+            ;
+         else if (zk < 0.0 && uk != +DBL_MAX &&
+            xk >= uk - csa->tol_bnd - csa->tol_bnd1 * fabs(uk))
+            ;
+         else
+            continue;
+         cnt++;
+         csa->list[cnt] = k;
+         csa->key[k] = fabs(zk);
+      }
+      /* dual push phase */
+      if (cnt > 0)
+      {  qsort(&csa->list[1], cnt, sizeof(int), fcmp);
+         spx_alloc_at(&lp, &csa->at);
+         spx_build_at(&lp, &csa->at);
+         csa->rho = spx_talloc(&lp, 1+m, double);
+         csa->trow = spx_talloc(&lp, 1+lp.n-m, double);
+         csa->d = spx_talloc(&lp, 1+lp.n-m, double);
+         for (j = 1; j <= lp.n-m; j++)
+            csa->d[j] = csa->z[lp.head[m+j]];
+         for (i = 1; i <= cnt; i++)
+         {  k = csa->list[i];
+            /* leaving x[k] gets active bound it is now on */
+            if (dual_push(csa, k, lp.l[k] != lp.u[k] &&
+               csa->z[k] < 0.0))
+            {  ret = 1;
+               break;
+            }
+         }
+         spx_tfree(&lp, csa->d);
+         spx_tfree(&lp, csa->trow);
+         spx_tfree(&lp, csa->rho);
+         spx_free_at(&lp, &csa->at);
+      }
+fini: spx_free_vec(&lp, &csa->tcol);
+      /* store final basis and its factorization in problem object */
+      if (ret == 0)
+      {  daeh = spx_talloc(&lp, 1+lp.n, int);
+         spx_store_basis(&lp, P, csa->map, daeh);
+         spx_tfree(&lp, daeh);
+         P->valid = lp.valid;
+         P->bfd = lp.bfd;
+      }
+      else
+      {  P->bfd = lp.bfd;
+         glp_std_basis(P);
+      }
+      *np = csa->np, *nd = csa->nd;
+      spx_tfree(&lp, csa->key);
+      spx_tfree(&lp, csa->list);
+      spx_tfree(&lp, csa->z);
+      spx_tfree(&lp, csa->x);
+      spx_tfree(&lp, csa->pos);
+      spx_tfree(&lp, csa->map);
+      spx_free_lp(&lp);
+done: return ret;
+}
+
+/* eof */
@@ -263,7 +263,12 @@ double spx_eval_dj(SPXLP *lp, const double pi[/*1+m*/], int j)
 *  constraint matrix corresponding to non-basic variable xN[j] = x[k].
 *
 *  On exit components of the simplex table column are stored in the
-*  array locations tcol[1], ... tcol[m]. */
+*  array locations tcol[1], ... tcol[m].
+*
+*  Since the column N[j] is usually very sparse, FTRAN is performed in
+*  sparse mode, so if the column tcol is sparse, too, the time needed
+*  to compute it (not counting the time to clear the array tcol) does
+*  not depend on m. */
 
 void spx_eval_tcol(SPXLP *lp, int j, double tcol[/*1+m*/])
 {     int m = lp->m;
@@ -273,19 +278,65 @@ void spx_eval_tcol(SPXLP *lp, int j, double tcol[/*1+m*/])
       double *A_val = lp->A_val;
       int *head = lp->head;
       int i, k, ptr, end;
+#if 1 /* 17/X-2026 */
+      FVS x;
+#endif
       xassert(1 <= j && j <= n-m);
       k = head[m+j]; /* x[k] = xN[j] */
       /* compute tcol = - inv(B) * N[j] */
       for (i = 1; i <= m; i++)
          tcol[i] = 0.0;
+#if 0 /* 17/X-2026 */
       ptr = A_ptr[k];
       end = A_ptr[k+1];
       for (; ptr < end; ptr++)
          tcol[A_ind[ptr]] = -A_val[ptr];
       bfd_ftran(lp->bfd, tcol);
+#else
+      x.n = m, x.nnz = 0, x.ind = lp->ind, x.vec = tcol;
+      ptr = A_ptr[k];
+      end = A_ptr[k+1];
+      for (; ptr < end; ptr++)
+      {  if (A_val[ptr] != 0.0)
+         {  i = A_ind[ptr];
+            x.ind[++x.nnz] = i;
+            tcol[i] = -A_val[ptr];
+         }
+      }
+      bfd_ftran_s(lp->bfd, &x);
+#endif
       return;
 }
 
+#if 1 /* 17/X-2026 */
+void spx_eval_tcol_s(SPXLP *lp, int j, FVS *tcol)
+{     /* sparse version of spx_eval_tcol */
+      int m = lp->m;
+      int n = lp->n;
+      int *A_ptr = lp->A_ptr;
+      int *A_ind = lp->A_ind;
+      double *A_val = lp->A_val;
+      int *head = lp->head;
+      int i, k, ptr, end;
+      xassert(1 <= j && j <= n-m);
+      k = head[m+j]; /* x[k] = xN[j] */
+      /* compute tcol = - inv(B) * N[j] */
+      xassert(tcol->n == m);
+      fvs_clear_vec(tcol);
+      ptr = A_ptr[k];
+      end = A_ptr[k+1];
+      for (; ptr < end; ptr++)
+      {  if (A_val[ptr] != 0.0)
+         {  i = A_ind[ptr];
+            tcol->ind[++tcol->nnz] = i;
+            tcol->vec[i] = -A_val[ptr];
+         }
+      }
+      bfd_ftran_s(lp->bfd, tcol);
+      return;
+}
+#endif
+
 /***********************************************************************
 *  spx_eval_rho - compute i-th row of basis matrix inverse
 *
@@ -300,17 +351,28 @@ void spx_eval_tcol(SPXLP *lp, int j, double tcol[/*1+m*/])
 *  where e[i] is i-th column of unity matrix.
 *
 *  On exit components of the row are stored in the array locations
-*  row[1], ..., row[m]. */
+*  row[1], ..., row[m].
+*
+*  BTRAN is performed in sparse mode (see spx_eval_tcol). */
 
 void spx_eval_rho(SPXLP *lp, int i, double rho[/*1+m*/])
 {     int m = lp->m;
       int j;
+#if 1 /* 17/X-2026 */
+      FVS x;
+#endif
       xassert(1 <= i && i <= m);
       /* compute rho = inv(B') * e[i] */
       for (j = 1; j <= m; j++)
          rho[j] = 0.0;
       rho[i] = 1.0;
+#if 0 /* 17/X-2026 */
       bfd_btran(lp->bfd, rho);
+#else
+      x.n = m, x.nnz = 1, x.ind = lp->ind, x.vec = rho;
+      x.ind[1] = i;
+      bfd_btran_s(lp->bfd, &x);
+#endif
       return;
 }
 
@@ -816,4 +878,375 @@ int spx_update_invb(SPXLP *lp, int i, int k)
       return ret;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  spx_create_ws - create simplex workspace
+*
+*  This routine creates an empty simplex workspace and returns a
+*  pointer to it. */
+
+SPXWS *spx_create_ws(void)
+{     SPXWS *ws;
+      ws = talloc(1, SPXWS);
+      ws->nbuf = 0;
+      ws->nbuf_max = 50;
+      ws->ptr = talloc(1+ws->nbuf_max, void *);
+      ws->size = talloc(1+ws->nbuf_max, size_t);
+      ws->next = 1;
+      ws->se_type = 0;
+      ws->se_m = ws->se_n = 0;
+      ws->se_max = 0;
+      ws->se_flag = NULL;
+      ws->se_gamma = NULL;
+      ws->se_refct = 0;
+      return ws;
+}
+
+/***********************************************************************
+*  spx_reset_ws - reset simplex workspace
+*
+*  This routine resets the simplex workspace, so the next request will
+*  get the first buffer. All arrays previously obtained from the
+*  workspace become invalid. */
+
+void spx_reset_ws(SPXWS *ws)
+{     ws->next = 1;
+      return;
+}
+
+/***********************************************************************
+*  spx_ws_alloc - allocate array from simplex workspace
+*
+*  This routine takes the next buffer of the simplex workspace ws and
+*  returns a pointer to it as to an array of n elements, size bytes
+*  each. If the buffer does not exist yet, it is allocated; if it is
+*  too small, it is reallocated. The contents of the array returned is
+*  undefined, like for an array allocated with glp_alloc.
+*
+*  If ws is NULL, the routine just calls glp_alloc. */
+
+void *spx_ws_alloc(SPXWS *ws, int n, int size)
+{     int k;
+      size_t need;
+      if (ws == NULL)
+         return xalloc(n, size);
+      xassert(n >= 1 && size >= 1);
+      /* buffers are allocated in 8-byte units */
+      need = ((size_t)n * (size_t)size + 7) / 8;
+      xassert(need <= (size_t)INT_MAX);
+      k = ws->next++;
+      if (k > ws->nbuf_max)
+      {  /* enlarge the table of buffers */
+         int nbuf_max = ws->nbuf_max + ws->nbuf_max;
+         void **ptr = talloc(1+nbuf_max, void *);
+         size_t *sz = talloc(1+nbuf_max, size_t);
+         memcpy(&ptr[1], &ws->ptr[1], ws->nbuf * sizeof(void *));
+         memcpy(&sz[1], &ws->size[1], ws->nbuf * sizeof(size_t));
+         tfree(ws->ptr);
+         tfree(ws->size);
+         ws->nbuf_max = nbuf_max;
+         ws->ptr = ptr;
+         ws->size = sz;
+      }
+      if (k > ws->nbuf)
+      {  /* allocate new buffer of the exact size */
+         xassert(k == ws->nbuf + 1);
+         ws->nbuf = k;
+         ws->ptr[k] = xalloc((int)need, 8);
+         ws->size[k] = need;
+      }
+      else if (ws->size[k] < need)
+      {  /* reallocate the buffer with some reserve to avoid frequent
+          * reallocations when the problem grows gradually */
+         size_t new_size = ws->size[k] + ws->size[k] / 2;
+         if (new_size < need || new_size > (size_t)INT_MAX)
+            new_size = need;
+         tfree(ws->ptr[k]);
+         ws->ptr[k] = xalloc((int)new_size, 8);
+         ws->size[k] = new_size;
+      }
+      return ws->ptr[k];
+}
+
+/***********************************************************************
+*  spx_ws_free - free array allocated from simplex workspace
+*
+*  If ws is NULL, this routine frees the array ptr allocated with the
+*  routine spx_ws_alloc. Otherwise, the routine does nothing, because
+*  the buffer remains in the workspace for further reuse. */
+
+void spx_ws_free(SPXWS *ws, void *ptr)
+{     if (ws == NULL)
+         tfree(ptr);
+      return;
+}
+
+/***********************************************************************
+*  spx_delete_ws - delete simplex workspace
+*
+*  This routine frees all buffers of the simplex workspace and the
+*  workspace itself. */
+
+void spx_delete_ws(SPXWS *ws)
+{     int k;
+      for (k = 1; k <= ws->nbuf; k++)
+         tfree(ws->ptr[k]);
+      tfree(ws->ptr);
+      tfree(ws->size);
+      if (ws->se_flag != NULL)
+         tfree(ws->se_flag);
+      if (ws->se_gamma != NULL)
+         tfree(ws->se_gamma);
+      tfree(ws);
+      return;
+}
+
+/***********************************************************************
+*  spx_alloc_vec - allocate sparse vector for working LP
+*
+*  This routine is similar to fvs_alloc_vec, however, it allocates the
+*  sparse vector from the workspace of the working LP. */
+
+void spx_alloc_vec(SPXLP *lp, FVS *x, int n)
+{     int j;
+      xassert(n >= 0);
+      x->n = n;
+      x->nnz = 0;
+      x->ind = spx_talloc(lp, 1+n, int);
+      x->vec = spx_talloc(lp, 1+n, double);
+      for (j = 1; j <= n; j++)
+         x->vec[j] = 0.0;
+      return;
+}
+
+/**********************************************************************/
+
+void spx_free_vec(SPXLP *lp, FVS *x)
+{     /* free sparse vector allocated with spx_alloc_vec */
+      spx_tfree(lp, x->ind);
+      spx_tfree(lp, x->vec);
+      x->n = x->nnz = -1;
+      x->ind = NULL;
+      x->vec = NULL;
+      return;
+}
+
+/***********************************************************************
+*  spx_ws_save_se - save pricing data to simplex workspace
+*
+*  This routine saves the reference space and projected steepest edge
+*  weights to the workspace of the working LP for use by the next call
+*  to the solver in incremental mode. The data are saved in terms of
+*  original variables, since the working LP is rebuilt on every call.
+*
+*  The parameter type specifies the type of pricing data: 1 means that
+*  weights are assigned to non-basic variables (primal simplex), and
+*  2 means that weights are assigned to basic variables (dual simplex).
+*  The value 0 means that no data should be kept.
+*
+*  The parameters m0 and n0 are the number of rows and columns in the
+*  original LP, and the array map is the one built by the routine
+*  spx_build_lp.
+*
+*  On entry refsp[k], 1 <= k <= n, is the reference space flag for
+*  variable x[k] of the working LP, and wk[k] is its weight (ignored if
+*  variable x[k] has no weight). The parameter refct is the number of
+*  weight updates left before the reference space is to be reset. */
+
+void spx_ws_save_se(SPXLP *lp, int type, int m0, int n0,
+      const int map[], const char refsp[/*1+n*/],
+      const double wk[/*1+n*/], int refct)
+{     SPXWS *ws = lp->ws;
+      int m = lp->m;
+      int n = lp->n;
+      int *head = lp->head;
+      int i, k, kk;
+      char *bas;
+      xassert(ws != NULL);
+      xassert(m0 == m);
+      ws->se_type = 0;
+      if (type == 0 || refct <= 0)
+         goto done;
+      xassert(type == 1 || type == 2);
+      /* enlarge arrays, if necessary */
+      if (ws->se_max < m0+n0)
+      {  if (ws->se_flag != NULL)
+            tfree(ws->se_flag);
+         if (ws->se_gamma != NULL)
+            tfree(ws->se_gamma);
+         ws->se_max = m0+n0 + (m0+n0) / 2;
+         ws->se_flag = talloc(1+ws->se_max, char);
+         ws->se_gamma = talloc(1+ws->se_max, double);
+      }
+      /* mark basic variables of the working LP */
+      bas = spx_talloc(lp, 1+n, char);
+      memset(&bas[1], 0, n * sizeof(char));
+      for (i = 1; i <= m; i++)
+         bas[head[i]] = 1;
+      /* save pricing data for all original variables */
+      for (kk = 1; kk <= m0+n0; kk++)
+      {  k = (map[kk] < 0 ? -map[kk] : map[kk]);
+         if (k == 0)
+         {  /* variable was excluded; it is non-basic fixed */
+            ws->se_flag[kk] = 0;
+            continue;
+         }
+         xassert(1 <= k && k <= n);
+         ws->se_flag[kk] = SE_INC;
+         if (bas[k])
+            ws->se_flag[kk] |= SE_BAS;
+         if (refsp[k])
+            ws->se_flag[kk] |= SE_REF;
+         ws->se_gamma[kk] = (bas[k] == (type == 2) ? wk[k] : 0.0);
+      }
+      spx_tfree(lp, bas);
+      ws->se_type = type;
+      ws->se_m = m0;
+      ws->se_n = n0;
+      ws->se_refct = refct;
+done: return;
+}
+
+/***********************************************************************
+*  spx_ws_load_se - load pricing data from simplex workspace
+*
+*  This routine loads the reference space and projected steepest edge
+*  weights saved by the routine spx_ws_save_se on the previous call to
+*  the solver. The parameters type, m0, n0, and map have the same
+*  meaning as for the routine spx_ws_save_se.
+*
+*  The saved data can be reused only if the basis of the working LP is
+*  the same as it was on saving. Rows and columns added to the original
+*  LP since then are allowed, provided that new auxiliary variables are
+*  basic and new structural variables are non-basic. Since in this case
+*  the simplex table is only extended, weights of variables, which were
+*  present on saving, remain valid.
+*
+*  On exit the routine stores the reference space flags to locations
+*  refsp[k], 1 <= k <= n, and the weights of variables having weights
+*  (non-basic for primal and basic for dual) to locations wk[k]. If the
+*  weight of some variable is unknown (because the variable is new),
+*  the routine stores -1 to corresponding location wk[k], in which case
+*  the weight should be computed directly by the calling routine. New
+*  variables are not included in the reference space.
+*
+*  RETURNS
+*
+*  If the data have been loaded, the routine returns the number of
+*  weight updates left before the reference space is to be reset
+*  (always positive). Otherwise, if the data cannot be reused, the
+*  routine returns zero. */
+
+int spx_ws_load_se(SPXLP *lp, int type, int m0, int n0,
+      const int map[], char refsp[/*1+n*/], double wk[/*1+n*/])
+{     SPXWS *ws = lp->ws;
+      int m = lp->m;
+      int n = lp->n;
+      int *head = lp->head;
+      int i, k, kk, k0, flag, refct = 0;
+      char *bas;
+      xassert(type == 1 || type == 2);
+      xassert(m0 == m);
+      if (ws == NULL || ws->se_type != type)
+         goto done;
+      if (m0 < ws->se_m || n0 < ws->se_n)
+         goto done;
+      /* mark basic variables of the working LP */
+      bas = spx_talloc(lp, 1+n, char);
+      memset(&bas[1], 0, n * sizeof(char));
+      for (i = 1; i <= m; i++)
+         bas[head[i]] = 1;
+      memset(&refsp[1], 0, n * sizeof(char));
+      for (kk = 1; kk <= m0+n0; kk++)
+      {  k = (map[kk] < 0 ? -map[kk] : map[kk]);
+         xassert(0 <= k && k <= n);
+         /* determine ordinal number of the same variable on saving */
+         if (kk <= m0)
+            k0 = (kk <= ws->se_m ? kk : 0);
+         else
+            k0 = (kk - m0 <= ws->se_n ? ws->se_m + (kk - m0) : 0);
+         if (k0 == 0)
+         {  /* new variable; the basis can only be extended by new
+             * basic auxiliary and non-basic structural variables */
+            if (k != 0 && bas[k] != (kk <= m0))
+               break;
+            if (k != 0)
+               wk[k] = (bas[k] == (type == 2) ? -1.0 : 0.0);
+            continue;
+         }
+         flag = ws->se_flag[k0];
+         if (k == 0)
+         {  /* variable is excluded now, so it is non-basic */
+            if (flag & SE_BAS)
+               break;
+            /* dual weights depend on all non-basic variables in the
+             * reference space, so they cannot be reused */
+            if (type == 2 && (flag & SE_REF))
+               break;
+            continue;
+         }
+         if (bas[k] != ((flag & SE_BAS) != 0))
+            break;
+         refsp[k] = (char)((flag & SE_REF) != 0);
+         if (bas[k] == (type == 2))
+            wk[k] = (flag & SE_INC ? ws->se_gamma[k0] : -1.0);
+         else
+            wk[k] = 0.0;
+      }
+      spx_tfree(lp, bas);
+      if (kk > m0+n0)
+      {  /* all checks passed */
+         refct = ws->se_refct;
+      }
+done: return refct;
+}
+
+/***********************************************************************
+*  spx_ws_drop_se - drop pricing data saved in simplex workspace
+*
+*  This routine drops pricing data saved in the simplex workspace. It
+*  is called on changing the original LP in a way, which makes the data
+*  invalid (for example, on deleting rows or columns). */
+
+void spx_ws_drop_se(SPXWS *ws)
+{     ws->se_type = 0;
+      return;
+}
+
+/***********************************************************************
+*  spx_ws_copy_se - copy pricing data between simplex workspaces
+*
+*  This routine copies pricing data saved in the simplex workspace src
+*  to the simplex workspace dst. It allows the calling program to keep
+*  a snapshot of the data and reinstall it later, for example, to make
+*  several attempts to reoptimize the same LP starting from the same
+*  basis. */
+
+void spx_ws_copy_se(SPXWS *dst, const SPXWS *src)
+{     int k;
+      dst->se_type = 0;
+      if (src->se_type == 0)
+         goto done;
+      /* enlarge arrays, if necessary */
+      if (dst->se_max < src->se_m + src->se_n)
+      {  if (dst->se_flag != NULL)
+            tfree(dst->se_flag);
+         if (dst->se_gamma != NULL)
+            tfree(dst->se_gamma);
+         dst->se_max = src->se_max;
+         dst->se_flag = talloc(1+dst->se_max, char);
+         dst->se_gamma = talloc(1+dst->se_max, double);
+      }
+      for (k = 1; k <= src->se_m + src->se_n; k++)
+      {  dst->se_flag[k] = src->se_flag[k];
+         dst->se_gamma[k] = src->se_gamma[k];
+      }
+      dst->se_type = src->se_type;
+      dst->se_m = src->se_m;
+      dst->se_n = src->se_n;
+      dst->se_refct = src->se_refct;
+done: return;
+}
+#endif
+
 /* eof */
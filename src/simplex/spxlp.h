@@ -89,6 +89,68 @@
 *  basic variables xB, and N is a mx(n-m) matrix composed from columns
 *  of matrix A that correspond to non-basic variables xN. */
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  The structure SPXWS describes workspace of the simplex method.
+*
+*  The workspace is a set of buffers, which are used by the simplex
+*  solver routines instead of allocating and freeing working arrays on
+*  every call. The workspace is attached to the original problem object
+*  and kept alive across calls to the solver, so repeated re-solves of
+*  the same (possibly modified) problem do not need any dynamic memory
+*  allocation once the buffers have grown large enough.
+*
+*  Buffers are handed out in the order they are requested: the first
+*  request after resetting the workspace gets buffer 1, the next one
+*  buffer 2, etc. Since the solver requests its working arrays in the
+*  same order on every call, each buffer is normally reused for the
+*  same array. A buffer which is too small is reallocated. All buffers
+*  remain valid until the workspace is reset. */
+
+typedef struct SPXWS SPXWS;
+
+struct SPXWS
+{     /* simplex method workspace */
+      int nbuf;
+      /* number of buffers allocated, 0 <= nbuf <= nbuf_max */
+      int nbuf_max;
+      /* size of arrays ptr and size */
+      void **ptr; /* void *ptr[1+nbuf_max]; */
+      /* ptr[k], 1 <= k <= nbuf, is a pointer to k-th buffer */
+      size_t *size; /* size_t size[1+nbuf_max]; */
+      /* size[k], 1 <= k <= nbuf, is the size of k-th buffer, in 8-byte
+       * units */
+      int next;
+      /* ordinal number of buffer to be handed out next */
+      /*--------------------------------------------------------------*/
+      /* pricing data saved for incremental mode */
+      int se_type;
+      /* type of pricing data saved:
+       * 0 - no data saved
+       * 1 - primal projected steepest edge weights
+       * 2 - dual projected steepest edge weights */
+      int se_m, se_n;
+      /* number of rows and columns in the original LP */
+      int se_max;
+      /* size of arrays se_flag and se_gamma */
+      char *se_flag; /* char se_flag[1+se_max]; */
+      /* se_flag[k], 1 <= k <= se_m+se_n, is a set of flags for k-th
+       * original variable (auxiliary or structural):
+       * SE_INC - variable was included in the working LP
+       * SE_BAS - variable was basic
+       * SE_REF - variable was in the reference space */
+#define SE_INC 0x01
+#define SE_BAS 0x02
+#define SE_REF 0x04
+      double *se_gamma; /* double se_gamma[1+se_max]; */
+      /* se_gamma[k], 1 <= k <= se_m+se_n, is the weight of k-th
+       * original variable (only if it has the weight) */
+      int se_refct;
+      /* number of weight updates left before the reference space is
+       * to be reset */
+};
+#endif
+
 typedef struct SPXLP SPXLP;
 
 struct SPXLP
@@ -152,8 +214,73 @@ struct SPXLP
       /* basis matrix B of order m stored in factorized form */
       BFD *bfd;
       /* driver to factorization of the basis matrix */
+#if 1 /* 17/X-2026 */
+      /*--------------------------------------------------------------*/
+      SPXWS *ws;
+      /* workspace to allocate working arrays from; NULL means that
+       * working arrays are allocated with talloc */
+      int *ind; /* int ind[1+m]; */
+      /* working array used to pass patterns of sparse right-hand
+       * sides to FTRAN and BTRAN */
+#endif
 };
 
+#if 1 /* 17/X-2026 */
+#define spx_create_ws _glp_spx_create_ws
+SPXWS *spx_create_ws(void);
+/* create simplex workspace */
+
+#define spx_reset_ws _glp_spx_reset_ws
+void spx_reset_ws(SPXWS *ws);
+/* reset simplex workspace */
+
+#define spx_ws_alloc _glp_spx_ws_alloc
+void *spx_ws_alloc(SPXWS *ws, int n, int size);
+/* allocate array from simplex workspace */
+
+#define spx_ws_free _glp_spx_ws_free
+void spx_ws_free(SPXWS *ws, void *ptr);
+/* free array allocated from simplex workspace */
+
+#define spx_delete_ws _glp_spx_delete_ws
+void spx_delete_ws(SPXWS *ws);
+/* delete simplex workspace */
+
+#define spx_talloc(lp, n, type) \
+      ((type *)spx_ws_alloc((lp)->ws, n, sizeof(type)))
+/* allocate array of n elements of specified type for working LP */
+
+#define spx_tfree(lp, ptr) spx_ws_free((lp)->ws, ptr)
+/* free array allocated with spx_talloc */
+
+#define spx_alloc_vec _glp_spx_alloc_vec
+void spx_alloc_vec(SPXLP *lp, FVS *x, int n);
+/* allocate sparse vector for working LP */
+
+#define spx_free_vec _glp_spx_free_vec
+void spx_free_vec(SPXLP *lp, FVS *x);
+/* free sparse vector allocated with spx_alloc_vec */
+
+#define spx_ws_save_se _glp_spx_ws_save_se
+void spx_ws_save_se(SPXLP *lp, int type, int m0, int n0,
+      const int map[], const char refsp[/*1+n*/],
+      const double wk[/*1+n*/], int refct);
+/* save pricing data to simplex workspace */
+
+#define spx_ws_load_se _glp_spx_ws_load_se
+int spx_ws_load_se(SPXLP *lp, int type, int m0, int n0,
+      const int map[], char refsp[/*1+n*/], double wk[/*1+n*/]);
+/* load pricing data from simplex workspace */
+
+#define spx_ws_drop_se _glp_spx_ws_drop_se
+void spx_ws_drop_se(SPXWS *ws);
+/* drop pricing data saved in simplex workspace */
+
+#define spx_ws_copy_se _glp_spx_ws_copy_se
+void spx_ws_copy_se(SPXWS *dst, const SPXWS *src);
+/* copy pricing data between simplex workspaces */
+#endif
+
 #define spx_factorize _glp_spx_factorize
 int spx_factorize(SPXLP *lp);
 /* compute factorization of current basis matrix */
@@ -178,6 +305,12 @@ double spx_eval_dj(SPXLP *lp, const double pi[/*1+m*/], int j);
 void spx_eval_tcol(SPXLP *lp, int j, double tcol[/*1+m*/]);
 /* compute j-th column of simplex table */
 
+#if 1 /* 17/X-2026 */
+#define spx_eval_tcol_s _glp_spx_eval_tcol_s
+void spx_eval_tcol_s(SPXLP *lp, int j, FVS *tcol);
+/* sparse version of spx_eval_tcol */
+#endif
+
 #define spx_eval_rho _glp_spx_eval_rho
 void spx_eval_rho(SPXLP *lp, int i, double rho[/*1+m*/]);
 /* compute i-th row of basis matrix inverse */
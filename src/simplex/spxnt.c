@@ -33,10 +33,17 @@
 void spx_alloc_nt(SPXLP *lp, SPXNT *nt)
 {     int m = lp->m;
       int nnz = lp->nnz;
+#if 0 /* 17/X-2026 */
       nt->ptr = talloc(1+m, int);
       nt->len = talloc(1+m, int);
       nt->ind = talloc(1+nnz, int);
       nt->val = talloc(1+nnz, double);
+#else
+      nt->ptr = spx_talloc(lp, 1+m, int);
+      nt->len = spx_talloc(lp, 1+m, int);
+      nt->ind = spx_talloc(lp, 1+nnz, int);
+      nt->val = spx_talloc(lp, 1+nnz, double);
+#endif
       return;
 }
 
@@ -293,10 +300,17 @@ void spx_nt_prod_s(SPXLP *lp, SPXNT *nt, FVS *y, int ign, double s,
 
 void spx_free_nt(SPXLP *lp, SPXNT *nt)
 {     xassert(lp == lp);
+#if 0 /* 17/X-2026 */
       tfree(nt->ptr);
       tfree(nt->len);
       tfree(nt->ind);
       tfree(nt->val);
+#else
+      spx_tfree(lp, nt->ptr);
+      spx_tfree(lp, nt->len);
+      spx_tfree(lp, nt->ind);
+      spx_tfree(lp, nt->val);
+#endif
       return;
 }
 
@@ -83,6 +83,35 @@ struct csa
       SPXSE *se;
       /* projected steepest edge and Devex pricing data block (NULL if
        * not used) */
+#if 1 /* 17/X-2026 */
+      int refct;
+      /* number of weight updates left before the reference space is
+       * to be reset; kept here between calls to primal_simplex and
+       * between calls to the solver in incremental mode */
+      int part_size;
+      /* segment size used in partial pricing; 0 means that partial
+       * pricing is not used; in the latter case d_st = 2 means that
+       * only reduced costs computed on the last pricing step are
+       * valid */
+      int part_ptr;
+      /* index j of non-basic variable xN[j], from which the next
+       * segment starts */
+      int part_cand;
+      /* maximal number of candidates kept after scanning a segment,
+       * which is also the maximal number of minor iterations done
+       * before scanning a next segment (multiple pricing) */
+      int c_num;
+      /* number of candidates */
+      int *cand; /* int cand[1+part_cand]; */
+      /* cand[1], ..., cand[c_num] are indices j of non-basic variables
+       * xN[j], which were eligible on the last pricing step; not used
+       * if part_size = 0 */
+      int c_left;
+      /* number of minor iterations left before scanning a next
+       * segment */
+      double c_big;
+      /* largest |d[j]| of candidates on the last segment scan */
+#endif
       int num;
       /* number of eligible non-basic variables */
       int *list; /* int list[1+n-m]; */
@@ -149,6 +178,10 @@ struct csa
       /* iteration limit */
       int tm_lim;
       /* time limit, milliseconds */
+#if 1 /* 16/X-2026 */
+      volatile int *stop;
+      /* pointer to cooperative stop flag; NULL means no flag */
+#endif
       int out_frq;
 #if 0 /* 15/VII-2017 */
       /* display output frequency, iterations */
@@ -567,6 +600,32 @@ static void check_accuracy(struct csa *csa)
 }
 #endif
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  best_cand - keep most promising eligible non-basic variables
+*
+*  Given the list of eligible non-basic variables xN[j], whose indices
+*  j are stored in list[1], ..., list[num], this routine moves at most
+*  max variables having largest |d[j]| to the beginning of the list,
+*  and returns their number. (The variable having largest |d[j]| is
+*  kept, so Dantzig's rule chooses the same variable as before.) */
+
+static int best_cand(const double d[/*1+n-m*/], int num,
+      int list[/*1+num*/], int max)
+{     int t, tt, best, j;
+      xassert(max > 0);
+      for (t = 1; t <= num && t <= max; t++)
+      {  best = t;
+         for (tt = t+1; tt <= num; tt++)
+         {  if (fabs(d[list[best]]) < fabs(d[list[tt]]))
+               best = tt;
+         }
+         j = list[t], list[t] = list[best], list[best] = j;
+      }
+      return num < max ? num : max;
+}
+#endif
+
 /***********************************************************************
 *  choose_pivot - choose xN[q] and xB[p]
 *
@@ -645,6 +704,16 @@ try:  /* choose non-basic variable xN[q] */
       big = 1.0;
 #endif
       /* choose basic variable xB[p] */
+#if 1 /* 17/X-2026 */
+      /* NOTE: the long-step ratio test is used only in phase I, where
+       *       the sum of infeasibilities minimized is piecewise linear
+       *       along the ray and passing a break point may further
+       *       decrease it; in phase II the objective is linear along
+       *       the ray, and passing the first break point makes the
+       *       basis primal infeasible, so there is nothing to gain;
+       *       bound flips of boxed xN[q] are handled by the ordinary
+       *       ratio test (p < 0) */
+#endif
 #if 1 /* 23/VI-2017 */
       if (csa->phase == 1 && csa->r_test == GLP_RT_FLIP && try <= 2)
       {  /* long-step ratio test */
@@ -1186,6 +1255,9 @@ static void next_objective(glp_prob *P, struct csa *csa, int objno,
 *  GLP_ETMLIM
 *     Time limit has been exhausted.
 *
+*  GLP_ESTOP
+*     Search has been cancelled with the stop flag.
+*
 *  GLP_EFAIL
 *     The solver failed to solve LP instance. */
 
@@ -1223,6 +1295,9 @@ static int primal_simplex(struct csa *csa)
        *  0 = perturbation is not used and disabled
        * +1 = perturbation is being used */
       int j, refct, ret;
+#if 1 /* 17/X-2026 */
+      refct = csa->refct;
+#endif
 loop: /* main loop starts here */
       /* compute factorization of the basis matrix */
       if (!lp->valid)
@@ -1357,7 +1432,13 @@ loop: /* main loop starts here */
          goto fini;
       }
       /* check if the time limit has been exhausted */
+#if 0 /* 16/X-2026 */
       if (1000.0 * xdifftime(xtime(), csa->tm_beg) >= csa->tm_lim)
+#else
+      /* or if the search has been cancelled with the stop flag */
+      if (1000.0 * xdifftime(xtime(), csa->tm_beg) >= csa->tm_lim ||
+          (csa->stop != NULL && *csa->stop))
+#endif
       {  if (perturb > 0)
          {  /* remove perturbation */
             remove_perturb(csa);
@@ -1370,16 +1451,78 @@ loop: /* main loop starts here */
          if (!(csa->beta_st && csa->d_st))
             goto loop;
          display(csa, 1);
+#if 1 /* 16/X-2026 */
+         if (csa->stop != NULL && *csa->stop)
+         {  if (msg_lev >= GLP_MSG_ALL)
+               xprintf("SEARCH CANCELLED\n");
+         }
+         else
+#endif
          if (msg_lev >= GLP_MSG_ALL)
             xprintf("TIME LIMIT EXCEEDED; SEARCH TERMINATED\n");
          csa->p_stat = (csa->phase == 2 ? GLP_FEAS : GLP_INFEAS);
          csa->d_stat = GLP_UNDEF; /* will be set below */
+#if 0 /* 16/X-2026 */
          ret = GLP_ETMLIM;
+#else
+         ret = (csa->stop != NULL && *csa->stop ? GLP_ESTOP :
+            GLP_ETMLIM);
+#endif
          goto fini;
       }
       /* display the search progress */
       display(csa, 0);
       /* select eligible non-basic variables */
+#if 1 /* 17/X-2026 */
+      if (csa->part_size > 0 && csa->d_st != 1)
+      {  /* partial pricing */
+         double eps, eps1;
+         /* use the same tolerances as spx_chuzc_sel below */
+         xassert(csa->phase == 1 || csa->phase == 2);
+         eps = (csa->phase == 1 ? 1e-8 : tol_dj);
+         eps1 = (csa->phase == 1 ? 0.0 : tol_dj1);
+         /* compute simplex multipliers for current basis */
+         spx_eval_pi(lp, pi);
+         csa->num = 0;
+         if (csa->c_left > 0)
+         {  /* minor iteration; reprice only candidates left from the
+             * last segment scan */
+            csa->c_left--;
+            csa->c_num = spx_chuzc_mult(lp, pi, d, eps, eps1,
+               csa->c_num, csa->cand);
+            csa->num = csa->c_num;
+            memcpy(&list[1], &csa->cand[1], csa->num * sizeof(int));
+            /* if candidates became much less attractive than on the
+             * last segment scan, scan a next segment */
+            if (csa->num > 0)
+            {  best_cand(d, csa->num, list, 1);
+               if (fabs(d[list[1]]) < 0.5 * csa->c_big)
+                  csa->num = 0;
+            }
+         }
+         if (csa->num == 0)
+         {  /* major iteration; compute reduced costs for as few
+             * segments as possible */
+            csa->num = spx_chuzc_part(lp, pi, d, eps, eps1,
+               &csa->part_ptr, csa->part_size, list);
+            if (csa->num == 0)
+            {  /* all reduced costs have been just computed */
+               csa->d_st = 1;
+               csa->c_num = csa->c_left = 0;
+            }
+            else
+            {  /* keep most promising eligible variables as candidates
+                * for next minor iterations */
+               csa->num = best_cand(d, csa->num, list, csa->part_cand);
+               csa->c_big = fabs(d[list[1]]);
+               csa->c_num = csa->num;
+               memcpy(&csa->cand[1], &list[1], csa->num * sizeof(int));
+               csa->c_left = csa->part_cand;
+            }
+         }
+      }
+      else
+#endif
       switch (csa->phase)
       {  case 1:
             csa->num = spx_chuzc_sel(lp, d, 1e-8, 0.0, list);
@@ -1542,6 +1685,14 @@ skip1:      ;
       if (csa->p < 0)
          goto skip;
       /* xN[q] enters and xB[p] leaves the basis */
+#if 1 /* 17/X-2026 */
+      if (csa->part_size > 0)
+      {  /* partial pricing; reduced costs are not updated, since they
+          * are computed on demand on the next pricing step */
+         csa->d_st = 2;
+         goto skip2;
+      }
+#endif
       /* compute p-th row of inv(B) */
       spx_eval_rho(lp, csa->p, rho);
       /* compute p-th (pivot) row of the simplex table */
@@ -1593,6 +1744,9 @@ skip1:      ;
       {  /* new reduced costs are inaccurate */
          csa->d_st = 0;
       }
+#if 1 /* 17/X-2026 */
+skip2:
+#endif
       if (csa->phase == 1)
       {  /* xB[p] leaves the basis replacing xN[q], so set its penalty
           * coefficient to zero */
@@ -1664,6 +1818,9 @@ fini: /* restore original objective function */
          csa->num = spx_chuzc_sel(lp, d, tol_dj, tol_dj1, NULL);
          csa->d_stat = (csa->num == 0 ? GLP_FEAS : GLP_INFEAS);
       }
+#if 1 /* 17/X-2026 */
+      csa->refct = refct;
+#endif
       return ret;
 }
 
@@ -1686,7 +1843,7 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       csa->lp = &lp;
       spx_init_lp(csa->lp, P, parm->excl);
       spx_alloc_lp(csa->lp);
-      map = talloc(1+P->m+P->n, int);
+      map = spx_talloc(csa->lp, 1+P->m+P->n, int);
       spx_build_lp(csa->lp, P, parm->excl, parm->shift, map);
       spx_build_basis(csa->lp, P, map);
       switch (P->dir)
@@ -1714,12 +1871,12 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       for (k = 0; k <= csa->lp->n; k++)
          csa->lp->c[k] /= csa->fz;
 #endif
-      csa->orig_c = talloc(1+csa->lp->n, double);
+      csa->orig_c = spx_talloc(csa->lp, 1+csa->lp->n, double);
       memcpy(csa->orig_c, csa->lp->c, (1+csa->lp->n) * sizeof(double));
 #if 1 /*PERTURB*/
-      csa->orig_l = talloc(1+csa->lp->n, double);
+      csa->orig_l = spx_talloc(csa->lp, 1+csa->lp->n, double);
       memcpy(csa->orig_l, csa->lp->l, (1+csa->lp->n) * sizeof(double));
-      csa->orig_u = talloc(1+csa->lp->n, double);
+      csa->orig_u = spx_talloc(csa->lp, 1+csa->lp->n, double);
       memcpy(csa->orig_u, csa->lp->u, (1+csa->lp->n) * sizeof(double));
 #else
       csa->orig_l = csa->orig_u = NULL;
@@ -1745,28 +1902,51 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       }
       /* allocate and initialize working components */
       csa->phase = 0;
-      csa->beta = talloc(1+csa->lp->m, double);
+      csa->beta = spx_talloc(csa->lp, 1+csa->lp->m, double);
       csa->beta_st = 0;
-      csa->d = talloc(1+csa->lp->n-csa->lp->m, double);
+      csa->d = spx_talloc(csa->lp, 1+csa->lp->n-csa->lp->m, double);
       csa->d_st = 0;
       switch (parm->pricing)
       {  case GLP_PT_STD:
             csa->se = NULL;
             break;
+#if 1 /* 17/X-2026 */
+         case GLP_PT_PARTIAL:
+            /* partial pricing is used along with Dantzig's rule; the
+             * segment size is chosen to be large enough to keep the
+             * number of iterations close to that of full pricing */
+            csa->se = NULL;
+            csa->part_size = (csa->lp->n - csa->lp->m) / 8;
+            if (csa->part_size < 2 * csa->lp->m)
+               csa->part_size = 2 * csa->lp->m;
+            if (csa->part_size < 100)
+               csa->part_size = 100;
+            csa->part_ptr = 1;
+            csa->part_cand = 8;
+            csa->cand = spx_talloc(csa->lp, 1+csa->part_cand, int);
+            break;
+#endif
          case GLP_PT_PSE:
             csa->se = &se;
             spx_alloc_se(csa->lp, csa->se);
+#if 1 /* 17/X-2026 */
+            if (parm->incr)
+            {  /* reuse pricing data saved on the previous call */
+               csa->refct = spx_restore_se(csa->lp, csa->se, P->m,
+                  P->n, map);
+            }
+#endif
             break;
          default:
             xassert(parm != parm);
       }
-      csa->list = talloc(1+csa->lp->n-csa->lp->m, int);
+      csa->list = spx_talloc(csa->lp, 1+csa->lp->n-csa->lp->m, int);
 #if 0 /* 11/VI-2017 */
       csa->tcol = talloc(1+csa->lp->m, double);
       csa->trow = talloc(1+csa->lp->n-csa->lp->m, double);
 #else
-      fvs_alloc_vec(&csa->tcol, csa->lp->m);
-      fvs_alloc_vec(&csa->trow, csa->lp->n-csa->lp->m);
+      spx_alloc_vec(csa->lp, &csa->tcol, csa->lp->m);
+      spx_alloc_vec(csa->lp, &csa->trow, csa->lp->n-csa->lp->m);
 #endif
 #if 1 /* 23/VI-2017 */
       csa->bp = NULL;
@@ -1774,7 +1954,7 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
 #if 0 /* 09/VII-2017 */
       csa->work = talloc(1+csa->lp->m, double);
 #else
-      fvs_alloc_vec(&csa->work, csa->lp->m);
+      spx_alloc_vec(csa->lp, &csa->work, csa->lp->m);
 #endif
       /* initialize control parameters */
       csa->msg_lev = parm->msg_lev;
@@ -1801,7 +1981,7 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
          case GLP_RT_HAR:
             break;
          case GLP_RT_FLIP:
-            csa->bp = talloc(1+2*csa->lp->m+1, SPXBP);
+            csa->bp = spx_talloc(csa->lp, 1+2*csa->lp->m+1, SPXBP);
             break;
          default:
             xassert(parm != parm);
@@ -1815,6 +1995,9 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       csa->tol_piv = parm->tol_piv;
       csa->it_lim = parm->it_lim;
       csa->tm_lim = parm->tm_lim;
+#if 1 /* 16/X-2026 */
+      csa->stop = P->stop;
+#endif
       csa->out_frq = parm->out_frq;
       csa->out_dly = parm->out_dly;
       /* initialize working parameters */
@@ -1846,6 +2029,12 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
             /* if (csa->se) csa->se->valid=0; */
             ret = primal_simplex(csa);
          }
+#endif
+#if 1 /* 17/X-2026 */
+      /* save pricing data for the next call in incremental mode */
+      if (parm->incr && csa->se != NULL)
+         spx_save_se(csa->lp, csa->se, ret == GLP_EFAIL ? 0 : csa->refct,
+            P->m, P->n, map);
 #endif
       /* return basis factorization back to problem object */
       P->valid = csa->lp->valid;
@@ -1859,7 +2048,7 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
          goto skip;
       /* convert working LP basis to original LP basis and store it to
        * problem object */
-      daeh = talloc(1+csa->lp->n, int);
+      daeh = spx_talloc(csa->lp, 1+csa->lp->n, int);
       spx_store_basis(csa->lp, P, map, daeh);
       /* compute simplex multipliers for final basic solution found by
        * the solver */
@@ -1883,7 +2072,7 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       spx_store_sol(csa->lp, P, parm->shift, map, daeh, csa->beta,
          csa->work.vec, csa->d);
 #endif
-      tfree(daeh);
+      spx_tfree(csa->lp, daeh);
       /* save simplex iteration count */
       P->it_cnt = csa->it_cnt;
       /* report auxiliary/structural variable causing unboundedness */
@@ -1905,36 +2094,40 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       }
 skip: /* deallocate working objects and arrays */
       spx_free_lp(csa->lp);
-      tfree(map);
-      tfree(csa->orig_c);
+      spx_tfree(csa->lp, map);
+      spx_tfree(csa->lp, csa->orig_c);
 #if 1 /*PERTURB*/
-      tfree(csa->orig_l);
-      tfree(csa->orig_u);
+      spx_tfree(csa->lp, csa->orig_l);
+      spx_tfree(csa->lp, csa->orig_u);
 #endif
       if (csa->at != NULL)
          spx_free_at(csa->lp, csa->at);
       if (csa->nt != NULL)
          spx_free_nt(csa->lp, csa->nt);
-      tfree(csa->beta);
-      tfree(csa->d);
+      spx_tfree(csa->lp, csa->beta);
+      spx_tfree(csa->lp, csa->d);
       if (csa->se != NULL)
          spx_free_se(csa->lp, csa->se);
-      tfree(csa->list);
+      spx_tfree(csa->lp, csa->list);
+#if 1 /* 17/X-2026 */
+      if (csa->cand != NULL)
+         spx_tfree(csa->lp, csa->cand);
+#endif
 #if 0 /* 11/VI-2017 */
       tfree(csa->tcol);
       tfree(csa->trow);
 #else
-      fvs_free_vec(&csa->tcol);
-      fvs_free_vec(&csa->trow);
+      spx_free_vec(csa->lp, &csa->tcol);
+      spx_free_vec(csa->lp, &csa->trow);
 #endif
 #if 1 /* 23/VI-2017 */
       if (csa->bp != NULL)
-         tfree(csa->bp);
+         spx_tfree(csa->lp, csa->bp);
 #endif
 #if 0 /* 09/VII-2017 */
       tfree(csa->work);
 #else
-      fvs_free_vec(&csa->work);
+      spx_free_vec(csa->lp, &csa->work);
 #endif
       /* return to calling program */
       return ret;
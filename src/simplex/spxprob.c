@@ -34,7 +34,11 @@
 *  (The working LP object should be allocated by the calling routine.)
 *
 *  If the flag excl is set, the routine assumes that non-basic fixed
-*  variables will be excluded from the working LP. */
+*  variables will be excluded from the working LP.
+*
+*  The routine also attaches to the working LP the simplex workspace
+*  kept in the original LP object (creating it, if necessary), so all
+*  working arrays are allocated from that workspace. */
 
 void spx_init_lp(SPXLP *lp, glp_prob *P, int excl)
 {     int i, j, m, n, nnz;
@@ -76,6 +80,15 @@ void spx_init_lp(SPXLP *lp, glp_prob *P, int excl)
       xassert(n > 0);
       lp->n = n;
       lp->nnz = nnz;
+#if 1 /* 17/X-2026 */
+      /* attach the simplex workspace kept in the original problem
+       * object, so working arrays allocated on previous calls can be
+       * reused */
+      if (P->spx_ws == NULL)
+         P->spx_ws = spx_create_ws();
+      lp->ws = P->spx_ws;
+      spx_reset_ws(lp->ws);
+#endif
       return;
 }
 
@@ -89,6 +102,7 @@ void spx_alloc_lp(SPXLP *lp)
 {     int m = lp->m;
       int n = lp->n;
       int nnz = lp->nnz;
+#if 0 /* 17/X-2026 */
       lp->A_ptr = talloc(1+n+1, int);
       lp->A_ind = talloc(1+nnz, int);
       lp->A_val = talloc(1+nnz, double);
@@ -98,6 +112,20 @@ void spx_alloc_lp(SPXLP *lp)
       lp->u = talloc(1+n, double);
       lp->head = talloc(1+n, int);
       lp->flag = talloc(1+n-m, char);
+#else
+      lp->A_ptr = spx_talloc(lp, 1+n+1, int);
+      lp->A_ind = spx_talloc(lp, 1+nnz, int);
+      lp->A_val = spx_talloc(lp, 1+nnz, double);
+      lp->b = spx_talloc(lp, 1+m, double);
+      lp->c = spx_talloc(lp, 1+n, double);
+      lp->l = spx_talloc(lp, 1+n, double);
+      lp->u = spx_talloc(lp, 1+n, double);
+      lp->head = spx_talloc(lp, 1+n, int);
+      lp->flag = spx_talloc(lp, 1+n-m, char);
+#endif
+#if 1 /* 17/X-2026 */
+      lp->ind = spx_talloc(lp, 1+m, int);
+#endif
       return;
 }
 
@@ -664,7 +692,9 @@ void spx_store_sol(SPXLP *lp, glp_prob *P, int shift,
 *  LP object. */
 
 void spx_free_lp(SPXLP *lp)
-{     tfree(lp->A_ptr);
+{     /* free working LP arrays */
+#if 0 /* 17/X-2026 */
+      tfree(lp->A_ptr);
       tfree(lp->A_ind);
       tfree(lp->A_val);
       tfree(lp->b);
@@ -673,6 +703,20 @@ void spx_free_lp(SPXLP *lp)
       tfree(lp->u);
       tfree(lp->head);
       tfree(lp->flag);
+#else
+      spx_tfree(lp, lp->A_ptr);
+      spx_tfree(lp, lp->A_ind);
+      spx_tfree(lp, lp->A_val);
+      spx_tfree(lp, lp->b);
+      spx_tfree(lp, lp->c);
+      spx_tfree(lp, lp->l);
+      spx_tfree(lp, lp->u);
+      spx_tfree(lp, lp->head);
+      spx_tfree(lp, lp->flag);
+#endif
+#if 1 /* 17/X-2026 */
+      spx_tfree(lp, lp->ind);
+#endif
       return;
 }
 
@@ -23,6 +23,9 @@
 
 #include "env.h"
 #include "spychuzc.h"
+#if 1 /* 17/X-2026 */
+#include "vscan.h"
+#endif
 
 /***********************************************************************
 *  spy_chuzc_std - choose non-basic variable (dual textbook ratio test)
@@ -102,7 +105,11 @@ int spy_chuzc_std(SPXLP *lp, const double d[/*1+n-m*/],
       /* nothing is chosen so far */
       q = 0, teta_min = DBL_MAX, biga = 0.0;
       /* walk thru the list of non-basic variables */
+#if 0 /* 17/X-2026 */
       for (j = 1; j <= n-m; j++)
+#else
+      for (j = 1; (j = vscan_next(n-m, trow, tol_piv, j)) <= n-m; j++)
+#endif
       {  k = head[m+j]; /* x[k] = xN[j] */
          /* if xN[j] is fixed variable, skip it */
          if (l[k] == u[k])
@@ -179,7 +186,11 @@ int spy_chuzc_harris(SPXLP *lp, const double d[/*1+n-m*/],
       /*--------------------------------------------------------------*/
       teta_min = DBL_MAX;
       /* walk thru the list of non-basic variables */
+#if 0 /* 17/X-2026 */
       for (j = 1; j <= n-m; j++)
+#else
+      for (j = 1; (j = vscan_next(n-m, trow, tol_piv, j)) <= n-m; j++)
+#endif
       {  k = head[m+j]; /* x[k] = xN[j] */
          /* if xN[j] is fixed variable, skip it */
          if (l[k] == u[k])
@@ -218,7 +229,11 @@ int spy_chuzc_harris(SPXLP *lp, const double d[/*1+n-m*/],
       /* nothing is chosen so far */
       q = 0, biga = 0.0;
       /* walk thru the list of non-basic variables */
+#if 0 /* 17/X-2026 */
       for (j = 1; j <= n-m; j++)
+#else
+      for (j = 1; (j = vscan_next(n-m, trow, tol_piv, j)) <= n-m; j++)
+#endif
       {  k = head[m+j]; /* x[k] = xN[j] */
          /* if xN[j] is fixed variable, skip it */
          if (l[k] == u[k])
@@ -426,7 +441,11 @@ int spy_ls_eval_bp(SPXLP *lp, const double d[/*1+n-m*/],
        * can reach zero on increasing the ray parameter teta >= 0 */
       nnn = 0, teta_max = DBL_MAX;
       /* walk thru the list of non-basic variables */
+#if 0 /* 17/X-2026 */
       for (j = 1; j <= n-m; j++)
+#else
+      for (j = 1; (j = vscan_next(n-m, trow, tol_piv, j)) <= n-m; j++)
+#endif
       {  k = head[m+j]; /* x[k] = xN[j] */
          /* if xN[j] is fixed variable, skip it */
          if (l[k] == u[k])
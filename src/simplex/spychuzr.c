@@ -165,14 +165,25 @@ void spy_alloc_se(SPXLP *lp, SPYSE *se)
       int i;
 #endif
       se->valid = 0;
+#if 0 /* 17/X-2026 */
       se->refsp = talloc(1+n, char);
       se->gamma = talloc(1+m, double);
       se->work = talloc(1+m, double);
+#else
+      se->refsp = spx_talloc(lp, 1+n, char);
+      se->gamma = spx_talloc(lp, 1+m, double);
+      se->work = spx_talloc(lp, 1+m, double);
+#endif
 #if 1 /* 30/III-2016 */
       se->u.n = m;
       se->u.nnz = 0;
+#if 0 /* 17/X-2026 */
       se->u.ind = talloc(1+m, int);
       se->u.vec = talloc(1+m, double);
+#else
+      se->u.ind = spx_talloc(lp, 1+m, int);
+      se->u.vec = spx_talloc(lp, 1+m, double);
+#endif
       for (i = 1; i <= m; i++)
          se->u.vec[i] = 0.0;
 #endif
@@ -228,7 +239,9 @@ void spy_reset_refsp(SPXLP *lp, SPYSE *se)
 *  variable xN[j], and dual non-basic variable lambdaB[j] corresponds
 *  to primal basic variable xB[i].
 *
-*  NOTE: For testing/debugging only. */
+*  NOTE: This routine is expensive, since it computes row of the
+*        simplex table. It is used for testing/debugging and to
+*        compute weights of new variables in incremental mode. */
 
 double spy_eval_gamma_i(SPXLP *lp, SPYSE *se, int i)
 {     int m = lp->m;
@@ -253,6 +266,95 @@ double spy_eval_gamma_i(SPXLP *lp, SPYSE *se, int i)
       return gamma_i;
 }
 
+#if 1 /* 17/X-2026 */
+/***********************************************************************
+*  spy_save_se - save dual pricing data for incremental mode
+*
+*  This routine saves the dual reference space and projected steepest
+*  edge weights of the current basis to the workspace of the working
+*  LP, so they can be reused by the next call to the dual simplex
+*  solver with the routine spy_restore_se. If the weights are not
+*  valid, the routine drops the data previously saved.
+*
+*  The parameter refct is the number of weight updates left before the
+*  reference space is to be reset. The parameters m0 and n0 are the
+*  number of rows and columns in the original LP, and the array map is
+*  the one built by the routine spx_build_lp. */
+
+void spy_save_se(SPXLP *lp, SPYSE *se, int refct, int m0, int n0,
+      const int map[])
+{     int m = lp->m;
+      int n = lp->n;
+      int *head = lp->head;
+      int i;
+      double *wk;
+      if (!se->valid)
+      {  spx_ws_save_se(lp, 0, m0, n0, map, NULL, NULL, 0);
+         goto done;
+      }
+      wk = spx_talloc(lp, 1+n, double);
+      for (i = 1; i <= m; i++)
+         wk[head[i]] = se->gamma[i];
+      spx_ws_save_se(lp, 2, m0, n0, map, se->refsp, wk, refct);
+      spx_tfree(lp, wk);
+done: return;
+}
+
+/***********************************************************************
+*  spy_restore_se - restore dual pricing data for incremental mode
+*
+*  This routine restores the dual reference space and projected
+*  steepest edge weights saved by the routine spy_save_se on the
+*  previous call to the dual simplex solver. Weights of new basic
+*  variables are computed directly, so the basis factorization should
+*  be valid. The parameters m0, n0, and map are the same as for
+*  spy_save_se.
+*
+*  RETURNS
+*
+*  If the pricing data have been restored, the routine returns the
+*  number of weight updates left before the reference space is to be
+*  reset. Otherwise, the routine returns zero, in which case the data
+*  block remains invalid. */
+
+int spy_restore_se(SPXLP *lp, SPYSE *se, int m0, int n0,
+      const int map[])
+{     int m = lp->m;
+      int n = lp->n;
+      int *head = lp->head;
+      int i, cnt, refct;
+      double *wk;
+      xassert(lp->valid);
+      se->valid = 0;
+      wk = spx_talloc(lp, 1+n, double);
+      refct = spx_ws_load_se(lp, 2, m0, n0, map, se->refsp, wk);
+      if (refct == 0)
+         goto skip;
+      /* computing weights directly is expensive, so if there are too
+       * many new variables, resetting the reference space is better */
+      cnt = 0;
+      for (i = 1; i <= m; i++)
+      {  if (wk[head[i]] < 0.0)
+            cnt++;
+      }
+      if (cnt > 10 + m / 10)
+      {  refct = 0;
+         goto skip;
+      }
+      se->valid = 1;
+      for (i = 1; i <= m; i++)
+      {  if (wk[head[i]] >= 0.0)
+            se->gamma[i] = wk[head[i]];
+      }
+      for (i = 1; i <= m; i++)
+      {  if (wk[head[i]] < 0.0)
+            se->gamma[i] = spy_eval_gamma_i(lp, se, i);
+      }
+skip: spx_tfree(lp, wk);
+      return refct;
+}
+#endif
+
 /***********************************************************************
 *  spy_chuzr_pse - choose basic variable (dual projected steepest edge)
 *
@@ -470,12 +572,23 @@ double spy_update_gamma_s(SPXLP *lp, SPYSE *se, int p, int q,
 
 void spy_free_se(SPXLP *lp, SPYSE *se)
 {     xassert(lp == lp);
+#if 0 /* 17/X-2026 */
       tfree(se->refsp);
       tfree(se->gamma);
       tfree(se->work);
+#else
+      spx_tfree(lp, se->refsp);
+      spx_tfree(lp, se->gamma);
+      spx_tfree(lp, se->work);
+#endif
 #if 1 /* 30/III-2016 */
+#if 0 /* 17/X-2026 */
       tfree(se->u.ind);
       tfree(se->u.vec);
+#else
+      spx_tfree(lp, se->u.ind);
+      spx_tfree(lp, se->u.vec);
+#endif
 #endif
       return;
 }
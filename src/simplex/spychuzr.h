@@ -71,6 +71,18 @@ void spy_reset_refsp(SPXLP *lp, SPYSE *se);
 double spy_eval_gamma_i(SPXLP *lp, SPYSE *se, int i);
 /* compute dual projected steepest edge weight directly */
 
+#if 1 /* 17/X-2026 */
+#define spy_save_se _glp_spy_save_se
+void spy_save_se(SPXLP *lp, SPYSE *se, int refct, int m0, int n0,
+      const int map[]);
+/* save dual pricing data for incremental mode */
+
+#define spy_restore_se _glp_spy_restore_se
+int spy_restore_se(SPXLP *lp, SPYSE *se, int m0, int n0,
+      const int map[]);
+/* restore dual pricing data for incremental mode */
+#endif
+
 #define spy_chuzr_pse _glp_spy_chuzr_pse
 int spy_chuzr_pse(SPXLP *lp, SPYSE *se, const double beta[/*1+m*/],
       int num, const int list[]);
@@ -37,6 +37,9 @@
 #include "fvs.h"
 #endif
 #endif
+#if 1 /* 17/X-2026 */
+#include "vscan.h"
+#endif
 
 #define CHECK_ACCURACY 0
 /* (for debugging) */
@@ -90,6 +93,12 @@ struct csa
       SPYSE *se;
       /* dual projected steepest edge and Devex pricing data block
        * (NULL if not used) */
+#if 1 /* 17/X-2026 */
+      int refct;
+      /* number of weight updates left before the reference space is
+       * to be reset; kept here between calls to dual_simplex and
+       * between calls to the solver in incremental mode */
+#endif
 #if 0 /* 30/III-2016 */
       int num;
       /* number of eligible basic variables */
@@ -165,6 +174,10 @@ struct csa
       /* iteration limit */
       int tm_lim;
       /* time limit, milliseconds */
+#if 1 /* 16/X-2026 */
+      volatile int *stop;
+      /* pointer to cooperative stop flag; NULL means no flag */
+#endif
       int out_frq;
 #if 0 /* 15/VII-2017 */
       /* display output frequency, iterations */
@@ -675,8 +688,13 @@ static int choose_pivot(struct csa *csa)
       double *trow = csa->work1;
       SPYBP *bp = csa->bp;
       double tol_piv = csa->tol_piv;
+#if 0 /* 17/X-2026 */
       int try, nnn, j, k, p, q, t, t_best, nbp, ret;
       double big, temp, r, best_ratio, dz_best;
+#else
+      int try, nnn, k, p, q, t, t_best, nbp, ret;
+      double big, r, best_ratio, dz_best;
+#endif
       xassert(csa->beta_st);
       xassert(csa->d_st);
 more: /* initial number of eligible basic variables */
@@ -710,6 +728,7 @@ try:  /* choose basic variable xB[p] */
          spx_nt_prod(lp, nt, trow, 1, -1.0, rho);
 #if 1 /* 23/III-2016 */
       /* big := max(1, |trow[1]|, ..., |trow[n-m]|) */
+#if 0 /* 17/X-2026 */
       big = 1.0;
       for (j = 1; j <= n-m; j++)
       {  temp = trow[j];
@@ -718,6 +737,11 @@ try:  /* choose basic variable xB[p] */
          if (big < temp)
             big = temp;
       }
+#else
+      big = vscan_amax(n-m, trow);
+      if (big < 1.0)
+         big = 1.0;
+#endif
 #else
       /* this still puzzles me */
       big = 1.0;
@@ -1271,6 +1295,9 @@ static void next_objective(glp_prob *P, struct csa *csa, int objno,
 *  GLP_ETMLIM
 *     Time limit has been exhausted.
 *
+*  GLP_ESTOP
+*     Search has been cancelled with the stop flag.
+*
 *  GLP_EFAIL
 *     The solver failed to solve LP instance. */
 
@@ -1320,6 +1347,9 @@ static int dual_simplex(struct csa *csa)
       double t_start;
 #endif
       check_flags(csa);
+#if 1 /* 17/X-2026 */
+      refct = csa->refct;
+#endif
 loop: /* main loop starts here */
       /* compute factorization of the basis matrix */
       if (!lp->valid)
@@ -1531,7 +1561,13 @@ loop: /* main loop starts here */
          goto fini;
       }
       /* check if the time limit has been exhausted */
+#if 0 /* 16/X-2026 */
       if (1000.0 * xdifftime(xtime(), csa->tm_beg) >= csa->tm_lim)
+#else
+      /* or if the search has been cancelled with the stop flag */
+      if (1000.0 * xdifftime(xtime(), csa->tm_beg) >= csa->tm_lim ||
+          (csa->stop != NULL && *csa->stop))
+#endif
       {  if (perturb > 0)
          {  /* remove perturbation */
             remove_perturb(csa);
@@ -1544,6 +1580,13 @@ loop: /* main loop starts here */
          if (!(csa->beta_st && csa->d_st))
             goto loop;
          display(csa, 1);
+#if 1 /* 16/X-2026 */
+         if (csa->stop != NULL && *csa->stop)
+         {  if (msg_lev >= GLP_MSG_ALL)
+               xprintf("SEARCH CANCELLED\n");
+         }
+         else
+#endif
          if (msg_lev >= GLP_MSG_ALL)
             xprintf("TIME LIMIT EXCEEDED; SEARCH TERMINATED\n");
          if (csa->phase == 1)
@@ -1559,7 +1602,12 @@ loop: /* main loop starts here */
          csa->p_stat = (csa->r.nnz == 0 ? GLP_FEAS : GLP_INFEAS);
 #endif
          csa->d_stat = (csa->phase == 1 ? GLP_INFEAS : GLP_FEAS);
+#if 0 /* 16/X-2026 */
          ret = GLP_ETMLIM;
+#else
+         ret = (csa->stop != NULL && *csa->stop ? GLP_ESTOP :
+            GLP_ETMLIM);
+#endif
          goto fini;
       }
       /* display the search progress */
@@ -1885,6 +1933,9 @@ fini:
       xprintf("Updating gamma  = %10.3f\n", t_upd3);
       xprintf("Updating N      = %10.3f\n", t_upd4);
       xprintf("Updating inv(B) = %10.3f\n", t_upd5);
+#endif
+#if 1 /* 17/X-2026 */
+      csa->refct = refct;
 #endif
       return ret;
 }
@@ -1908,7 +1959,7 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
       csa->lp = &lp;
       spx_init_lp(csa->lp, P, parm->excl);
       spx_alloc_lp(csa->lp);
-      map = talloc(1+P->m+P->n, int);
+      map = spx_talloc(csa->lp, 1+P->m+P->n, int);
       spx_build_lp(csa->lp, P, parm->excl, parm->shift, map);
       spx_build_basis(csa->lp, P, map);
       switch (P->dir)
@@ -1936,13 +1987,13 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
       for (k = 0; k <= csa->lp->n; k++)
          csa->lp->c[k] /= csa->fz;
 #endif
-      csa->orig_b = talloc(1+csa->lp->m, double);
+      csa->orig_b = spx_talloc(csa->lp, 1+csa->lp->m, double);
       memcpy(csa->orig_b, csa->lp->b, (1+csa->lp->m) * sizeof(double));
-      csa->orig_c = talloc(1+csa->lp->n, double);
+      csa->orig_c = spx_talloc(csa->lp, 1+csa->lp->n, double);
       memcpy(csa->orig_c, csa->lp->c, (1+csa->lp->n) * sizeof(double));
-      csa->orig_l = talloc(1+csa->lp->n, double);
+      csa->orig_l = spx_talloc(csa->lp, 1+csa->lp->n, double);
       memcpy(csa->orig_l, csa->lp->l, (1+csa->lp->n) * sizeof(double));
-      csa->orig_u = talloc(1+csa->lp->n, double);
+      csa->orig_u = spx_talloc(csa->lp, 1+csa->lp->n, double);
       memcpy(csa->orig_u, csa->lp->u, (1+csa->lp->n) * sizeof(double));
       switch (parm->aorn)
       {  case GLP_USE_AT:
@@ -1965,17 +2016,28 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
       }
       /* allocate and initialize working components */
       csa->phase = 0;
-      csa->beta = talloc(1+csa->lp->m, double);
+      csa->beta = spx_talloc(csa->lp, 1+csa->lp->m, double);
       csa->beta_st = 0;
-      csa->d = talloc(1+csa->lp->n-csa->lp->m, double);
+      csa->d = spx_talloc(csa->lp, 1+csa->lp->n-csa->lp->m, double);
       csa->d_st = 0;
       switch (parm->pricing)
       {  case GLP_PT_STD:
+#if 1 /* 17/X-2026 */
+         case GLP_PT_PARTIAL:
+            /* partial pricing is not used in the dual simplex */
+#endif
             csa->se = NULL;
             break;
          case GLP_PT_PSE:
             csa->se = &se;
             spy_alloc_se(csa->lp, csa->se);
+#if 1 /* 17/X-2026 */
+            if (parm->incr)
+            {  /* reuse pricing data saved on the previous call */
+               csa->refct = spy_restore_se(csa->lp, csa->se, P->m,
+                  P->n, map);
+            }
+#endif
             break;
          default:
             xassert(parm != parm);
@@ -1985,15 +2047,15 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
       csa->trow = talloc(1+csa->lp->n-csa->lp->m, double);
       csa->tcol = talloc(1+csa->lp->m, double);
 #else
-      fvs_alloc_vec(&csa->r, csa->lp->m);
-      fvs_alloc_vec(&csa->trow, csa->lp->n-csa->lp->m);
-      fvs_alloc_vec(&csa->tcol, csa->lp->m);
+      spx_alloc_vec(csa->lp, &csa->r, csa->lp->m);
+      spx_alloc_vec(csa->lp, &csa->trow, csa->lp->n-csa->lp->m);
+      spx_alloc_vec(csa->lp, &csa->tcol, csa->lp->m);
 #endif
 #if 1 /* 16/III-2016 */
       csa->bp = NULL;
 #endif
-      csa->work = talloc(1+csa->lp->m, double);
-      csa->work1 = talloc(1+csa->lp->n-csa->lp->m, double);
+      csa->work = spx_talloc(csa->lp, 1+csa->lp->m, double);
+      csa->work1 = spx_talloc(csa->lp, 1+csa->lp->n-csa->lp->m, double);
 #if 0 /* 11/VI-2017 */
 #if 1 /* 31/III-2016 */
       fvs_alloc_vec(&csa->wrow, csa->lp->n-csa->lp->m);
@@ -2020,7 +2082,8 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
          case GLP_RT_HAR:
             break;
          case GLP_RT_FLIP:
-            csa->bp = talloc(1+csa->lp->n-csa->lp->m, SPYBP);
+            csa->bp = spx_talloc(csa->lp, 1+csa->lp->n-csa->lp->m,
+               SPYBP);
             break;
          default:
             xassert(parm != parm);
@@ -2051,6 +2114,9 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
 #endif
       csa->it_lim = parm->it_lim;
       csa->tm_lim = parm->tm_lim;
+#if 1 /* 16/X-2026 */
+      csa->stop = P->stop;
+#endif
       csa->out_frq = parm->out_frq;
       csa->out_dly = parm->out_dly;
       /* initialize working parameters */
@@ -2083,6 +2149,12 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
                csa->se->valid = 0;
             ret = dual_simplex(csa);
          }
+#endif
+#if 1 /* 17/X-2026 */
+      /* save pricing data for the next call in incremental mode */
+      if (parm->incr && csa->se != NULL)
+         spy_save_se(csa->lp, csa->se, ret == GLP_EFAIL ? 0 : csa->refct,
+            P->m, P->n, map);
 #endif
       /* return basis factorization back to problem object */
       P->valid = csa->lp->valid;
@@ -2096,7 +2168,7 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
          goto skip;
       /* convert working LP basis to original LP basis and store it to
        * problem object */
-      daeh = talloc(1+csa->lp->n, int);
+      daeh = spx_talloc(csa->lp, 1+csa->lp->n, int);
       spx_store_basis(csa->lp, P, map, daeh);
       /* compute simplex multipliers for final basic solution found by
        * the solver */
@@ -2111,7 +2183,7 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
 #endif
       spx_store_sol(csa->lp, P, parm->shift, map, daeh, csa->beta,
          csa->work, csa->d);
-      tfree(daeh);
+      spx_tfree(csa->lp, daeh);
       /* save simplex iteration count */
       P->it_cnt = csa->it_cnt;
       /* report auxiliary/structural variable causing unboundedness */
@@ -2133,37 +2205,37 @@ int spy_dual(glp_prob *P, const glp_smcp *parm)
       }
 skip: /* deallocate working objects and arrays */
       spx_free_lp(csa->lp);
-      tfree(map);
-      tfree(csa->orig_b);
-      tfree(csa->orig_c);
-      tfree(csa->orig_l);
-      tfree(csa->orig_u);
+      spx_tfree(csa->lp, map);
+      spx_tfree(csa->lp, csa->orig_b);
+      spx_tfree(csa->lp, csa->orig_c);
+      spx_tfree(csa->lp, csa->orig_l);
+      spx_tfree(csa->lp, csa->orig_u);
       if (csa->at != NULL)
          spx_free_at(csa->lp, csa->at);
       if (csa->nt != NULL)
          spx_free_nt(csa->lp, csa->nt);
-      tfree(csa->beta);
-      tfree(csa->d);
+      spx_tfree(csa->lp, csa->beta);
+      spx_tfree(csa->lp, csa->d);
       if (csa->se != NULL)
          spy_free_se(csa->lp, csa->se);
 #if 0 /* 30/III-2016 */
       tfree(csa->list);
       tfree(csa->trow);
 #else
-      fvs_free_vec(&csa->r);
-      fvs_free_vec(&csa->trow);
+      spx_free_vec(csa->lp, &csa->r);
+      spx_free_vec(csa->lp, &csa->trow);
 #endif
 #if 1 /* 16/III-2016 */
       if (csa->bp != NULL)
-         tfree(csa->bp);
+         spx_tfree(csa->lp, csa->bp);
 #endif
 #if 0 /* 29/III-2016 */
       tfree(csa->tcol);
 #else
-      fvs_free_vec(&csa->tcol);
+      spx_free_vec(csa->lp, &csa->tcol);
 #endif
-      tfree(csa->work);
-      tfree(csa->work1);
+      spx_tfree(csa->lp, csa->work);
+      spx_tfree(csa->lp, csa->work1);
 #if 0 /* 11/VI-2017 */
 #if 1 /* 31/III-2016 */
       fvs_free_vec(&csa->wrow);